@@ -29,6 +29,7 @@ void EditorGUITest::Initialize()
 
     auto window = gameHost->GetWindow();
     hierarchy = std::make_unique<GUI::WidgetHierarchy>(window, gameHost->GetKeyboard());
+    hierarchy->SetRetainedRenderingEnabled(true);
 
     auto dispatcher = hierarchy->GetDispatcher();
     {
@@ -6,6 +6,7 @@
 #include "Pomdog/Audio/AudioChannels.hpp"
 #include "Pomdog/Audio/detail/ForwardDeclarations.hpp"
 #include "Pomdog/Basic/Export.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -36,6 +37,9 @@ public:
     /// Gets the number of channels in the audip clip.
     AudioChannels GetChannels() const;
 
+    /// Gets the size of the audio data in bytes.
+    std::size_t GetSizeInBytes() const;
+
     /// Gets the pointer of the native audio clip.
     Detail::SoundSystem::NativeAudioClip* GetNativeAudioClip();
 
@@ -0,0 +1,41 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Audio/AudioChannels.hpp"
+#include "Pomdog/Basic/Export.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Pomdog {
+
+/// AudioStream decodes 16-bit PCM audio incrementally, so that long audio
+/// such as background music can be played without decoding it in advance.
+///
+/// A stream is used by one StreamingAudioSource at a time, which reads it
+/// on its own thread.
+class POMDOG_EXPORT AudioStream {
+public:
+    virtual ~AudioStream() = default;
+
+    /// Gets the number of samples per second.
+    [[nodiscard]] virtual int GetSampleRate() const noexcept = 0;
+
+    /// Gets the number of channels in the audio stream.
+    [[nodiscard]] virtual AudioChannels GetChannels() const noexcept = 0;
+
+    /// Gets the length of the audio stream in sample frames.
+    [[nodiscard]] virtual std::size_t GetFrameCount() const noexcept = 0;
+
+    /// Decodes at most `frameCount` sample frames of interleaved samples and
+    /// returns the number of frames decoded. Returns 0 at the end of stream.
+    [[nodiscard]] virtual std::size_t
+    Read(std::int16_t* samples, std::size_t frameCount) = 0;
+
+    /// Moves the read position to the specified sample frame.
+    /// Seeking to GetFrameCount() moves to the end of stream, where Read() returns 0.
+    /// Returns false if the position cannot be sought.
+    [[nodiscard]] virtual bool Seek(std::size_t frame) = 0;
+};
+
+} // namespace Pomdog
@@ -0,0 +1,78 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Application/Duration.hpp"
+#include "Pomdog/Audio/SoundState.hpp"
+#include "Pomdog/Audio/detail/ForwardDeclarations.hpp"
+#include "Pomdog/Basic/Export.hpp"
+#include <memory>
+
+namespace Pomdog {
+
+/// StreamingAudioSource plays an audio stream while decoding it.
+///
+/// Unlike SoundEffect, the audio is not decoded in advance. A background
+/// thread decodes the stream into a few short buffers ahead of playback,
+/// so the memory usage does not depend on the length of the audio.
+/// It is intended for long audio such as background music.
+class POMDOG_EXPORT StreamingAudioSource final {
+public:
+    StreamingAudioSource(
+        AudioEngine& audioEngine,
+        std::unique_ptr<AudioStream>&& audioStream,
+        bool isLooped);
+
+    ~StreamingAudioSource();
+
+    StreamingAudioSource(const StreamingAudioSource&) = delete;
+    StreamingAudioSource(StreamingAudioSource&&) = default;
+    StreamingAudioSource& operator=(const StreamingAudioSource&) = delete;
+    StreamingAudioSource& operator=(StreamingAudioSource&&) = default;
+
+    /// Pauses the sound.
+    void Pause();
+
+    /// Plays or resumes playing the sound.
+    void Play();
+
+    /// Stops playing the sound immediately and rewinds it.
+    void Stop();
+
+    /// Moves the playback position. The sound keeps its current state.
+    void Seek(const Duration& position);
+
+    /// Returns true if the audio stream is looping, false otherwise.
+    bool IsLooped() const;
+
+    /// Stops looping the sound when it reaches the end of the sound.
+    void ExitLoop();
+
+    /// Gets the current state of the audio source.
+    /// The state becomes stopped when a non-looping sound reaches the end.
+    SoundState GetState() const;
+
+    /// Gets the length of the audio stream.
+    Duration GetLength() const;
+
+    /// Gets the pitch of the audio source.
+    float GetPitch() const;
+
+    /// Sets the pitch of the audio source (-1.0 to 1.0).
+    void SetPitch(float pitch);
+
+    /// Gets the volume of the audio source.
+    float GetVolume() const;
+
+    /// Sets the volume of the audio source (0.0 to 1.0).
+    void SetVolume(float volume);
+
+private:
+    std::unique_ptr<Detail::SoundSystem::NativeStreamingAudioSource> nativeSource;
+    Duration length;
+    float pitch;
+    float volume;
+    bool isLooped;
+};
+
+} // namespace Pomdog
@@ -17,12 +17,14 @@ namespace OpenAL {
 class AudioClipAL;
 class AudioEngineAL;
 class SoundEffectAL;
+class StreamingAudioSourceAL;
 
 } // namespace OpenAL
 
 using NativeAudioClip = OpenAL::AudioClipAL;
 using NativeAudioEngine = OpenAL::AudioEngineAL;
 using NativeSoundEffect = OpenAL::SoundEffectAL;
+using NativeStreamingAudioSource = OpenAL::StreamingAudioSourceAL;
 
 #elif defined(POMDOG_PLATFORM_WIN32) || defined(POMDOG_PLATFORM_XBOX_ONE)
 
@@ -31,12 +33,14 @@ namespace XAudio2 {
 class AudioClipXAudio2;
 class AudioEngineXAudio2;
 class SoundEffectXAudio2;
+class StreamingAudioSourceXAudio2;
 
 } // namespace XAudio2
 
 using NativeAudioClip = XAudio2::AudioClipXAudio2;
 using NativeAudioEngine = XAudio2::AudioEngineXAudio2;
 using NativeSoundEffect = XAudio2::SoundEffectXAudio2;
+using NativeStreamingAudioSource = XAudio2::StreamingAudioSourceXAudio2;
 
 #endif
 
@@ -46,7 +50,9 @@ class AudioClip;
 class AudioEmitter;
 class AudioEngine;
 class AudioListener;
+class AudioStream;
 class SoundEffect;
+class StreamingAudioSource;
 
 enum class AudioChannel : std::uint8_t;
 enum class SoundState : std::uint8_t;
@@ -0,0 +1,70 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Basic/Export.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace Pomdog {
+
+class AssetManager;
+
+/// AssetKey is an asset path interned by AssetManager::MakeAssetKey().
+///
+/// Loading an asset with a key indexes the cache of the manager directly,
+/// without building, hashing or comparing the path, so keys are suitable
+/// for code that loads assets every frame. A key is only valid for the
+/// manager that created it.
+class POMDOG_EXPORT AssetKey final {
+public:
+    AssetKey() noexcept = default;
+
+    /// Returns true if the key was created by an AssetManager.
+    [[nodiscard]] bool IsValid() const noexcept
+    {
+        return index != InvalidIndex;
+    }
+
+    [[nodiscard]] std::size_t GetHash() const noexcept
+    {
+        return std::hash<std::uint32_t>{}(index);
+    }
+
+    [[nodiscard]] bool operator==(const AssetKey& other) const noexcept
+    {
+        return index == other.index;
+    }
+
+    [[nodiscard]] bool operator!=(const AssetKey& other) const noexcept
+    {
+        return index != other.index;
+    }
+
+private:
+    friend class AssetManager;
+
+    static constexpr std::uint32_t InvalidIndex = ~std::uint32_t{0};
+
+    explicit AssetKey(std::uint32_t indexIn) noexcept
+        : index(indexIn)
+    {
+    }
+
+    std::uint32_t index = InvalidIndex;
+};
+
+} // namespace Pomdog
+
+namespace std {
+
+template <>
+struct hash<Pomdog::AssetKey> {
+    std::size_t operator()(const Pomdog::AssetKey& key) const noexcept
+    {
+        return key.GetHash();
+    }
+};
+
+} // namespace std
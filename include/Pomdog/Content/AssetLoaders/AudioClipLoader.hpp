@@ -5,6 +5,7 @@
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Content/AssetLoaders/AssetLoader.hpp"
 #include "Pomdog/Utility/Errors.hpp"
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -20,6 +21,9 @@ template <>
 struct POMDOG_EXPORT AssetLoader<AudioClip> final {
     [[nodiscard]] std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
     operator()(AssetManager& assets, const std::string& filePath);
+
+    /// Returns the size of the audio data for the memory budget of AssetManager.
+    [[nodiscard]] static std::size_t GetByteSize(const AudioClip& audioClip);
 };
 
 } // namespace Pomdog::Detail
@@ -4,7 +4,10 @@
 
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Content/AssetLoaders/AssetLoader.hpp"
+#include "Pomdog/Content/Image/ImageBuffer.hpp"
 #include "Pomdog/Utility/Errors.hpp"
+#include "Pomdog/Utility/MappedFile.hpp"
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -18,8 +21,29 @@ namespace Pomdog::Detail {
 
 template <>
 struct POMDOG_EXPORT AssetLoader<Texture2D> final {
+    /// An image that has been read and decoded but not uploaded to the GPU yet.
+    struct DecodedAsset final {
+        ImageBuffer Image;
+
+        // NOTE: The file contents, which `Image.PixelData` may point into.
+        MappedFile Binary;
+    };
+
     [[nodiscard]] std::tuple<std::shared_ptr<Texture2D>, std::shared_ptr<Error>>
     operator()(AssetManager& assets, const std::string& filePath);
+
+    /// Reads and decodes the image file. This does not use the graphics
+    /// device, so it can be called on any thread.
+    [[nodiscard]] static std::tuple<DecodedAsset, std::shared_ptr<Error>>
+    Decode(const AssetManager& assets, const std::string& filePath);
+
+    /// Creates the texture from the decoded image. This must be called on
+    /// the thread that owns the graphics device.
+    [[nodiscard]] static std::tuple<std::shared_ptr<Texture2D>, std::shared_ptr<Error>>
+    Create(AssetManager& assets, DecodedAsset&& decoded);
+
+    /// Returns the size of the texture for the memory budget of AssetManager.
+    [[nodiscard]] static std::size_t GetByteSize(const Texture2D& texture);
 };
 
 } // namespace Pomdog::Detail
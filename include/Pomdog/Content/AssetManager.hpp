@@ -2,26 +2,65 @@
 
 #pragma once
 
+#include "Pomdog/Async/QueuedScheduler.hpp"
+#include "Pomdog/Async/Task.hpp"
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Content/AssetBuilders/Builder.hpp"
+#include "Pomdog/Content/AssetKey.hpp"
 #include "Pomdog/Content/AssetLoaders/AssetLoader.hpp"
 #include "Pomdog/Content/AssetLoaders/AudioClipLoader.hpp"
 #include "Pomdog/Content/AssetLoaders/Texture2DLoader.hpp"
+#include "Pomdog/Signals/Signal.hpp"
 #include "Pomdog/Utility/Any.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 #include "Pomdog/Utility/Errors.hpp"
+#include "Pomdog/Utility/MappedFile.hpp"
 #include "Pomdog/Utility/PathHelper.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace Pomdog {
-
+class AssetManager;
 class GraphicsDevice;
+} // namespace Pomdog
+
+namespace Pomdog::Detail {
+
+class AssetArchive;
+
+template <typename T, typename = void>
+struct HasAssetDecoder : std::false_type {
+};
+
+template <typename T>
+struct HasAssetDecoder<T, std::void_t<decltype(AssetLoader<T>::Decode(
+    std::declval<const AssetManager&>(), std::declval<const std::string&>()))>>
+    : std::true_type {
+};
+
+template <typename T, typename = void>
+struct HasAssetByteSize : std::false_type {
+};
+
+template <typename T>
+struct HasAssetByteSize<T, std::void_t<decltype(AssetLoader<T>::GetByteSize(std::declval<const T&>()))>>
+    : std::true_type {
+};
+
+} // namespace Pomdog::Detail
+
+namespace Pomdog {
 
 class POMDOG_EXPORT AssetManager final {
 public:
@@ -32,29 +71,39 @@ public:
     AssetManager(const AssetManager&) = delete;
     AssetManager& operator=(const AssetManager&) = delete;
 
+    ~AssetManager();
+
+    /// Interns the path to the asset so that it can be loaded repeatedly
+    /// without building and hashing the path.
+    ///
+    /// The key stays valid until this manager is destroyed, even if the asset
+    /// is unloaded or evicted.
+    [[nodiscard]] AssetKey MakeAssetKey(const std::string& assetName);
+
     /// Loads an asset stored at the specified path in a content directory.
     template <typename T>
     [[nodiscard]] std::tuple<std::shared_ptr<T>, std::shared_ptr<Error>>
     Load(const std::string& assetName)
     {
-        static_assert(std::is_object<T>::value, "");
-
-        const std::type_index typeIndex = typeid(std::shared_ptr<T>);
-
-        const auto filePath = GetAssetPath(assetName);
-
-        auto key = PathHelper::ToSlash(filePath);
-        if (auto iter = assets.find(key); iter != std::end(assets)) {
-            auto& assetHolder = iter->second;
+        return Load<T>(MakeAssetKey(assetName));
+    }
 
-            if (assetHolder.Type() == typeIndex) {
-                auto asset = assetHolder.As<std::shared_ptr<T>>();
-                return std::make_tuple(std::move(asset), nullptr);
-            }
+    /// Loads an asset identified by a key that MakeAssetKey() returned.
+    /// If the asset is already loaded, this does not allocate.
+    template <typename T>
+    [[nodiscard]] std::tuple<std::shared_ptr<T>, std::shared_ptr<Error>>
+    Load(const AssetKey& key)
+    {
+        static_assert(std::is_object<T>::value, "");
+        POMDOG_ASSERT(key.index < assets.size());
 
-            assets.erase(iter);
+        if (auto asset = FindAsset<T>(key.index); asset != nullptr) {
+            return std::make_tuple(std::move(asset), nullptr);
         }
 
+        // NOTE: The path is copied because loaders can intern other assets.
+        const auto filePath = keyFilePaths[key.index];
+
         Detail::AssetLoader<T> loader;
         auto [asset, err] = loader(*this, filePath);
         if (err != nullptr) {
@@ -63,14 +112,115 @@ public:
 
         static_assert(std::is_same<decltype(asset), std::shared_ptr<T>>::value);
 
-        Any assetHolder = asset;
-        POMDOG_ASSERT(assetHolder.Type() == typeIndex);
-
-        assets.emplace(std::move(key), std::move(assetHolder));
+        StoreAsset<T>(key.index, asset);
 
         return std::make_tuple(std::move(asset), nullptr);
     }
 
+    /// Loads an asset stored at the specified path in a content directory
+    /// without blocking the calling thread.
+    ///
+    /// The file is read and decoded on a worker thread, and the graphics
+    /// resources are created by Update() on the calling thread. Requests for
+    /// an asset that is still being loaded share the same task. Loaders that
+    /// do not provide a decoding stage run entirely in Update().
+    template <typename T>
+    [[nodiscard]] Concurrency::Task<std::shared_ptr<T>>
+    LoadAsync(const std::string& assetName)
+    {
+        return LoadAsync<T>(MakeAssetKey(assetName));
+    }
+
+    /// Loads an asset identified by a key that MakeAssetKey() returned
+    /// without blocking the calling thread.
+    template <typename T>
+    [[nodiscard]] Concurrency::Task<std::shared_ptr<T>>
+    LoadAsync(const AssetKey& key)
+    {
+        static_assert(std::is_object<T>::value, "");
+        POMDOG_ASSERT(key.index < assets.size());
+
+        using TaskType = Concurrency::Task<std::shared_ptr<T>>;
+
+        const auto index = key.index;
+        if (auto asset = FindAsset<T>(index); asset != nullptr) {
+            return Concurrency::FromResult(std::move(asset));
+        }
+
+        if (auto iter = pendingLoads.find(index); iter != std::end(pendingLoads)) {
+            if (iter->second.Is<TaskType>()) {
+                return iter->second.As<TaskType>();
+            }
+        }
+
+        Concurrency::TaskCompletionSource<std::shared_ptr<T>> tcs;
+        TaskType task(tcs);
+        pendingLoads.insert_or_assign(index, Any{TaskType{task}});
+
+        // NOTE: This is called on the thread that calls Update().
+        auto complete = [this, index, tcs](std::shared_ptr<T>&& asset, std::shared_ptr<Error>&& err) {
+            if (auto iter = pendingLoads.find(index); iter != std::end(pendingLoads)) {
+                if (iter->second.Is<TaskType>()) {
+                    pendingLoads.erase(iter);
+                }
+            }
+
+            if (err != nullptr) {
+                tcs.SetException(std::make_exception_ptr(std::runtime_error(err->ToString())));
+                return;
+            }
+
+            StoreAsset<T>(index, asset);
+            tcs.SetResult(asset);
+        };
+
+        const auto filePath = keyFilePaths[index];
+
+        if constexpr (Detail::HasAssetDecoder<T>::value) {
+            ScheduleDecoding([this, filePath, complete = std::move(complete)] {
+                using DecodeResult = decltype(Detail::AssetLoader<T>::Decode(*this, filePath));
+
+                // NOTE: std::function requires a copyable callable, so the
+                // decoded data is shared instead of being copied.
+                auto decoded = std::make_shared<DecodeResult>(Detail::AssetLoader<T>::Decode(*this, filePath));
+
+                creationQueue.Schedule([this, decoded = std::move(decoded), complete] {
+                    auto& [decodedAsset, decodeErr] = *decoded;
+                    if (decodeErr != nullptr) {
+                        complete(nullptr, std::move(decodeErr));
+                        return;
+                    }
+                    auto [asset, err] = Detail::AssetLoader<T>::Create(*this, std::move(decodedAsset));
+                    complete(std::move(asset), std::move(err));
+                });
+            });
+        }
+        else {
+            creationQueue.Schedule([this, filePath, complete = std::move(complete)] {
+                Detail::AssetLoader<T> loader;
+                auto [asset, err] = loader(*this, filePath);
+                complete(std::move(asset), std::move(err));
+            });
+        }
+
+        return task;
+    }
+
+    /// Completes the asynchronous loads whose decoding has finished.
+    /// This must be called on the thread that owns the graphics device,
+    /// e.g. once per frame.
+    void Update();
+
+    /// Calls `func(index)` for each index in [0, count) on the worker threads
+    /// that decode the assets of LoadAsync() and on the calling thread, and
+    /// returns after all calls have finished. This is meant for decoding a
+    /// batch of images or other heavy work that can run in parallel.
+    ///
+    /// This must be called on the thread that calls LoadAsync(), or from the
+    /// decoding stage of a loader. `func` must be safe to call from multiple
+    /// threads at once and must not throw exceptions.
+    void ParallelFor(std::size_t count, const std::function<void(std::size_t)>& func);
+
     /// Creates an asset builder.
     template <typename T, typename... Arguments>
     AssetBuilders::Builder<T> CreateBuilder(Arguments&&... arguments)
@@ -83,6 +233,44 @@ public:
     /// Disposes all loaded assets in this manager.
     void Unload();
 
+    /// Disposes the asset loaded from the specified path in a content
+    /// directory. The asset is destroyed when it is no longer referenced.
+    void Unload(const std::string& assetName);
+
+    /// Disposes the asset identified by the key. The key stays valid.
+    void Unload(const AssetKey& key);
+
+    /// Sets the budget for the memory that the loaded assets use, in bytes.
+    ///
+    /// When the memory usage exceeds the budget, the least recently used
+    /// assets that are not referenced outside this manager are disposed.
+    /// An asset is used when it is loaded or returned from the cache.
+    /// Assets that are still referenced are kept, so the usage can stay
+    /// above the budget until they are released. The budget is unlimited
+    /// by default.
+    void SetMemoryBudget(std::size_t budgetInBytes);
+
+    /// Gets the budget for the memory that the loaded assets use, in bytes.
+    [[nodiscard]] std::size_t GetMemoryBudget() const noexcept;
+
+    /// Gets the memory that the loaded assets use, in bytes.
+    ///
+    /// The size of an asset is reported by `AssetLoader<T>::GetByteSize()`.
+    /// Assets whose loader does not report the size are not accounted.
+    [[nodiscard]] std::size_t GetMemoryUsage() const noexcept;
+
+    /// Gets the memory that the loaded assets of type T use, in bytes.
+    template <typename T>
+    [[nodiscard]] std::size_t GetMemoryUsage() const noexcept
+    {
+        return GetMemoryUsage(typeid(T));
+    }
+
+    /// Disposes the least recently used assets that are not referenced
+    /// outside this manager until the memory usage fits in the budget.
+    /// This is called whenever an asset is loaded.
+    void EvictUnusedAssets();
+
     /// Gets the path to the asset directory.
     std::string GetContentDirectory() const;
 
@@ -95,10 +283,156 @@ public:
     /// Gets the full path to the asset.
     std::string GetAssetPath(const std::string& assetName) const;
 
+    /// Mounts an asset archive created by `tools/pack_assets`.
+    ///
+    /// Assets in the content directory are read from the mounted archives
+    /// if they contain them, and from the file system otherwise. Archives
+    /// mounted later take precedence. This must not be called while
+    /// asynchronous loads are in progress.
+    [[nodiscard]] std::shared_ptr<Error>
+    Mount(const std::string& archivePath);
+
+    /// Unmounts all asset archives. Loaded assets are not unloaded.
+    void UnmountAll();
+
+    /// Starts watching the content directory for modified files.
+    ///
+    /// The changes are applied by Update(), so an asset that is saved several
+    /// times within a frame is reloaded only once. Assets whose type is move
+    /// assignable, such as Texture2D, are reloaded in place, so the pointers
+    /// that Load() returned see the new contents. Other assets are unloaded
+    /// and are loaded again by the next Load(). If a modified file fails to
+    /// load, the asset keeps its previous contents.
+    /// Assets read from a mounted archive are never reloaded, because only
+    /// the files in the content directory are watched.
+    /// Hot reloading is supported on Linux only.
+    [[nodiscard]] std::shared_ptr<Error> EnableHotReload();
+
+    /// Stops watching the content directory.
+    void DisableHotReload();
+
+    /// Opens the file at the path returned by GetAssetPath() for reading.
+    /// Asset loaders read their files through this function so that they
+    /// work with mounted archives. It can be called from worker threads.
+    [[nodiscard]] std::tuple<MappedFile, std::shared_ptr<Error>>
+    OpenAssetFile(const std::string& filePath) const;
+
+    /// Signals that a file in the content directory was modified, after the
+    /// asset loaded from it was reloaded. Resources that this manager does
+    /// not cache, e.g. shaders created by builders, can be rebuilt here.
+    Signal<void(const std::string& filePath)> AssetFileChanged;
+
+private:
+    using ReloadFunction = std::tuple<std::size_t, std::shared_ptr<Error>> (*)(
+        AssetManager& assetManager, const std::string& filePath, void* asset);
+
+    struct AssetEntry final {
+        // NOTE: The cache holds the asset with the same control block as the
+        // callers, so the use count tells whether it is referenced outside.
+        // The entry is empty if the asset is not loaded.
+        std::shared_ptr<void> Asset;
+        std::type_index Type = typeid(void);
+        std::size_t ByteSize = 0;
+        std::uint64_t LastAccess = 0;
+
+        // NOTE: Null if the asset cannot be reloaded in place.
+        ReloadFunction Reload = nullptr;
+    };
+
+    template <typename T>
+    [[nodiscard]] std::shared_ptr<T> FindAsset(std::uint32_t index)
+    {
+        POMDOG_ASSERT(index < assets.size());
+        auto& entry = assets[index];
+        if ((entry.Asset == nullptr) || (entry.Type != std::type_index{typeid(T)})) {
+            return nullptr;
+        }
+
+        entry.LastAccess = ++accessCount;
+        return std::static_pointer_cast<T>(entry.Asset);
+    }
+
+    template <typename T>
+    void StoreAsset(std::uint32_t index, const std::shared_ptr<T>& asset)
+    {
+        POMDOG_ASSERT(asset != nullptr);
+
+        std::size_t byteSize = 0;
+        if constexpr (Detail::HasAssetByteSize<T>::value) {
+            byteSize = Detail::AssetLoader<T>::GetByteSize(*asset);
+        }
+
+        ReloadFunction reload = nullptr;
+        if constexpr (std::is_move_assignable<T>::value) {
+            reload = &ReloadAsset<T>;
+        }
+        StoreAsset(index, asset, typeid(T), byteSize, reload);
+    }
+
+    void StoreAsset(
+        std::uint32_t index,
+        const std::shared_ptr<void>& asset,
+        std::type_index type,
+        std::size_t byteSize,
+        ReloadFunction reload);
+
+    template <typename T>
+    [[nodiscard]] static std::tuple<std::size_t, std::shared_ptr<Error>>
+    ReloadAsset(AssetManager& assetManager, const std::string& filePath, void* asset)
+    {
+        POMDOG_ASSERT(asset != nullptr);
+
+        Detail::AssetLoader<T> loader;
+        auto [newAsset, err] = loader(assetManager, filePath);
+        if (err != nullptr) {
+            return std::make_tuple(0, std::move(err));
+        }
+        POMDOG_ASSERT(newAsset != nullptr);
+
+        // NOTE: The contents are moved into the cached object so that the
+        // pointers to it that have been handed out stay valid.
+        auto& target = *static_cast<T*>(asset);
+        target = std::move(*newAsset);
+
+        std::size_t byteSize = 0;
+        if constexpr (Detail::HasAssetByteSize<T>::value) {
+            byteSize = Detail::AssetLoader<T>::GetByteSize(target);
+        }
+        return std::make_tuple(byteSize, nullptr);
+    }
+
+    void ReloadChangedAssets();
+
+    [[nodiscard]] std::shared_ptr<Error> RefreshAsset(std::uint32_t index);
+
+    void EraseAsset(std::uint32_t index);
+
+    [[nodiscard]] std::size_t GetMemoryUsage(std::type_index type) const noexcept;
+
+    void ScheduleDecoding(std::function<void()>&& work);
+
 private:
+    class FileWatcher;
+    class WorkerPool;
+
     std::string contentDirectory;
     std::weak_ptr<GraphicsDevice> graphicsDevice;
-    std::unordered_map<std::string, Any> assets;
+    std::unordered_map<std::string, std::uint32_t> keyIndices;
+    std::vector<std::string> keyFilePaths;
+    std::vector<AssetEntry> assets;
+    std::unordered_map<std::type_index, std::size_t> memoryUsageByType;
+    std::unordered_map<std::uint32_t, Any> pendingLoads;
+    std::vector<std::shared_ptr<Detail::AssetArchive>> archives;
+    std::unique_ptr<FileWatcher> fileWatcher;
+    std::vector<std::string> changedFilePaths;
+    Concurrency::QueuedScheduler creationQueue;
+    std::size_t memoryUsage = 0;
+    std::size_t memoryBudget;
+    std::uint64_t accessCount = 0;
+
+    // NOTE: The workers are declared last so that they are joined before the
+    // queue that they schedule the creation of assets to is destroyed.
+    std::unique_ptr<WorkerPool> workerPool;
 };
 
 } // namespace Pomdog
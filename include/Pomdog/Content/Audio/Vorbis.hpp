@@ -5,8 +5,11 @@
 #include "Pomdog/Audio/detail/ForwardDeclarations.hpp"
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Utility/Errors.hpp"
+#include "Pomdog/Utility/MappedFile.hpp"
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -17,4 +20,24 @@ namespace Pomdog::Vorbis {
 std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
 Load(const std::string& filename);
 
+/// Reads a Ogg/Vorbis (.ogg) audio data from memory.
+[[nodiscard]] POMDOG_EXPORT
+std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
+Load(const std::uint8_t* data, std::size_t byteLength);
+
+/// Opens a Ogg/Vorbis (.ogg) file for streaming playback.
+///
+/// Only the headers are read here. The audio is decoded while it is played
+/// by StreamingAudioSource, so opening a long audio file is fast.
+[[nodiscard]] POMDOG_EXPORT
+std::tuple<std::unique_ptr<AudioStream>, std::shared_ptr<Error>>
+OpenStream(const std::string& filename);
+
+/// Opens a Ogg/Vorbis (.ogg) audio data for streaming playback.
+/// The stream takes the ownership of the file, e.g. one that
+/// AssetManager::OpenAssetFile() returns.
+[[nodiscard]] POMDOG_EXPORT
+std::tuple<std::unique_ptr<AudioStream>, std::shared_ptr<Error>>
+OpenStream(MappedFile&& file);
+
 } // namespace Pomdog::Vorbis
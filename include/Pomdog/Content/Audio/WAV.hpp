@@ -6,6 +6,7 @@
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Utility/Errors.hpp"
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <memory>
 #include <tuple>
@@ -18,4 +19,9 @@ namespace Pomdog::WAV {
 std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
 Load(std::ifstream&& stream, std::size_t byteLength);
 
+/// Reads an audio data from Waveform Audio File (.wav) format data in memory.
+[[nodiscard]] POMDOG_EXPORT
+std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
+Load(const std::uint8_t* data, std::size_t byteLength);
+
 } // namespace Pomdog::WAV
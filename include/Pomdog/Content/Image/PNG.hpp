@@ -9,6 +9,11 @@
 #include <cstdint>
 #include <memory>
 #include <tuple>
+#include <vector>
+
+namespace Pomdog {
+class AssetManager;
+} // namespace Pomdog
 
 namespace Pomdog::PNG {
 
@@ -17,4 +22,12 @@ namespace Pomdog::PNG {
 std::tuple<ImageBuffer, std::shared_ptr<Error>>
 Decode(const std::uint8_t* data, std::size_t size);
 
+/// Reads PNG images from data (.png) concurrently on the worker threads of
+/// the asset manager. The results are in the same order as the sources.
+[[nodiscard]] POMDOG_EXPORT
+std::vector<std::tuple<ImageBuffer, std::shared_ptr<Error>>>
+DecodeBatch(
+    AssetManager& assets,
+    const std::vector<std::tuple<const std::uint8_t*, std::size_t>>& sources);
+
 } // namespace Pomdog::PNG
@@ -0,0 +1,38 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Basic/Export.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Pomdog::PixelConversion {
+
+/// Multiplies the color channels by alpha in place.
+/// The pixels are in R8G8B8A8_UNorm or B8G8R8A8_UNorm format.
+POMDOG_EXPORT
+void PremultiplyAlpha(std::uint8_t* pixels, std::size_t pixelCount) noexcept;
+
+/// Swaps the red and blue channels in place, which converts
+/// R8G8B8A8_UNorm pixels to B8G8R8A8_UNorm and vice versa.
+POMDOG_EXPORT
+void SwapRedBlue(std::uint8_t* pixels, std::size_t pixelCount) noexcept;
+
+/// Converts A8_UNorm pixels to white R8G8B8A8_UNorm pixels with the same alpha.
+POMDOG_EXPORT
+void ConvertA8ToR8G8B8A8(
+    const std::uint8_t* source,
+    std::uint8_t* destination,
+    std::size_t pixelCount) noexcept;
+
+/// Sets the color channels to the given color in place, keeping the alpha channel.
+/// The pixels are in R8G8B8A8_UNorm format.
+POMDOG_EXPORT
+void FillColorChannels(
+    std::uint8_t* pixels,
+    std::size_t pixelCount,
+    std::uint8_t red,
+    std::uint8_t green,
+    std::uint8_t blue) noexcept;
+
+} // namespace Pomdog::PixelConversion
@@ -0,0 +1,145 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Basic/Export.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include "Pomdog/Utility/Errors.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+
+namespace Pomdog::Detail {
+
+// NOTE: A cooked data file is a flat binary form of a data asset (such as a
+// Spine skeleton or a particle clip) which is created by `tools/cook_data`.
+// All values are little-endian.
+//
+//   CookedDataHeader
+//   CookedDataSection[SectionCount]
+//   contents of the sections  (each aligned to 8 bytes)
+//
+// Each section is an array of POD records. The first section holds the
+// characters of the strings, which are referenced by CookedString.
+// Records refer to ranges of other sections with CookedSpan.
+
+struct CookedDataHeader final {
+    std::uint32_t Signature;
+    std::uint32_t Version;
+    std::uint32_t SectionCount;
+    std::uint32_t Reserved;
+};
+
+struct CookedDataSection final {
+    /// The offset in bytes from the beginning of the file.
+    std::uint32_t Offset;
+
+    /// The size in bytes.
+    std::uint32_t Size;
+};
+
+struct CookedString final {
+    std::uint32_t Offset;
+    std::uint32_t Length;
+};
+
+struct CookedSpan final {
+    /// The index of the first record in the section.
+    std::uint32_t First;
+    std::uint32_t Count;
+};
+
+static_assert(sizeof(CookedDataHeader) == 16);
+static_assert(sizeof(CookedDataSection) == 8);
+static_assert(sizeof(CookedString) == 8);
+static_assert(sizeof(CookedSpan) == 8);
+
+template <typename T>
+class CookedArray final {
+public:
+    const T* Data = nullptr;
+    std::uint32_t Count = 0;
+
+    [[nodiscard]] const T* begin() const noexcept { return Data; }
+    [[nodiscard]] const T* end() const noexcept { return Data + Count; }
+    [[nodiscard]] std::uint32_t size() const noexcept { return Count; }
+
+    [[nodiscard]] const T& operator[](std::uint32_t index) const noexcept
+    {
+        POMDOG_ASSERT(index < Count);
+        return Data[index];
+    }
+};
+
+/// CookedDataReader reads the records of a cooked data file in place.
+///
+/// The header and the section table are validated by Open(). The references
+/// between records are checked when they are followed, and an invalid one
+/// makes the reader invalid instead of failing each call, so that a loader
+/// checks IsValid() once after reading all the records.
+class POMDOG_EXPORT CookedDataReader final {
+public:
+    /// Returns true if the data starts with the signature.
+    [[nodiscard]] static bool
+    HasSignature(const std::uint8_t* data, std::size_t size, std::uint32_t signature) noexcept;
+
+    /// Validates the header and the section table.
+    [[nodiscard]] std::shared_ptr<Error>
+    Open(
+        const std::uint8_t* data,
+        std::size_t size,
+        std::uint32_t signature,
+        std::uint32_t version,
+        std::uint32_t sectionCount);
+
+    /// Returns the records of the section.
+    template <typename T>
+    [[nodiscard]] CookedArray<T> GetSection(std::uint32_t sectionIndex) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        static_assert(alignof(T) <= 8);
+        POMDOG_ASSERT(sectionIndex < sectionCount);
+
+        const auto& section = sections[sectionIndex];
+        if ((section.Size % sizeof(T)) != 0) {
+            valid = false;
+            return {};
+        }
+
+        CookedArray<T> result;
+        result.Data = reinterpret_cast<const T*>(data + section.Offset);
+        result.Count = static_cast<std::uint32_t>(section.Size / sizeof(T));
+        return result;
+    }
+
+    /// Returns the records of `array` in the span.
+    template <typename T>
+    [[nodiscard]] CookedArray<T> Slice(const CookedArray<T>& array, const CookedSpan& span) noexcept
+    {
+        if ((span.First > array.Count) || (span.Count > array.Count - span.First)) {
+            valid = false;
+            return {};
+        }
+
+        CookedArray<T> result;
+        result.Data = array.Data + span.First;
+        result.Count = span.Count;
+        return result;
+    }
+
+    /// Returns the string, which is not null-terminated.
+    [[nodiscard]] std::string_view GetString(const CookedString& s) noexcept;
+
+    /// Returns false if any of the references that have been followed is invalid.
+    [[nodiscard]] bool IsValid() const noexcept;
+
+private:
+    const std::uint8_t* data = nullptr;
+    const CookedDataSection* sections = nullptr;
+    std::uint32_t sectionCount = 0;
+    bool valid = false;
+};
+
+} // namespace Pomdog::Detail
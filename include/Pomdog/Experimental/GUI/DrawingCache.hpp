@@ -0,0 +1,59 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Experimental/Graphics/PolygonShapeBuilder.hpp"
+#include "Pomdog/Experimental/Graphics/SpriteBatch.hpp"
+#include "Pomdog/Experimental/Graphics/Texture2DView.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Pomdog::GUI {
+
+enum class DrawingCommandType : std::uint8_t {
+    /// Draws `Count` vertices of DrawingCache::Vertices from `StartIndex`.
+    Primitives,
+
+    /// Draws `Count` sprites of DrawingCache::Sprites from `StartIndex`.
+    Sprites,
+
+    /// Sets the scissor rectangle.
+    ScissorRect,
+};
+
+struct DrawingCommand final {
+    Texture2DView Texture;
+    Rectangle ScissorRect;
+    std::size_t StartIndex = 0;
+    std::size_t Count = 0;
+    DrawingCommandType Type = DrawingCommandType::Primitives;
+};
+
+/// DrawingCache holds the draw calls that a DrawingContext submitted while
+/// recording, in submission order, so that the same frame can be drawn again
+/// without drawing the widgets.
+class DrawingCache final {
+public:
+    std::vector<DrawingCommand> Commands;
+    std::vector<PrimitiveBatchVertex> Vertices;
+    std::vector<SpriteDesc> Sprites;
+
+    /// The viewport size of the DrawingContext when the cache was recorded.
+    int ViewportWidth = 0;
+    int ViewportHeight = 0;
+
+    /// True if the cache holds a complete recording.
+    bool IsValid = false;
+
+    void Clear()
+    {
+        Commands.clear();
+        Vertices.clear();
+        Sprites.clear();
+        IsValid = false;
+    }
+};
+
+} // namespace Pomdog::GUI
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Pomdog/Experimental/GUI/DrawingCache.hpp"
 #include "Pomdog/Experimental/GUI/FontSize.hpp"
 #include "Pomdog/Experimental/GUI/FontWeight.hpp"
 #include "Pomdog/Experimental/Graphics/PrimitiveBatch.hpp"
@@ -105,6 +106,20 @@ public:
 
     void EndDraw();
 
+    /// Starts recording the draw calls submitted between BeginDraw() and
+    /// EndDraw() into `cache`. They are submitted as usual while recording.
+    void BeginRecording(DrawingCache& cache);
+
+    void EndRecording();
+
+    /// Returns true if `cache` can be replayed instead of drawing again,
+    /// i.e. it was recorded at the current viewport size and no font has
+    /// glyphs that were still being rasterized.
+    bool CanReplay(const DrawingCache& cache) const;
+
+    /// Submits the draw calls recorded in `cache`.
+    void Replay(const DrawingCache& cache);
+
     std::shared_ptr<SpriteFont>
     GetFont(FontWeight fontWeight, FontSize fontSize) const;
 
@@ -121,6 +136,9 @@ public:
         const Vector2& originPivot,
         float scale);
 
+private:
+    void SetScissorRect(const Rectangle& scissorRect);
+
 private:
     std::unordered_map<std::uint32_t, std::shared_ptr<SpriteFont>> spriteFonts;
 
@@ -134,6 +152,7 @@ private:
     std::shared_ptr<PrimitiveBatch> primitiveBatch;
     std::vector<Point2D> matrixStack;
     std::vector<Rectangle> scissorRects;
+    DrawingCache* recordingCache;
     int viewportWidth;
     int viewportHeight;
 };
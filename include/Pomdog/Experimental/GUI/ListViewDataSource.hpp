@@ -0,0 +1,32 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include <memory>
+
+namespace Pomdog::GUI {
+
+class UIEventDispatcher;
+class Widget;
+
+/// ListViewDataSource provides the items of a VirtualizedListView on demand.
+/// A tree can be listed by returning its expanded nodes in display order and
+/// indenting the item widgets by depth.
+class ListViewDataSource {
+public:
+    virtual ~ListViewDataSource() = default;
+
+    /// Returns the number of items.
+    virtual int GetItemCount() = 0;
+
+    /// Creates a widget that can display any item. Item widgets are recycled,
+    /// so this is only called until there are enough widgets to fill the view.
+    virtual std::shared_ptr<Widget>
+    CreateItemWidget(const std::shared_ptr<UIEventDispatcher>& dispatcher) = 0;
+
+    /// Updates `widget`, which was created by CreateItemWidget(), to display
+    /// the item at `index`.
+    virtual void BindItemWidget(int index, const std::shared_ptr<Widget>& widget) = 0;
+};
+
+} // namespace Pomdog::GUI
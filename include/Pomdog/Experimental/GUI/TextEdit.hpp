@@ -13,6 +13,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace Pomdog {
 class SpriteFont;
@@ -99,11 +100,25 @@ public:
     Signal<void()> FocusOut;
 
 private:
+    /// Marks the caret offsets from `position` onward as out of date.
+    void InvalidateCaretOffsets(int position);
+
+    /// Returns the horizontal offset of the caret in front of `text[position]`.
+    float GetCaretOffset(int position);
+
+    /// Returns the caret position closest to the left of `offsetX`.
+    int FindCaretPosition(float offsetX);
+
     std::shared_ptr<SpriteFont> spriteFont;
     ScopedConnection connection;
     ScopedConnection keyboardConn;
     std::string text;
     std::string placeholderText;
+
+    // NOTE: caretOffsets[i] is the pen position in front of text[i], and the
+    // first validCaretOffsetCount elements are up to date.
+    std::vector<float> caretOffsets;
+    std::size_t validCaretOffsetCount;
     Thickness textMargin;
     Duration cursorBlinkInterval;
     Duration cursorMoveInterval;
@@ -9,6 +9,19 @@ struct Thickness final {
     int Right;
     int Bottom;
     int Left;
+
+    [[nodiscard]] constexpr bool operator==(const Thickness& other) const noexcept
+    {
+        return (Top == other.Top) &&
+            (Right == other.Right) &&
+            (Bottom == other.Bottom) &&
+            (Left == other.Left);
+    }
+
+    [[nodiscard]] constexpr bool operator!=(const Thickness& other) const noexcept
+    {
+        return !(*this == other);
+    }
 };
 
 } // namespace Pomdog::GUI
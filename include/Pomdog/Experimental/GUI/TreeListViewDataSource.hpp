@@ -0,0 +1,91 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Experimental/GUI/ListViewDataSource.hpp"
+#include "Pomdog/Signals/ScopedConnection.hpp"
+#include "Pomdog/Signals/Signal.hpp"
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Pomdog::GUI {
+
+class TreeViewItem;
+
+/// TreeListViewDataSource lists a tree in a VirtualizedListView. The items
+/// are the nodes whose ancestors are all expanded, in depth-first order, and
+/// each of them is displayed by a TreeViewItem indented by its depth.
+///
+/// Expanding or collapsing a node changes the items and raises ItemsChanged,
+/// which should reload the list view:
+/// @code
+/// dataSource->ItemsChanged.Connect([weakListView] {
+///     if (auto listView = weakListView.lock(); listView != nullptr) {
+///         listView->ReloadData();
+///     }
+/// });
+/// @endcode
+class TreeListViewDataSource : public ListViewDataSource {
+public:
+    TreeListViewDataSource();
+
+    /// Adds a collapsed node as the last child of `parent`, or as the last
+    /// root node if `parent` is std::nullopt, and returns the new node.
+    int AddNode(std::optional<int> parent, const std::string& text);
+
+    /// Removes all nodes.
+    void Clear();
+
+    int GetNodeCount() const noexcept;
+
+    std::optional<int> GetParent(int node) const;
+
+    int GetDepth(int node) const;
+
+    bool HasChildren(int node) const;
+
+    bool IsExpanded(int node) const;
+
+    void SetExpanded(int node, bool expanded);
+
+    /// Returns the node displayed as the item at `index`.
+    int GetNodeAt(int index);
+
+    int GetItemCount() override;
+
+    std::shared_ptr<Widget>
+    CreateItemWidget(const std::shared_ptr<UIEventDispatcher>& dispatcher) override;
+
+    void BindItemWidget(int index, const std::shared_ptr<Widget>& widget) override;
+
+    /// Raised when nodes are added, removed, expanded or collapsed.
+    Signal<void()> ItemsChanged;
+
+private:
+    void UpdateItems();
+
+private:
+    struct Node final {
+        std::string text;
+        std::vector<int> children;
+        std::optional<int> parent;
+        int depth = 0;
+        bool expanded = false;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<int> rootNodes;
+
+    // NOTE: The nodes of the items in display order.
+    std::vector<int> items;
+
+    // NOTE: The node that each item widget is bound to, so that toggling
+    // the disclosure triangle of a recycled widget expands the right node.
+    std::unordered_map<const TreeViewItem*, int> boundNodes;
+    std::vector<ScopedConnection> connections;
+    bool needToUpdateItems;
+};
+
+} // namespace Pomdog::GUI
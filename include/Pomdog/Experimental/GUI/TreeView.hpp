@@ -2,15 +2,16 @@
 
 #pragma once
 
-#include "Pomdog/Experimental/GUI/DisclosureTriangleButton.hpp"
-#include "Pomdog/Experimental/GUI/HorizontalLayout.hpp"
-#include "Pomdog/Experimental/GUI/TextBlock.hpp"
+#include "Pomdog/Experimental/GUI/TreeViewItem.hpp"
 #include "Pomdog/Experimental/GUI/VerticalLayout.hpp"
 #include "Pomdog/Experimental/GUI/Widget.hpp"
 #include "Pomdog/Signals/ScopedConnection.hpp"
 
 namespace Pomdog::GUI {
 
+/// TreeView is a collapsible section of arbitrary child widgets, all of which
+/// are kept alive. Use a VirtualizedListView with a TreeListViewDataSource
+/// to list a large tree whose rows share the same kind of widget.
 class TreeView final
     : public Widget
     , public std::enable_shared_from_this<TreeView> {
@@ -48,9 +49,7 @@ private:
     void UpdateLayout();
 
 private:
-    std::shared_ptr<HorizontalLayout> horizontalLayout;
-    std::shared_ptr<DisclosureTriangleButton> disclosureTriangleButton;
-    std::shared_ptr<TextBlock> textBlock;
+    std::shared_ptr<TreeViewItem> header;
     std::shared_ptr<VerticalLayout> verticalLayout;
     ScopedConnection connection;
     int layoutSpacing;
@@ -0,0 +1,69 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Experimental/GUI/Widget.hpp"
+#include "Pomdog/Signals/ScopedConnection.hpp"
+#include "Pomdog/Signals/Signal.hpp"
+#include <string>
+
+namespace Pomdog::GUI {
+
+class DisclosureTriangleButton;
+class TextBlock;
+
+/// TreeViewItem is the row of a tree node, a disclosure triangle followed by
+/// the text of the node. It is the header of TreeView and the item widget of
+/// TreeListViewDataSource.
+class TreeViewItem final
+    : public Widget
+    , public std::enable_shared_from_this<TreeViewItem> {
+public:
+    explicit TreeViewItem(const std::shared_ptr<UIEventDispatcher>& dispatcher);
+
+    void SetText(const std::string& text);
+
+    bool IsExpanded() const;
+
+    /// Sets the state of the disclosure triangle without raising Toggled.
+    void SetExpanded(bool expanded);
+
+    /// Sets whether the disclosure triangle is shown, i.e. the node has children.
+    void SetExpandable(bool expandable);
+
+    /// Sets the offset of the disclosure triangle from the left edge.
+    void SetIndentation(int indentation);
+
+    HorizontalAlignment GetHorizontalAlignment() const noexcept override;
+    VerticalAlignment GetVerticalAlignment() const noexcept override;
+
+    void OnEnter() override;
+
+    void SetPosition(const Point2D& position) override;
+
+    void MarkParentTransformDirty() override;
+
+    void MarkContentLayoutDirty() override;
+
+    std::shared_ptr<Widget> GetChildAt(const Point2D& position) override;
+
+    void UpdateAnimation(const Duration& frameDuration) override;
+
+    void DoLayout() override;
+
+    void Draw(DrawingContext& drawingContext) override;
+
+    Signal<void(bool isExpanded)> Toggled;
+
+private:
+    void UpdateLayout();
+
+private:
+    std::shared_ptr<DisclosureTriangleButton> disclosureTriangleButton;
+    std::shared_ptr<TextBlock> textBlock;
+    ScopedConnection connection;
+    int indentation;
+    bool needToUpdateLayout;
+};
+
+} // namespace Pomdog::GUI
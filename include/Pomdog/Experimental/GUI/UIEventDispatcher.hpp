@@ -35,6 +35,23 @@ public:
 
     void ClearFocus(const std::shared_ptr<Widget>& widget);
 
+    /// Marks that the widgets need to be drawn again instead of reusing
+    /// the output of the previous frame.
+    void MarkRenderDirty() noexcept
+    {
+        isRenderDirty = true;
+    }
+
+    bool IsRenderDirty() const noexcept
+    {
+        return isRenderDirty;
+    }
+
+    void ClearRenderDirty() noexcept
+    {
+        isRenderDirty = false;
+    }
+
     std::function<void(const std::shared_ptr<Widget>& widget)> AddContextMenu;
 
     std::function<void(const std::shared_ptr<Widget>& widget)> RemoveContextMenu;
@@ -77,6 +94,7 @@ private:
     ScopedConnection keyDownConn;
     ScopedConnection keyUpConn;
     ScopedConnection textInputConn;
+    bool isRenderDirty = true;
 };
 
 } // namespace Pomdog::GUI
@@ -0,0 +1,96 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Experimental/GUI/Thickness.hpp"
+#include "Pomdog/Experimental/GUI/Widget.hpp"
+#include "Pomdog/Signals/Signal.hpp"
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Pomdog::GUI {
+
+class ListViewDataSource;
+class ListViewItem;
+
+/// VirtualizedListView is a list view whose items are provided by a
+/// ListViewDataSource. Only the items within the bounds of the parent widget,
+/// e.g. a ScrollView, have widgets, which are recycled as the view scrolls.
+/// All items have the same height.
+class VirtualizedListView final
+    : public Widget
+    , public std::enable_shared_from_this<VirtualizedListView> {
+public:
+    VirtualizedListView(
+        const std::shared_ptr<UIEventDispatcher>& dispatcher,
+        int widthIn,
+        int itemHeightIn);
+
+    void SetDataSource(const std::shared_ptr<ListViewDataSource>& dataSource);
+
+    /// Discards the item widgets and binds them again, e.g. after the items
+    /// of the data source have changed.
+    void ReloadData();
+
+    int GetItemHeight() const noexcept;
+
+    void SetItemHeight(int itemHeight);
+
+    void SetPadding(const Thickness& padding);
+
+    int GetItemCount() const noexcept;
+
+    std::optional<int> GetCurrentIndex() const noexcept;
+
+    /// Selects the item at `index`, or clears the selection if `index` is out
+    /// of range. CurrentIndexChanged is raised only if the selection changes.
+    void SetCurrentIndex(int index);
+
+    void SetPosition(const Point2D& position) override;
+
+    void MarkParentTransformDirty() override;
+
+    void MarkContentLayoutDirty() override;
+
+    bool GetSizeToFitContent() const noexcept override;
+
+    std::shared_ptr<Widget> GetChildAt(const Point2D& position) override;
+
+    void UpdateAnimation(const Duration& frameDuration) override;
+
+    void DoLayout() override;
+
+    void Draw(DrawingContext& drawingContext) override;
+
+    Signal<void(std::optional<int> index)> CurrentIndexChanged;
+
+private:
+    void UpdateLayout();
+
+    void RealizeItems(int firstIndex, int lastIndex);
+
+    void RecycleItem(std::shared_ptr<ListViewItem>&& item);
+
+    std::shared_ptr<ListViewItem> DequeueItem();
+
+    int GetItemY(int index) const noexcept;
+
+private:
+    std::shared_ptr<ListViewDataSource> dataSource;
+
+    // NOTE: The widgets of the items from `firstRealizedIndex` in order.
+    std::deque<std::shared_ptr<ListViewItem>> realizedItems;
+    std::vector<std::shared_ptr<ListViewItem>> recycledItems;
+
+    Thickness padding;
+    std::optional<int> currentIndex;
+    int itemCount;
+    int itemHeight;
+    int firstRealizedIndex;
+    bool needToUpdateLayout;
+    bool needToRebind;
+};
+
+} // namespace Pomdog::GUI
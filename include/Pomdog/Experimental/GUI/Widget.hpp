@@ -67,10 +67,26 @@ public:
 
     virtual void MarkContentLayoutDirty();
 
+    /// Requests the hierarchy to draw the widgets again on the next frame.
+    /// Call this when the appearance of the widget changes without input,
+    /// e.g. from UpdateAnimation() or a setter.
+    void MarkRenderDirty() noexcept;
+
     virtual std::shared_ptr<Widget> GetChildAt(const Point2D& position);
 
     virtual void DoLayout();
 
+    /// Returns true if this widget or any of its descendants needs to be laid out.
+    bool IsLayoutDirty() const noexcept;
+
+    /// Marks this widget and its ancestors as needing to be laid out.
+    void MarkLayoutDirty() noexcept;
+
+    /// Calls DoLayout() only if the widget or any of its descendants has been
+    /// marked as dirty since it was last laid out. Containers use this to lay
+    /// out their children so that a layout pass visits the dirty subtrees only.
+    void DoLayoutIfNeeded();
+
     virtual bool GetSizeToFitContent() const noexcept;
     virtual HorizontalAlignment GetHorizontalAlignment() const noexcept;
     virtual VerticalAlignment GetVerticalAlignment() const noexcept;
@@ -123,6 +139,7 @@ private:
     std::optional<MouseCursor> cursor;
     HierarchySortOrder hierarchySortOrder;
     bool isParentTransformDirty;
+    bool isLayoutDirty;
     bool isVisible;
     bool isInteractable;
     bool isWheelFocusEnabled;
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Pomdog/Experimental/GUI/DrawingCache.hpp"
 #include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
 #include "Pomdog/Experimental/GUI/Widget.hpp"
 #include "Pomdog/Signals/ScopedConnection.hpp"
@@ -38,12 +39,29 @@ public:
 
     std::shared_ptr<UIEventDispatcher> GetDispatcher() const;
 
+    /// Sets whether Draw() replays the draw calls of the previous frame
+    /// instead of drawing the widgets while none of them is marked dirty.
+    /// Widgets whose appearance is changed by the application must call
+    /// Widget::MarkRenderDirty() unless it goes through their setters.
+    void SetRetainedRenderingEnabled(bool enabled) noexcept;
+
+    bool IsRetainedRenderingEnabled() const noexcept;
+
+private:
+    void UpdateLayout();
+
+    void DrawChildren(DrawingContext& drawingContext);
+
 private:
     std::vector<std::shared_ptr<Widget>> subscribeRequests;
     std::vector<std::shared_ptr<Widget>> children;
     std::shared_ptr<UIEventDispatcher> dispatcher;
+    std::weak_ptr<Widget> sortedFocusRoot;
+    DrawingCache drawingCache;
     ScopedConnection connection;
     int viewportHeight;
+    bool needToSort;
+    bool isRetainedRenderingEnabled;
 };
 
 } // namespace Pomdog::GUI
@@ -35,4 +35,15 @@ struct FontGlyph final {
     std::int16_t TexturePage;
 };
 
+/// FontKerning is the adjustment of the advance between a pair of characters.
+struct FontKerning final {
+    // NOTE: UCS-4/UTF-32
+    char32_t First;
+    char32_t Second;
+
+    /// The amount in pixels added to the advance of `First` when it is
+    /// followed by `Second`.
+    std::int16_t Amount;
+};
+
 } // namespace Pomdog
@@ -0,0 +1,89 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Basic/Export.hpp"
+#include "Pomdog/Graphics/detail/ForwardDeclarations.hpp"
+#include "Pomdog/Math/detail/ForwardDeclarations.hpp"
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace Pomdog {
+
+class AssetManager;
+
+/// InstancedPrimitiveBatch draws 2D shapes as instances of shared unit meshes.
+/// Unlike PrimitiveBatch, each shape is uploaded as a single 48-byte instance
+/// record and the vertex shader expands it, so the CPU cost does not depend
+/// on the number of vertices of the shape.
+class POMDOG_EXPORT InstancedPrimitiveBatch final {
+public:
+    InstancedPrimitiveBatch(
+        const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+        AssetManager& assets);
+
+    /// Creates a batch that can submit up to `maxInstanceCount` instances
+    /// in a single flush.
+    InstancedPrimitiveBatch(
+        const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+        std::optional<DepthStencilDescription>&& depthStencilDesc,
+        std::optional<RasterizerDescription>&& rasterizerDesc,
+        std::size_t maxInstanceCount,
+        AssetManager& assets);
+
+    ~InstancedPrimitiveBatch();
+
+    void Begin(
+        const std::shared_ptr<GraphicsCommandList>& commandList,
+        const Matrix4x4& transformMatrix);
+
+    void DrawCircle(
+        const Vector2& position,
+        float radius,
+        const Color& color);
+
+    void DrawEllipse(
+        const Vector2& position,
+        float radiusX,
+        float radiusY,
+        const Color& color);
+
+    void DrawRectangle(
+        const Rectangle& sourceRect,
+        const Color& color);
+
+    void DrawRectangle(
+        const Matrix3x2& matrix,
+        const Vector2& position,
+        float width,
+        float height,
+        const Color& color);
+
+    void DrawRectangle(
+        const Vector2& position,
+        float width,
+        float height,
+        const Vector2& originPivot,
+        const Color& color);
+
+    void DrawTriangle(
+        const Vector2& point1,
+        const Vector2& point2,
+        const Vector2& point3,
+        const Color& color);
+
+    void Flush();
+
+    void End();
+
+    std::size_t GetMaxInstanceCount() const noexcept;
+
+    int GetDrawCallCount() const noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace Pomdog
@@ -0,0 +1,61 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Basic/Export.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Pomdog {
+struct FontKerning;
+} // namespace Pomdog
+
+namespace Pomdog::Detail {
+
+/// KerningTable is an open-addressing hash table of kerning amounts keyed by
+/// pairs of characters. It is looked up for every pair of adjacent characters
+/// during text layout.
+class POMDOG_EXPORT KerningTable final {
+public:
+    KerningTable() = default;
+
+    /// Rebuilds the table from `kernings`. If a pair appears more than once,
+    /// the last one wins.
+    void Reset(const std::vector<FontKerning>& kernings);
+
+    /// Adds the amount of the pair, or replaces it if the pair is already in
+    /// the table. Pairs with zero amount can be added to remember that the
+    /// pair has no kerning.
+    void Insert(char32_t first, char32_t second, std::int16_t amount);
+
+    /// Returns the kerning amount of the pair, or zero if there is none.
+    [[nodiscard]] std::int16_t Find(char32_t first, char32_t second) const noexcept;
+
+    /// Returns the kerning amount of the pair, or std::nullopt if the pair is not in the table.
+    [[nodiscard]] std::optional<std::int16_t> TryFind(char32_t first, char32_t second) const noexcept;
+
+    /// Returns the number of pairs in the table.
+    [[nodiscard]] std::size_t GetCount() const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept;
+
+private:
+    void Rehash(std::size_t capacity);
+
+    [[nodiscard]] std::size_t FindSlot(std::uint64_t key) const noexcept;
+
+    struct Entry final {
+        // NOTE: `(first << 32) | second`, or zero for an empty slot.
+        std::uint64_t Key;
+        std::int16_t Amount;
+    };
+
+    std::vector<Entry> entries;
+    std::size_t count = 0;
+    std::uint64_t mask = 0;
+    int shift = 0;
+};
+
+} // namespace Pomdog::Detail
@@ -13,8 +13,13 @@
 #include "Pomdog/Math/Vector4.hpp"
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <vector>
 
+namespace Pomdog::Detail {
+class TessellationCache;
+} // namespace Pomdog::Detail
+
 namespace Pomdog {
 
 struct PrimitiveBatchVertex final {
@@ -29,6 +34,7 @@ class POMDOG_EXPORT PolygonShapeBuilder final {
 private:
     using Vertex = PrimitiveBatchVertex;
     std::vector<PrimitiveBatchVertex> vertices;
+    std::shared_ptr<Detail::TessellationCache> tessellationCache;
     std::size_t maxVertexCount;
     std::size_t minVertexCount;
     std::function<void()> onFlush;
@@ -38,6 +44,13 @@ public:
 
     explicit PolygonShapeBuilder(std::size_t maxVertexCount);
 
+    /// Creates a builder that calls `onFlush` when there is no room for
+    /// the next triangle. The callback is expected to consume and Reset()
+    /// the builder.
+    PolygonShapeBuilder(
+        std::size_t maxVertexCount,
+        std::function<void()>&& onFlush);
+
     void Reset();
 
     const PrimitiveBatchVertex* GetData() const noexcept;
@@ -0,0 +1,40 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Basic/Export.hpp"
+#include "Pomdog/Graphics/detail/ForwardDeclarations.hpp"
+#include <cstddef>
+#include <memory>
+
+namespace Pomdog {
+
+class PolygonShapeBuilder;
+struct PrimitiveBatchVertex;
+
+/// PolygonShapeMesh is a retained triangle list tessellated once into an
+/// immutable vertex buffer, which can be drawn repeatedly with
+/// PrimitiveBatch::DrawMesh() without re-tessellating the shape every frame.
+class POMDOG_EXPORT PolygonShapeMesh final {
+public:
+    PolygonShapeMesh(
+        const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+        const PolygonShapeBuilder& builder);
+
+    PolygonShapeMesh(
+        const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+        const PrimitiveBatchVertex* vertices,
+        std::size_t vertexCount);
+
+    /// Gets the number of vertices.
+    std::size_t GetVertexCount() const noexcept;
+
+    /// Gets the vertex buffer that holds the tessellated triangles.
+    const std::shared_ptr<VertexBuffer>& GetVertexBuffer() const noexcept;
+
+private:
+    std::shared_ptr<VertexBuffer> vertexBuffer;
+    std::size_t vertexCount;
+};
+
+} // namespace Pomdog
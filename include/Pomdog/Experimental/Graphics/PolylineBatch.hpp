@@ -5,6 +5,7 @@
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Graphics/detail/ForwardDeclarations.hpp"
 #include "Pomdog/Math/detail/ForwardDeclarations.hpp"
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -18,6 +19,14 @@ public:
         const std::shared_ptr<GraphicsDevice>& graphicsDevice,
         AssetManager& assets);
 
+    /// Creates a polyline batch with the specified capacity per draw call.
+    /// Use IndexElementSize::ThirtyTwoBits when `maxVertexCount` exceeds 65535.
+    PolylineBatch(
+        const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+        std::size_t maxVertexCount,
+        IndexElementSize indexElementSize,
+        AssetManager& assets);
+
     ~PolylineBatch();
 
     void Begin(
@@ -30,6 +39,20 @@ public:
         const Color& color,
         float thickness);
 
+    void DrawPath(
+        const Vector2* path,
+        std::size_t pointCount,
+        bool closed,
+        const Color& color,
+        float thickness);
+
+    void DrawPath(
+        const Vector3* path,
+        std::size_t pointCount,
+        bool closed,
+        const Color& color,
+        float thickness);
+
     //void DrawArc(
     //    const Vector2& position,
     //    float radius,
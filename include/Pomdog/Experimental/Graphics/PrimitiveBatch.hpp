@@ -5,7 +5,9 @@
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Graphics/detail/ForwardDeclarations.hpp"
 #include "Pomdog/Math/detail/ForwardDeclarations.hpp"
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -13,6 +15,8 @@
 namespace Pomdog {
 
 class AssetManager;
+class PolygonShapeMesh;
+struct PrimitiveBatchVertex;
 
 class POMDOG_EXPORT PrimitiveBatch final {
 public:
@@ -26,6 +30,15 @@ public:
         std::optional<RasterizerDescription>&& rasterizerDesc,
         AssetManager& assets);
 
+    /// Creates a primitive batch that can submit up to `maxVertexCount`
+    /// vertices in a single draw call.
+    PrimitiveBatch(
+        const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+        std::optional<DepthStencilDescription>&& depthStencilDesc,
+        std::optional<RasterizerDescription>&& rasterizerDesc,
+        std::size_t maxVertexCount,
+        AssetManager& assets);
+
     ~PrimitiveBatch();
 
     void Begin(
@@ -179,6 +192,22 @@ public:
         const Vector4& color2,
         const Vector4& color3);
 
+    /// Draws a retained mesh transformed by `worldMatrix`.
+    void DrawMesh(
+        const PolygonShapeMesh& mesh,
+        const Matrix4x4& worldMatrix);
+
+    /// Draws a triangle list whose vertices have already been built, such as
+    /// the vertices passed to the flush callback.
+    void DrawVertices(
+        const PrimitiveBatchVertex* vertices,
+        std::size_t vertexCount);
+
+    /// Sets a function that is called with the vertices of every draw call
+    /// submitted by the batch. Meshes drawn with DrawMesh() are not reported.
+    void SetFlushCallback(
+        std::function<void(const PrimitiveBatchVertex* vertices, std::size_t vertexCount)>&& callback);
+
     void Flush();
 
     void End();
@@ -0,0 +1,132 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Basic/Export.hpp"
+#include "Pomdog/Math/Color.hpp"
+#include "Pomdog/Math/Matrix3x2.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
+#include "Pomdog/Math/Vector2.hpp"
+#include "Pomdog/Math/Vector4.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Pomdog {
+
+/// PrimitiveInstanceShape specifies the unit mesh that an instance is drawn with.
+enum class PrimitiveInstanceShape : std::uint8_t {
+    /// The triangle (0, 0), (1, 0), (0, 1).
+    Triangle,
+
+    /// The quad from (0, 0) to (1, 1).
+    Rectangle,
+
+    /// The circle of radius 1 centered at the origin.
+    Circle,
+};
+
+/// PrimitiveInstance is a per-instance record. A point `p` of the unit mesh
+/// is transformed by `p.x * Transform.xy + p.y * Transform.zw + Translation.xy`.
+struct PrimitiveInstance final {
+    // {xy__} = first row of the affine transform
+    // {__zw} = second row of the affine transform
+    Vector4 Transform;
+
+    // {xy__} = translation.xy
+    // {__z_} = depth
+    // {___w} = unused
+    Vector4 Translation;
+
+    // {xyzw} = color.rgba
+    Vector4 Color;
+};
+
+/// PrimitiveInstanceRange is a run of consecutive instances that share the same shape.
+struct PrimitiveInstanceRange final {
+    std::size_t StartInstanceLocation;
+    std::size_t InstanceCount;
+    PrimitiveInstanceShape Shape;
+};
+
+class POMDOG_EXPORT PrimitiveInstanceBuilder final {
+private:
+    std::vector<PrimitiveInstance> instances;
+    std::vector<PrimitiveInstanceRange> ranges;
+    std::size_t maxInstanceCount;
+    std::function<void()> onFlush;
+
+public:
+    PrimitiveInstanceBuilder();
+
+    explicit PrimitiveInstanceBuilder(std::size_t maxInstanceCount);
+
+    /// Creates a builder that calls `onFlush` when there is no room for
+    /// the next instance. The callback is expected to consume and Reset()
+    /// the builder.
+    PrimitiveInstanceBuilder(
+        std::size_t maxInstanceCount,
+        std::function<void()>&& onFlush);
+
+    void Reset();
+
+    const PrimitiveInstance* GetData() const noexcept;
+
+    std::size_t GetInstanceCount() const noexcept;
+
+    /// Returns the runs of instances in submission order.
+    const std::vector<PrimitiveInstanceRange>& GetRanges() const noexcept;
+
+    bool IsEmpty() const noexcept;
+
+    std::size_t GetMaxInstanceCount() const noexcept;
+
+    void DrawCircle(
+        const Vector2& position,
+        float radius,
+        const Color& color);
+
+    void DrawEllipse(
+        const Vector2& position,
+        float radiusX,
+        float radiusY,
+        const Color& color);
+
+    void DrawRectangle(
+        const Rectangle& sourceRect,
+        const Color& color);
+
+    void DrawRectangle(
+        const Matrix3x2& matrix,
+        const Vector2& position,
+        float width,
+        float height,
+        const Color& color);
+
+    void DrawRectangle(
+        const Vector2& position,
+        float width,
+        float height,
+        const Vector2& originPivot,
+        const Color& color);
+
+    void DrawTriangle(
+        const Vector2& point1,
+        const Vector2& point2,
+        const Vector2& point3,
+        const Color& color);
+
+    /// Appends an instance of `shape` transformed by `matrix`.
+    void DrawShape(
+        PrimitiveInstanceShape shape,
+        const Matrix3x2& matrix,
+        const Color& color);
+
+private:
+    void AddInstance(
+        PrimitiveInstanceShape shape,
+        const PrimitiveInstance& instance);
+};
+
+} // namespace Pomdog
@@ -4,13 +4,20 @@
 
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Graphics/detail/ForwardDeclarations.hpp"
+#include "Pomdog/Math/Color.hpp"
+#include "Pomdog/Math/Radian.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
+#include "Pomdog/Math/Vector2.hpp"
 #include "Pomdog/Math/detail/ForwardDeclarations.hpp"
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <optional>
 
 namespace Pomdog {
 
 class AssetManager;
+class Texture2DView;
 struct TextureRegion;
 
 enum class SpriteBatchPixelShaderMode : std::uint8_t {
@@ -35,6 +42,19 @@ struct SpriteBatchDistanceFieldParameters final {
     float Weight;
 };
 
+/// SpriteDesc describes a single sprite submitted via SpriteBatch::DrawBatch.
+/// The members are ordered so that `Position` and `Scale`, and `OriginPivot`,
+/// `Rotation` and `LayerDepth` are contiguous.
+struct POMDOG_EXPORT SpriteDesc final {
+    Vector2 Position;
+    Vector2 Scale;
+    Rectangle SourceRect;
+    Vector2 OriginPivot;
+    Radian<float> Rotation;
+    float LayerDepth = 0.0f;
+    Pomdog::Color Color;
+};
+
 // NOTE: SpriteBatch uses the Cartesian coordinate system in which sprite is drawn.
 // Also the `originPivot` represents a anchor point of sprite.
 // If you want to align the bottom-left corner, the pivot is set to (0, 0).
@@ -190,6 +210,23 @@ public:
         const Vector2& originPivot,
         const Vector2& scale);
 
+    /// Draws multiple sprites that share the same texture.
+    void DrawBatch(
+        const std::shared_ptr<Texture2D>& texture,
+        const SpriteDesc* sprites,
+        std::size_t spriteCount);
+
+    /// Draws multiple sprites that share the same render target.
+    void DrawBatch(
+        const std::shared_ptr<RenderTarget2D>& texture,
+        const SpriteDesc* sprites,
+        std::size_t spriteCount);
+
+    /// Sets a function that is called with the sprites of every draw call
+    /// submitted by the batch, so that they can be drawn again with DrawBatch().
+    void SetFlushCallback(
+        std::function<void(const Texture2DView& texture, const SpriteDesc* sprites, std::size_t spriteCount)>&& callback);
+
     void Flush();
 
     void End();
@@ -8,13 +8,16 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Pomdog {
 
 struct FontGlyph;
+struct FontKerning;
 class SpriteBatch;
 class TrueTypeFont;
+struct TextLayout;
 
 // NOTE: SpriteFont uses the Cartesian coordinate system in which text is drawn.
 // Also the `originPivot` represents a anchor point of text label.
@@ -31,6 +34,16 @@ class TrueTypeFont;
 //        v     +-----------------------------------+
 //           (0, 0)                               (1, 0)
 
+enum class SpriteFontRasterization : std::uint8_t {
+    /// Glyphs are rasterized as coverage bitmaps for a single font size.
+    Coverage,
+
+    /// Glyphs are rasterized as signed distance fields. A single atlas can be
+    /// drawn at any scale with SpriteBatchPixelShaderMode::DistanceField,
+    /// where the weight of SpriteBatchDistanceFieldParameters is 0.5.
+    DistanceField,
+};
+
 class POMDOG_EXPORT SpriteFont final {
 public:
     SpriteFont(
@@ -39,18 +52,53 @@ public:
         float spacing,
         float lineSpacing);
 
+    SpriteFont(
+        std::vector<std::shared_ptr<Texture2D>>&& textures,
+        const std::vector<FontGlyph>& glyphs,
+        const std::vector<FontKerning>& kernings,
+        float spacing,
+        float lineSpacing);
+
     SpriteFont(
         const std::shared_ptr<GraphicsDevice>& graphicsDevice,
         const std::shared_ptr<TrueTypeFont>& font,
         float fontSize,
         float lineSpacing);
 
+    SpriteFont(
+        const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+        const std::shared_ptr<TrueTypeFont>& font,
+        float fontSize,
+        float lineSpacing,
+        SpriteFontRasterization rasterization);
+
     ~SpriteFont();
 
+    /// Rasterizes the glyphs of `text` immediately.
     void PrepareFonts(const std::string& text);
 
+    /// Rasterizes the glyphs in the inclusive code point ranges on worker
+    /// threads. They are added to the atlas the next time text is measured
+    /// or drawn; until then, missing glyphs are drawn as the default character.
+    void PrewarmGlyphs(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges);
+
     Vector2 MeasureString(const std::string& text) const;
 
+    /// Lays out `text` so that it can be drawn many times without decoding
+    /// the string again.
+    TextLayout CreateTextLayout(const std::string& text) const;
+
+    /// Computes the horizontal pen position at each byte offset of `text`, so
+    /// that `offsets[i]` is where a caret in front of `text[i]` is placed.
+    /// `offsets` is resized to `text.size() + 1`, and only the offsets after
+    /// `startIndex` are recomputed, continuing from `offsets[startIndex]`.
+    /// This allows callers to update the offsets incrementally after editing
+    /// the text from `startIndex` onward.
+    void MeasureCaretOffsets(
+        const std::string& text,
+        std::size_t startIndex,
+        std::vector<float>& offsets) const;
+
     char32_t GetDefaultCharacter() const;
 
     void SetDefaultCharacter(char32_t character);
@@ -59,6 +107,10 @@ public:
 
     void SetLineSpacing(float lineSpacing);
 
+    /// Returns true if there are requested glyphs that have not been added
+    /// to the atlas yet, i.e. text drawn now may still change its appearance.
+    bool HasPendingGlyphs() const;
+
     bool ContainsCharacter(char32_t character) const;
 
     void Draw(
@@ -85,6 +137,21 @@ public:
         const Vector2& originPivot,
         const Vector2& scale);
 
+    void Draw(
+        SpriteBatch& spriteBatch,
+        const TextLayout& layout,
+        const Vector2& position,
+        const Color& color);
+
+    void Draw(
+        SpriteBatch& spriteBatch,
+        const TextLayout& layout,
+        const Vector2& position,
+        const Color& color,
+        const Radian<float>& rotation,
+        const Vector2& originPivot,
+        const Vector2& scale);
+
 private:
     class Impl;
     std::unique_ptr<Impl> impl;
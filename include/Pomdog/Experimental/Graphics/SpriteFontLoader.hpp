@@ -5,6 +5,7 @@
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Content/AssetManager.hpp"
 #include "Pomdog/Utility/Errors.hpp"
+#include <iosfwd>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -12,10 +13,15 @@
 namespace Pomdog {
 class AssetManager;
 class SpriteFont;
+struct FontKerning;
 } // namespace Pomdog
 
 namespace Pomdog::Detail {
 
+/// Parses the attributes of a `kerning` line of a BMFont text file, such as
+/// `first=86 second=65 amount=-2`, that follow the `kerning` tag.
+[[nodiscard]] POMDOG_EXPORT FontKerning ParseKerning(std::istream& stream);
+
 template <>
 struct POMDOG_EXPORT AssetLoader<SpriteFont> final {
     [[nodiscard]] std::tuple<std::shared_ptr<SpriteFont>, std::shared_ptr<Error>>
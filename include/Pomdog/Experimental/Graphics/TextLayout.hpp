@@ -0,0 +1,44 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Math/Rectangle.hpp"
+#include "Pomdog/Math/Vector2.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Pomdog {
+
+struct TextLayoutGlyph final {
+    Rectangle Subrect;
+
+    // NOTE: The bottom-left corner of the glyph relative to the origin of
+    // the first line, in the coordinate system in which Y points up.
+    Vector2 Position;
+
+    // NOTE: UCS-4/UTF-32
+    char32_t Character;
+
+    std::int16_t TexturePage;
+};
+
+/// TextLayout is the result of laying out a string with a SpriteFont.
+/// It can be created once and drawn many times, as long as the line spacing
+/// and the default character of the font are not changed.
+struct TextLayout final {
+    /// The visible glyphs in the order of the string. Spaces and control
+    /// characters are not included.
+    std::vector<TextLayoutGlyph> Glyphs;
+
+    /// The indices into `Glyphs` at which each line after the first one starts.
+    std::vector<std::size_t> LineBreaks;
+
+    /// The size of the bounding box of the text.
+    Vector2 Size = Vector2::Zero;
+
+    /// The line spacing of the font when the layout was created.
+    float LineSpacing = 0.0f;
+};
+
+} // namespace Pomdog
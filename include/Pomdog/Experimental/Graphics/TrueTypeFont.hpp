@@ -10,6 +10,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace Pomdog {
 
@@ -29,6 +30,42 @@ public:
         int textureWidth,
         const std::function<void(int width, int height, Point2D& point, std::uint8_t*& output)>& callback);
 
+    /// Rasterizes a glyph into `pixels` as a tightly packed 8-bit bitmap of
+    /// Subrect.Width by Subrect.Height pixels. The Subrect of the returned
+    /// glyph is located at (0, 0).
+    ///
+    /// This function can be called from multiple threads at once, as long as
+    /// the font is not being loaded.
+    std::optional<FontGlyph> RasterizeGlyph(
+        char32_t codePoint,
+        float pixelHeight,
+        std::vector<std::uint8_t>& pixels) const;
+
+    /// Rasterizes a glyph into `pixels` as a tightly packed 8-bit signed
+    /// distance field. The outline of the glyph maps to 128 and the value
+    /// falls off linearly to 0 at `padding` pixels outside the outline, so the
+    /// Subrect of the returned glyph includes `padding` pixels on each side.
+    ///
+    /// This function can be called from multiple threads at once, as long as
+    /// the font is not being loaded.
+    std::optional<FontGlyph> RasterizeGlyphSDF(
+        char32_t codePoint,
+        float pixelHeight,
+        int padding,
+        std::vector<std::uint8_t>& pixels) const;
+
+    /// Returns true if the font has a `kern` or `GPOS` table.
+    [[nodiscard]] bool HasKerning() const noexcept;
+
+    /// Returns the kerning of the pair of characters in pixels, scaled to
+    /// `pixelHeight`. The amount is added to the advance of `first`.
+    /// The pairs are read from the `kern` table or the pair adjustments of
+    /// the `GPOS` table.
+    ///
+    /// This function can be called from multiple threads at once, as long as
+    /// the font is not being loaded.
+    [[nodiscard]] std::int16_t GetKerning(char32_t first, char32_t second, float pixelHeight) const;
+
 private:
     class Impl;
     std::unique_ptr<Impl> impl;
@@ -4,10 +4,14 @@
 
 #include "Pomdog/Basic/Export.hpp"
 #include "Pomdog/Math/Color.hpp"
+#include "Pomdog/Utility/Errors.hpp"
+#include <memory>
 #include <vector>
 
 namespace Pomdog {
 
+struct ImageBuffer;
+
 class POMDOG_EXPORT Image final {
 public:
     Image(int width, int height);
@@ -34,6 +38,11 @@ public:
     /// Sets image data.
     void SetData(std::vector<Color>&& pixelData);
 
+    /// Sets image data converted from a decoded image of the same size.
+    /// R8G8B8A8_UNorm, B8G8R8A8_UNorm and A8_UNorm images are supported, and
+    /// A8_UNorm pixels become white with the same alpha.
+    [[nodiscard]] std::shared_ptr<Error> SetData(const ImageBuffer& imageBuffer);
+
     [[nodiscard]] const Color& GetPixel(int x, int y) const;
 
     void SetPixel(int x, int y, const Color& color);
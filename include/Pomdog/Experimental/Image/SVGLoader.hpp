@@ -8,8 +8,10 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace Pomdog {
+class AssetManager;
 class Texture2D;
 class GraphicsDevice;
 } // namespace Pomdog
@@ -33,6 +35,16 @@ DecodeFile(
     int width,
     int height);
 
+/// Reads SVG images from files (.svg) concurrently on the worker threads of
+/// the asset manager. The results are in the same order as the file paths.
+[[nodiscard]] POMDOG_EXPORT
+std::vector<std::tuple<ImageBuffer, std::shared_ptr<Error>>>
+DecodeFiles(
+    AssetManager& assets,
+    const std::vector<std::string>& filePaths,
+    int width,
+    int height);
+
 /// Creates a texture from SVG file (.svg).
 [[nodiscard]] POMDOG_EXPORT
 std::tuple<std::shared_ptr<Texture2D>, std::shared_ptr<Error>>
@@ -6,6 +6,7 @@
 #include "Pomdog/Graphics/SurfaceFormat.hpp"
 #include "Pomdog/Graphics/Texture.hpp"
 #include "Pomdog/Graphics/detail/ForwardDeclarations.hpp"
+#include "Pomdog/Math/detail/ForwardDeclarations.hpp"
 #include <cstdint>
 #include <memory>
 
@@ -32,7 +33,7 @@ public:
     ~Texture2D();
 
     Texture2D& operator=(const Texture2D&) = delete;
-    Texture2D& operator=(Texture2D&&) = default;
+    Texture2D& operator=(Texture2D&&);
 
     /// Gets the width of the texture data, in pixels.
     std::int32_t GetWidth() const;
@@ -49,6 +50,14 @@ public:
     /// Sets texture data.
     void SetData(const void* pixelData);
 
+    /// Sets texture data of the region in the mipmap level.
+    ///
+    /// @param region The region to update, in pixels of the mipmap level.
+    /// @param mipLevel The mipmap level to update.
+    /// @param pixelData The pixel data of the region. Rows are tightly packed.
+    /// @note Block-compressed formats are not supported.
+    void SetData(const Rectangle& region, std::int32_t mipLevel, const void* pixelData);
+
     /// Gets the pointer of the native texture resource.
     Detail::NativeTexture2D* GetNativeTexture2D();
 
@@ -26,11 +26,14 @@ namespace Pomdog {
 #include "Audio/AudioEmitter.hpp"
 #include "Audio/AudioEngine.hpp"
 #include "Audio/AudioListener.hpp"
+#include "Audio/AudioStream.hpp"
 #include "Audio/SoundEffect.hpp"
 #include "Audio/SoundState.hpp"
+#include "Audio/StreamingAudioSource.hpp"
 
 #include "Content/AssetBuilders/PipelineStateBuilder.hpp"
 #include "Content/AssetBuilders/ShaderBuilder.hpp"
+#include "Content/AssetKey.hpp"
 #include "Content/AssetManager.hpp"
 
 #include "Math/BoundingBox.hpp"
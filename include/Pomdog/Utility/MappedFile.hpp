@@ -0,0 +1,74 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Basic/Export.hpp"
+#include "Pomdog/Utility/Errors.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace Pomdog {
+
+/// MappedFile is a read-only view of the whole contents of a file.
+///
+/// On POSIX platforms the file is mapped into memory, so opening it does not
+/// copy the contents and the pages are read on demand. On other platforms
+/// the contents are read into a buffer owned by the MappedFile.
+///
+/// A MappedFile can also view a range of another MappedFile, e.g. an entry
+/// of an archive, or own a buffer, e.g. the decompressed contents of a file.
+class POMDOG_EXPORT MappedFile final {
+public:
+    MappedFile() noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    ~MappedFile();
+
+    /// Opens the file at the specified path for reading.
+    [[nodiscard]] static std::tuple<MappedFile, std::shared_ptr<Error>>
+    Open(const std::string& path);
+
+    /// Creates a view of the range of `source`, which keeps `source` open
+    /// while the view is alive.
+    [[nodiscard]] static MappedFile
+    Slice(const std::shared_ptr<const MappedFile>& source, std::size_t offset, std::size_t size);
+
+    /// Creates a MappedFile that owns the contents of `buffer`.
+    [[nodiscard]] static MappedFile
+    FromBuffer(std::vector<std::uint8_t>&& buffer);
+
+    /// Returns a pointer to the contents of the file, or nullptr if the file
+    /// is not open or empty.
+    [[nodiscard]] const std::uint8_t* GetData() const noexcept;
+
+    /// Returns the size of the file in bytes.
+    [[nodiscard]] std::size_t GetSize() const noexcept;
+
+    /// Unmaps the file or releases the contents. GetData() returns nullptr
+    /// after this call.
+    void Close() noexcept;
+
+private:
+    const std::uint8_t* data;
+    std::size_t size;
+
+    // NOTE: The contents of the file on platforms that do not support mmap,
+    // or the buffer passed to FromBuffer().
+    std::vector<std::uint8_t> buffer;
+
+    // NOTE: The file that a slice views.
+    std::shared_ptr<const MappedFile> source;
+
+    bool isMapped;
+};
+
+} // namespace Pomdog
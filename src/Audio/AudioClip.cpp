@@ -82,6 +82,12 @@ AudioChannels AudioClip::GetChannels() const
     return channels;
 }
 
+std::size_t AudioClip::GetSizeInBytes() const
+{
+    POMDOG_ASSERT(nativeAudioClip);
+    return nativeAudioClip->SizeInBytes();
+}
+
 Detail::SoundSystem::NativeAudioClip* AudioClip::GetNativeAudioClip()
 {
     POMDOG_ASSERT(nativeAudioClip);
@@ -0,0 +1,125 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Audio/StreamingAudioSource.hpp"
+
+#if defined(POMDOG_PLATFORM_MACOSX) || defined(POMDOG_PLATFORM_APPLE_IOS)
+#include "../SoundSystem.OpenAL/StreamingAudioSourceAL.hpp"
+#elif defined(POMDOG_PLATFORM_LINUX)
+#include "../SoundSystem.OpenAL/StreamingAudioSourceAL.hpp"
+#elif defined(POMDOG_PLATFORM_WIN32) || defined(POMDOG_PLATFORM_XBOX_ONE)
+#include "../SoundSystem.XAudio2/StreamingAudioSourceXAudio2.hpp"
+#endif
+
+#include "Pomdog/Audio/AudioEngine.hpp"
+#include "Pomdog/Audio/AudioStream.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace Pomdog {
+
+StreamingAudioSource::StreamingAudioSource(
+    AudioEngine& audioEngine,
+    std::unique_ptr<AudioStream>&& audioStream,
+    bool isLoopedIn)
+    : pitch(0.0f)
+    , volume(1.0f)
+    , isLooped(isLoopedIn)
+{
+    POMDOG_ASSERT(audioStream != nullptr);
+    POMDOG_ASSERT(audioStream->GetSampleRate() > 0);
+
+    length = Duration{static_cast<double>(audioStream->GetFrameCount()) / audioStream->GetSampleRate()};
+
+    auto nativeAudioEngine = audioEngine.GetNativeAudioEngine();
+    POMDOG_ASSERT(nativeAudioEngine);
+
+    nativeSource = std::make_unique<Detail::SoundSystem::NativeStreamingAudioSource>(
+        *nativeAudioEngine, std::move(audioStream), isLooped);
+}
+
+StreamingAudioSource::~StreamingAudioSource() = default;
+
+void StreamingAudioSource::Pause()
+{
+    POMDOG_ASSERT(nativeSource);
+    nativeSource->Pause();
+}
+
+void StreamingAudioSource::Play()
+{
+    POMDOG_ASSERT(nativeSource);
+    nativeSource->Play();
+}
+
+void StreamingAudioSource::Stop()
+{
+    POMDOG_ASSERT(nativeSource);
+    nativeSource->Stop();
+}
+
+void StreamingAudioSource::Seek(const Duration& position)
+{
+    POMDOG_ASSERT(nativeSource);
+    POMDOG_ASSERT(position.count() >= 0.0);
+
+    const auto clamped = std::clamp(position, Duration::zero(), length);
+    nativeSource->Seek(clamped);
+}
+
+bool StreamingAudioSource::IsLooped() const
+{
+    return isLooped;
+}
+
+void StreamingAudioSource::ExitLoop()
+{
+    if (!isLooped) {
+        return;
+    }
+
+    POMDOG_ASSERT(nativeSource);
+    nativeSource->ExitLoop();
+    isLooped = false;
+}
+
+SoundState StreamingAudioSource::GetState() const
+{
+    POMDOG_ASSERT(nativeSource);
+    return nativeSource->GetState();
+}
+
+Duration StreamingAudioSource::GetLength() const
+{
+    return length;
+}
+
+float StreamingAudioSource::GetPitch() const
+{
+    return pitch;
+}
+
+void StreamingAudioSource::SetPitch(float pitchIn)
+{
+    POMDOG_ASSERT(pitchIn >= -1.0f);
+    POMDOG_ASSERT(pitchIn <= 1.0f);
+    POMDOG_ASSERT(nativeSource);
+    this->pitch = pitchIn;
+    nativeSource->SetPitch(pitchIn);
+}
+
+float StreamingAudioSource::GetVolume() const
+{
+    return volume;
+}
+
+void StreamingAudioSource::SetVolume(float volumeIn)
+{
+    POMDOG_ASSERT(volumeIn >= 0.0f);
+    POMDOG_ASSERT(volumeIn <= 1.0f);
+    POMDOG_ASSERT(nativeSource);
+    this->volume = volumeIn;
+    nativeSource->SetVolume(volume);
+}
+
+} // namespace Pomdog
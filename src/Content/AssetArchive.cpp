@@ -0,0 +1,177 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "AssetArchive.hpp"
+#include "Pomdog/Content/Utility/BinaryReader.hpp"
+#include "Pomdog/Content/Utility/MakeFourCC.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include "Pomdog/Utility/detail/CRC32.hpp"
+#include <zlib.h>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Pomdog::Detail {
+namespace {
+
+constexpr std::uint32_t AssetArchiveVersion = 1;
+
+[[nodiscard]] bool IsInRange(std::uint64_t offset, std::uint64_t size, std::size_t fileSize) noexcept
+{
+    return (offset <= fileSize) && (size <= fileSize - offset);
+}
+
+} // namespace
+
+std::tuple<std::shared_ptr<AssetArchive>, std::shared_ptr<Error>>
+AssetArchive::Open(const std::string& filePath)
+{
+    auto [mappedFile, openErr] = MappedFile::Open(filePath);
+    if (openErr != nullptr) {
+        auto err = Errors::Wrap(std::move(openErr), "cannot open the archive, " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    const auto data = mappedFile.GetData();
+    const auto fileSize = mappedFile.GetSize();
+
+    auto invalidFormat = [&](const std::string& message) {
+        auto err = Errors::New("invalid asset archive: " + message + ", " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    };
+
+    if (!BinaryReader::CanRead<AssetArchiveHeader>(fileSize)) {
+        return invalidFormat("the file is too small");
+    }
+
+    const auto header = BinaryReader::Read<AssetArchiveHeader>(data);
+    if (header.Signature != MakeFourCC('P', 'A', 'K', ' ')) {
+        return invalidFormat("the signature does not match");
+    }
+    if (header.Version != AssetArchiveVersion) {
+        return invalidFormat("unsupported version " + std::to_string(header.Version));
+    }
+
+    const auto indexSize = static_cast<std::uint64_t>(header.EntryCount) * sizeof(AssetArchiveEntry);
+    if (!IsInRange(header.IndexOffset, indexSize, fileSize)) {
+        return invalidFormat("the index is out of range");
+    }
+    if (!IsInRange(header.NamesOffset, header.NamesSize, fileSize)) {
+        return invalidFormat("the names are out of range");
+    }
+
+    // NOTE: The index is searched in place, so the entries must be aligned.
+    // The archive is mapped at a page boundary.
+    if ((header.IndexOffset % alignof(AssetArchiveEntry)) != 0) {
+        return invalidFormat("the index is not aligned");
+    }
+
+    auto archive = std::make_shared<AssetArchive>();
+    archive->filePath = filePath;
+    archive->entryCount = header.EntryCount;
+    if (archive->entryCount > 0) {
+        archive->entries = reinterpret_cast<const AssetArchiveEntry*>(data + header.IndexOffset);
+    }
+    archive->names = reinterpret_cast<const char*>(data + header.NamesOffset);
+
+    // NOTE: Only the index is validated here, so that the contents of the
+    // assets are not paged in by mounting.
+    const auto entriesEnd = archive->entries + archive->entryCount;
+    for (auto entry = archive->entries; entry != entriesEnd; ++entry) {
+        if (!IsInRange(entry->NameOffset, entry->NameLength, header.NamesSize)) {
+            return invalidFormat("the name of an entry is out of range");
+        }
+        if (!IsInRange(entry->DataOffset, entry->StoredSize, fileSize)) {
+            return invalidFormat("the contents of an entry are out of range");
+        }
+        if ((entry->Compression == AssetArchiveCompression::None) && (entry->StoredSize != entry->Size)) {
+            return invalidFormat("the size of a stored entry does not match");
+        }
+        if ((entry->Compression != AssetArchiveCompression::None) &&
+            (entry->Compression != AssetArchiveCompression::Deflate)) {
+            return invalidFormat("unsupported compression");
+        }
+    }
+
+    auto hashLess = [](const AssetArchiveEntry& a, const AssetArchiveEntry& b) {
+        return a.NameHash < b.NameHash;
+    };
+    if (!std::is_sorted(archive->entries, entriesEnd, hashLess)) {
+        return invalidFormat("the index is not sorted");
+    }
+
+    archive->file = std::make_shared<MappedFile>(std::move(mappedFile));
+    return std::make_tuple(std::move(archive), nullptr);
+}
+
+const AssetArchiveEntry* AssetArchive::Find(std::string_view name) const noexcept
+{
+    const auto hash = CRC32::ComputeCRC32(name.data(), name.size());
+
+    const auto entriesEnd = entries + entryCount;
+    auto iter = std::lower_bound(entries, entriesEnd, hash,
+        [](const AssetArchiveEntry& entry, std::uint32_t h) { return entry.NameHash < h; });
+
+    // NOTE: Entries with the same hash are next to each other.
+    for (; (iter != entriesEnd) && (iter->NameHash == hash); ++iter) {
+        const std::string_view entryName{names + iter->NameOffset, iter->NameLength};
+        if (entryName == name) {
+            return iter;
+        }
+    }
+    return nullptr;
+}
+
+std::tuple<MappedFile, std::shared_ptr<Error>>
+AssetArchive::OpenEntry(const AssetArchiveEntry& entry) const
+{
+    POMDOG_ASSERT(file != nullptr);
+    POMDOG_ASSERT(IsInRange(entry.DataOffset, entry.StoredSize, file->GetSize()));
+
+    const auto offset = static_cast<std::size_t>(entry.DataOffset);
+    const auto storedSize = static_cast<std::size_t>(entry.StoredSize);
+
+    switch (entry.Compression) {
+    case AssetArchiveCompression::None: {
+        auto contents = MappedFile::Slice(file, offset, storedSize);
+        return std::make_tuple(std::move(contents), nullptr);
+    }
+    case AssetArchiveCompression::Deflate: {
+        if ((entry.Size > std::numeric_limits<uLong>::max()) ||
+            (entry.StoredSize > std::numeric_limits<uLong>::max())) {
+            auto err = Errors::New("the entry is too large to decompress, " + filePath);
+            return std::make_tuple(MappedFile{}, std::move(err));
+        }
+
+        std::vector<std::uint8_t> buffer(static_cast<std::size_t>(entry.Size));
+        auto bufferSize = static_cast<uLongf>(buffer.size());
+
+        const auto result = ::uncompress(
+            buffer.data(),
+            &bufferSize,
+            file->GetData() + offset,
+            static_cast<uLong>(storedSize));
+
+        if ((result != Z_OK) || (bufferSize != buffer.size())) {
+            auto err = Errors::New("failed to decompress the entry, " + filePath);
+            return std::make_tuple(MappedFile{}, std::move(err));
+        }
+        return std::make_tuple(MappedFile::FromBuffer(std::move(buffer)), nullptr);
+    }
+    }
+
+    auto err = Errors::New("unsupported compression, " + filePath);
+    return std::make_tuple(MappedFile{}, std::move(err));
+}
+
+std::size_t AssetArchive::GetEntryCount() const noexcept
+{
+    return entryCount;
+}
+
+std::string AssetArchive::GetFilePath() const
+{
+    return filePath;
+}
+
+} // namespace Pomdog::Detail
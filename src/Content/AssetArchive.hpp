@@ -0,0 +1,94 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Utility/Errors.hpp"
+#include "Pomdog/Utility/MappedFile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+namespace Pomdog::Detail {
+
+// NOTE: An asset archive packs many asset files into a single file, which is
+// created by `tools/pack_assets`. All values are little-endian.
+//
+//   AssetArchiveHeader
+//   AssetArchiveEntry[EntryCount]  (sorted by NameHash, at IndexOffset)
+//   char[NamesSize]                (the asset names, at NamesOffset)
+//   contents of the assets         (each aligned to Alignment)
+
+enum class AssetArchiveCompression : std::uint32_t {
+    /// The contents are stored as is.
+    None = 0,
+
+    /// The contents are compressed with zlib (deflate).
+    Deflate = 1,
+};
+
+struct AssetArchiveHeader final {
+    std::uint32_t Signature;
+    std::uint32_t Version;
+    std::uint32_t EntryCount;
+    std::uint32_t Alignment;
+    std::uint64_t IndexOffset;
+    std::uint64_t NamesOffset;
+    std::uint64_t NamesSize;
+};
+
+struct AssetArchiveEntry final {
+    /// The CRC-32 of the asset name.
+    std::uint32_t NameHash;
+    std::uint32_t NameOffset;
+    std::uint32_t NameLength;
+    AssetArchiveCompression Compression;
+    std::uint64_t DataOffset;
+
+    /// The size of the contents in the archive.
+    std::uint64_t StoredSize;
+
+    /// The size of the contents after decompression.
+    std::uint64_t Size;
+};
+
+static_assert(sizeof(AssetArchiveHeader) == 40);
+static_assert(sizeof(AssetArchiveEntry) == 40);
+
+/// AssetArchive is a mounted asset archive. The archive is mapped into memory
+/// and its index is searched in place, so mounting does not read the
+/// contents of the assets.
+class AssetArchive final {
+public:
+    AssetArchive() = default;
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    /// Maps the archive into memory and validates its index.
+    [[nodiscard]] static std::tuple<std::shared_ptr<AssetArchive>, std::shared_ptr<Error>>
+    Open(const std::string& filePath);
+
+    /// Returns the entry of the asset, or nullptr if it is not in the archive.
+    /// `name` is a slash-separated path relative to the content directory.
+    [[nodiscard]] const AssetArchiveEntry* Find(std::string_view name) const noexcept;
+
+    /// Opens the contents of the entry. Stored entries are views into the
+    /// archive and compressed entries are decompressed into a buffer.
+    [[nodiscard]] std::tuple<MappedFile, std::shared_ptr<Error>>
+    OpenEntry(const AssetArchiveEntry& entry) const;
+
+    [[nodiscard]] std::size_t GetEntryCount() const noexcept;
+
+    [[nodiscard]] std::string GetFilePath() const;
+
+private:
+    std::shared_ptr<const MappedFile> file;
+    std::string filePath;
+    const AssetArchiveEntry* entries = nullptr;
+    std::size_t entryCount = 0;
+    const char* names = nullptr;
+};
+
+} // namespace Pomdog::Detail
@@ -8,46 +8,32 @@
 #include "Pomdog/Content/Utility/BinaryReader.hpp"
 #include "Pomdog/Content/Utility/MakeFourCC.hpp"
 #include "Pomdog/Utility/Assert.hpp"
-#include "Pomdog/Utility/FileSystem.hpp"
-#include <fstream>
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
-#include <vector>
 
 namespace Pomdog::Detail {
 
 std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
-AssetLoader<AudioClip>::operator()([[maybe_unused]] AssetManager& assets, const std::string& filePath)
+AssetLoader<AudioClip>::operator()(AssetManager& assets, const std::string& filePath)
 {
-    std::ifstream stream{filePath, std::ifstream::binary};
-
-    if (!stream) {
-        auto err = Errors::New("cannot open the file, " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
-    }
-
-    auto [byteLength, sizeErr] = FileSystem::GetFileSize(filePath);
-    if (sizeErr != nullptr) {
-        auto err = Errors::Wrap(std::move(sizeErr), "failed to get file size, " + filePath);
+    auto [binary, openErr] = assets.OpenAssetFile(filePath);
+    if (openErr != nullptr) {
+        auto err = Errors::Wrap(std::move(openErr), "cannot open the file, " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    POMDOG_ASSERT(stream);
-
-    if (byteLength < (sizeof(std::uint8_t) * 12)) {
+    constexpr std::size_t signatureArraySize = 12;
+    if (binary.GetSize() < (sizeof(std::uint8_t) * signatureArraySize)) {
         auto err = Errors::New("The audio file is too small " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    auto signature = BinaryReader::ReadArray<std::uint8_t, 12>(stream);
-    if (stream.fail()) {
-        auto err = Errors::New("failed to read signature in the file " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
-    }
-
-    stream.clear();
-    stream.seekg(0, std::ios_base::beg);
+    // NOTE: The signature is taken from the mapped contents, so the file
+    // does not have to be read twice.
+    const auto signature = BinaryReader::Read<std::array<std::uint8_t, signatureArraySize>>(binary.GetData());
 
     const auto fourCC = MakeFourCC(signature[0], signature[1], signature[2], signature[3]);
 
@@ -55,7 +41,7 @@ AssetLoader<AudioClip>::operator()([[maybe_unused]] AssetManager& assets, const
         const auto fccType = MakeFourCC(signature[8], signature[9], signature[10], signature[11]);
         if (fccType == MakeFourCC('W', 'A', 'V', 'E')) {
             // NOTE: This file format is RIFF waveform audio.
-            auto [audioClip, loadErr] = WAV::Load(std::move(stream), byteLength);
+            auto [audioClip, loadErr] = WAV::Load(binary.GetData(), binary.GetSize());
 
             if (loadErr != nullptr) {
                 auto err = Errors::Wrap(std::move(loadErr), "Cannot load the wave file " + filePath);
@@ -66,9 +52,7 @@ AssetLoader<AudioClip>::operator()([[maybe_unused]] AssetManager& assets, const
     }
     else if (fourCC == MakeFourCC('O', 'g', 'g', 'S')) {
         // NOTE: The file format is Ogg Vorbis.
-        stream.close();
-
-        auto [audioClip, loadErr] = Vorbis::Load(filePath);
+        auto [audioClip, loadErr] = Vorbis::Load(binary.GetData(), binary.GetSize());
         if (loadErr != nullptr) {
             auto err = Errors::Wrap(std::move(loadErr), "Cannot load the ogg/vorbis file " + filePath);
             return std::make_tuple(nullptr, std::move(err));
@@ -80,4 +64,9 @@ AssetLoader<AudioClip>::operator()([[maybe_unused]] AssetManager& assets, const
     return std::make_tuple(nullptr, std::move(err));
 }
 
+std::size_t AssetLoader<AudioClip>::GetByteSize(const AudioClip& audioClip)
+{
+    return audioClip.GetSizeInBytes();
+}
+
 } // namespace Pomdog::Detail
@@ -1,6 +1,7 @@
 // Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
 
 #include "Pomdog/Content/AssetLoaders/Texture2DLoader.hpp"
+#include "../../RenderSystem/TextureHelper.hpp"
 #include "Pomdog/Content/AssetManager.hpp"
 #include "Pomdog/Content/Image/DDS.hpp"
 #include "Pomdog/Content/Image/PNG.hpp"
@@ -10,15 +11,12 @@
 #include "Pomdog/Graphics/SurfaceFormat.hpp"
 #include "Pomdog/Graphics/Texture2D.hpp"
 #include "Pomdog/Utility/Assert.hpp"
-#include "Pomdog/Utility/FileSystem.hpp"
 #include <algorithm>
 #include <array>
-#include <fstream>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
-#include <vector>
 
 namespace Pomdog::Detail {
 namespace {
@@ -59,136 +57,120 @@ bool IsPNMFormat(const std::array<std::uint8_t, 8>& signature) noexcept
 std::tuple<std::shared_ptr<Texture2D>, std::shared_ptr<Error>>
 AssetLoader<Texture2D>::operator()(AssetManager& assets, const std::string& filePath)
 {
-    std::ifstream stream{filePath, std::ifstream::binary};
-
-    if (!stream) {
-        auto err = Errors::New("cannot open the file, " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
+    auto [decoded, decodeErr] = Decode(assets, filePath);
+    if (decodeErr != nullptr) {
+        return std::make_tuple(nullptr, std::move(decodeErr));
     }
+    return Create(assets, std::move(decoded));
+}
 
-    auto [byteLength, sizeErr] = FileSystem::GetFileSize(filePath);
-    if (sizeErr != nullptr) {
-        auto err = Errors::Wrap(std::move(sizeErr), "failed to get file size, " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
+std::tuple<AssetLoader<Texture2D>::DecodedAsset, std::shared_ptr<Error>>
+AssetLoader<Texture2D>::Decode(const AssetManager& assets, const std::string& filePath)
+{
+    DecodedAsset decoded;
+
+    // NOTE: The file is mapped into memory instead of being copied into a
+    // buffer, and the signature is taken from the mapped contents.
+    auto [binary, openErr] = assets.OpenAssetFile(filePath);
+    if (openErr != nullptr) {
+        auto err = Errors::Wrap(std::move(openErr), "cannot open the file, " + filePath);
+        return std::make_tuple(std::move(decoded), std::move(err));
     }
 
-    POMDOG_ASSERT(stream);
-
     constexpr std::size_t signatureArraySize = 8;
-    if (byteLength < (sizeof(std::uint8_t) * signatureArraySize)) {
+    if (binary.GetSize() < (sizeof(std::uint8_t) * signatureArraySize)) {
         auto err = Errors::New("The texture file is too small " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
-    }
-
-    auto signature = BinaryReader::ReadArray<std::uint8_t, signatureArraySize>(stream);
-    if (stream.fail()) {
-        auto err = Errors::New("failed to read signature in the file " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
+        return std::make_tuple(std::move(decoded), std::move(err));
     }
 
-    stream.clear();
-    stream.seekg(0, stream.beg);
-
-    auto graphicsDevice = assets.GetGraphicsDevice();
-    POMDOG_ASSERT(graphicsDevice);
+    std::array<std::uint8_t, signatureArraySize> signature;
+    std::copy_n(binary.GetData(), signature.size(), signature.data());
 
     if (IsPNGFormat(signature)) {
-        std::vector<std::uint8_t> binary;
-        binary.resize(byteLength);
-        stream.read(reinterpret_cast<char*>(binary.data()), binary.size());
-        if (!stream) {
-            auto err = Errors::New("failed to read the file " + filePath);
-            return std::make_tuple(nullptr, std::move(err));
-        }
-
-        auto [image, decodeErr] = PNG::Decode(binary.data(), binary.size());
+        auto [image, decodeErr] = PNG::Decode(binary.GetData(), binary.GetSize());
         if (decodeErr != nullptr) {
             auto err = Errors::Wrap(std::move(decodeErr), "cannot load the PNG texture " + filePath);
-            return std::make_tuple(nullptr, std::move(err));
+            return std::make_tuple(std::move(decoded), std::move(err));
         }
 
-        constexpr bool generateMipmap = false;
-
-        auto texture = std::make_shared<Texture2D>(
-            graphicsDevice,
-            image.Width,
-            image.Height,
-            generateMipmap,
-            image.Format);
-
         POMDOG_ASSERT(!image.RawData.empty());
         POMDOG_ASSERT(image.PixelData != nullptr);
         POMDOG_ASSERT(image.ByteLength > 0);
 
-        texture->SetData(image.PixelData);
-
-        return std::make_tuple(std::move(texture), nullptr);
+        decoded.Image = std::move(image);
+        return std::make_tuple(std::move(decoded), nullptr);
     }
     else if (IsDDSFormat(signature)) {
-        std::vector<std::uint8_t> binary;
-        binary.resize(byteLength);
-        stream.read(reinterpret_cast<char*>(binary.data()), binary.size());
-        if (!stream) {
-            auto err = Errors::New("failed to read the file " + filePath);
-            return std::make_tuple(nullptr, std::move(err));
-        }
-
-        auto [image, decodeErr] = DDS::Decode(binary.data(), binary.size());
+        auto [image, decodeErr] = DDS::Decode(binary.GetData(), binary.GetSize());
         if (decodeErr != nullptr) {
             auto err = Errors::Wrap(std::move(decodeErr), "cannot load the DDS texture " + filePath);
-            return std::make_tuple(nullptr, std::move(err));
+            return std::make_tuple(std::move(decoded), std::move(err));
         }
 
-        // FIXME: Add support multi-level texture (mipmap)
-        constexpr bool generateMipmap = false;
-
-        auto texture = std::make_shared<Texture2D>(
-            graphicsDevice,
-            image.Width,
-            image.Height,
-            generateMipmap,
-            image.Format);
-
         POMDOG_ASSERT(image.PixelData != nullptr);
         POMDOG_ASSERT(image.ByteLength > 0);
 
-        texture->SetData(image.PixelData);
-
-        return std::make_tuple(std::move(texture), nullptr);
+        // NOTE: The pixel data of DDS points into the mapped file.
+        decoded.Image = std::move(image);
+        decoded.Binary = std::move(binary);
+        return std::make_tuple(std::move(decoded), nullptr);
     }
     else if (IsPNMFormat(signature)) {
-        std::vector<std::uint8_t> binary;
-        binary.resize(byteLength);
-        stream.read(reinterpret_cast<char*>(binary.data()), binary.size());
-        if (!stream) {
-            auto err = Errors::New("failed to read the file " + filePath);
-            return std::make_tuple(nullptr, std::move(err));
-        }
-
-        auto [image, decodeErr] = PNM::Decode(reinterpret_cast<const char*>(binary.data()), binary.size());
+        auto [image, decodeErr] = PNM::Decode(reinterpret_cast<const char*>(binary.GetData()), binary.GetSize());
         if (decodeErr != nullptr) {
             auto err = Errors::Wrap(std::move(decodeErr), "cannot load the PNM texture " + filePath);
-            return std::make_tuple(nullptr, std::move(err));
+            return std::make_tuple(std::move(decoded), std::move(err));
         }
 
-        constexpr bool generateMipmap = false;
-
-        auto texture = std::make_shared<Texture2D>(
-            graphicsDevice,
-            image.Width,
-            image.Height,
-            generateMipmap,
-            image.Format);
-
         POMDOG_ASSERT(image.PixelData != nullptr);
         POMDOG_ASSERT(image.ByteLength > 0);
-        texture->SetData(image.PixelData);
 
-        return std::make_tuple(std::move(texture), nullptr);
+        decoded.Image = std::move(image);
+        return std::make_tuple(std::move(decoded), nullptr);
     }
 
     auto err = Errors::New("This texture file format is not supported " + filePath);
-    return std::make_tuple(nullptr, std::move(err));
+    return std::make_tuple(std::move(decoded), std::move(err));
+}
+
+std::tuple<std::shared_ptr<Texture2D>, std::shared_ptr<Error>>
+AssetLoader<Texture2D>::Create(AssetManager& assets, DecodedAsset&& decoded)
+{
+    auto graphicsDevice = assets.GetGraphicsDevice();
+    POMDOG_ASSERT(graphicsDevice);
+
+    const auto& image = decoded.Image;
+    POMDOG_ASSERT(image.PixelData != nullptr);
+    POMDOG_ASSERT(image.ByteLength > 0);
+
+    // NOTE: Texture2D allocates either one level or the full mipmap chain.
+    // An image that contains the full chain, e.g. a DDS file cooked by
+    // `tools/cook_textures`, is uploaded as is without transcoding. Only the
+    // top level of a partial chain is used.
+    const bool hasMipmaps = (image.MipmapCount > 1) &&
+        (image.MipmapCount == TextureHelper::ComputeMipmapLevelCount(image.Width, image.Height));
+
+    auto texture = std::make_shared<Texture2D>(
+        graphicsDevice,
+        image.Width,
+        image.Height,
+        hasMipmaps,
+        image.Format);
+
+    texture->SetData(image.PixelData);
+
+    return std::make_tuple(std::move(texture), nullptr);
+}
+
+std::size_t AssetLoader<Texture2D>::GetByteSize(const Texture2D& texture)
+{
+    const auto sizeInBytes = TextureHelper::ComputeTextureSizeInBytes(
+        texture.GetWidth(),
+        texture.GetHeight(),
+        texture.GetLevelCount(),
+        texture.GetFormat());
+    POMDOG_ASSERT(sizeInBytes >= 0);
+    return static_cast<std::size_t>(sizeInBytes);
 }
 
 } // namespace Pomdog::Detail
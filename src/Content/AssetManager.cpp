@@ -1,22 +1,368 @@
 // Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
 
 #include "Pomdog/Content/AssetManager.hpp"
+#include "AssetArchive.hpp"
+#include "Pomdog/Basic/Platform.hpp"
+#if defined(POMDOG_PLATFORM_LINUX)
+#include "../Platform.Linux/FileWatcherLinux.hpp"
+#endif
+#include "Pomdog/Logging/Log.hpp"
 #include "Pomdog/Utility/FileSystem.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <string_view>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace Pomdog {
+namespace {
+
+constexpr unsigned int MaxWorkerThreadCount = 4;
+
+/// Returns the key of `keyIndices` for a file path, so that the paths that
+/// GetAssetPath() builds from asset names and the paths that the file watcher
+/// reports agree on the same file.
+std::string ToAssetKeyPath(const std::string& filePath)
+{
+    return PathHelper::ToSlash(PathHelper::Normalize(filePath));
+}
+
+} // namespace
+
+class AssetManager::WorkerPool final {
+public:
+    explicit WorkerPool(unsigned int threadCount);
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    ~WorkerPool();
+
+    void Schedule(std::function<void()>&& work);
+
+private:
+    void Run();
+
+private:
+    std::vector<std::thread> threads;
+    std::deque<std::function<void()>> works;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool isShutdown = false;
+};
+
+AssetManager::WorkerPool::WorkerPool(unsigned int threadCount)
+{
+    POMDOG_ASSERT(threadCount > 0);
+    threads.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        threads.emplace_back([this] { Run(); });
+    }
+}
+
+AssetManager::WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isShutdown = true;
+    }
+    condition.notify_all();
+
+    for (auto& thread : threads) {
+        POMDOG_ASSERT(thread.joinable());
+        thread.join();
+    }
+}
+
+void AssetManager::WorkerPool::Schedule(std::function<void()>&& work)
+{
+    POMDOG_ASSERT(work);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        works.push_back(std::move(work));
+    }
+    condition.notify_one();
+}
+
+void AssetManager::WorkerPool::Run()
+{
+    for (;;) {
+        std::function<void()> work;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this] { return isShutdown || !works.empty(); });
+
+            // NOTE: The remaining works are discarded on shutdown because
+            // nobody is going to complete the assets that they decode.
+            if (isShutdown) {
+                return;
+            }
+            work = std::move(works.front());
+            works.pop_front();
+        }
+        work();
+    }
+}
+
+#if defined(POMDOG_PLATFORM_LINUX)
+class AssetManager::FileWatcher final {
+public:
+    [[nodiscard]] std::shared_ptr<Error>
+    Watch(const std::string& directory)
+    {
+        return nativeWatcher.Watch(directory);
+    }
+
+    void Poll(std::vector<std::string>& changedFilePaths)
+    {
+        nativeWatcher.Poll(changedFilePaths);
+    }
+
+private:
+    Detail::Linux::FileWatcherLinux nativeWatcher;
+};
+#else
+class AssetManager::FileWatcher final {
+public:
+    [[nodiscard]] std::shared_ptr<Error>
+    Watch([[maybe_unused]] const std::string& directory)
+    {
+        return Errors::New("hot reloading is not supported on this platform");
+    }
+
+    void Poll([[maybe_unused]] std::vector<std::string>& changedFilePaths)
+    {
+    }
+};
+#endif
 
 AssetManager::AssetManager(
     const std::string& contentDirectoryIn,
     const std::shared_ptr<GraphicsDevice>& graphicsDeviceIn)
     : contentDirectory(contentDirectoryIn)
     , graphicsDevice(graphicsDeviceIn)
+    , memoryBudget(std::numeric_limits<std::size_t>::max())
 {
 }
 
+AssetManager::~AssetManager() = default;
+
+void AssetManager::Update()
+{
+    creationQueue.Update();
+
+    if (fileWatcher != nullptr) {
+        ReloadChangedAssets();
+    }
+}
+
+void AssetManager::ScheduleDecoding(std::function<void()>&& work)
+{
+    if (workerPool == nullptr) {
+        // NOTE: One core is left for the thread that calls Update().
+        const auto concurrency = std::max(std::thread::hardware_concurrency(), 2u);
+        const auto threadCount = std::min(concurrency - 1, MaxWorkerThreadCount);
+        workerPool = std::make_unique<WorkerPool>(threadCount);
+    }
+    workerPool->Schedule(std::move(work));
+}
+
+void AssetManager::ParallelFor(std::size_t count, const std::function<void(std::size_t)>& func)
+{
+    POMDOG_ASSERT(func);
+
+    if (count <= 1) {
+        for (std::size_t index = 0; index < count; ++index) {
+            func(index);
+        }
+        return;
+    }
+
+    struct SharedState final {
+        std::atomic<std::size_t> nextIndex{0};
+        std::size_t finishedCount = 0;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+    auto state = std::make_shared<SharedState>();
+
+    // NOTE: The threads take the next index one by one, so that a few large
+    // images do not keep the other threads waiting. `func` is only called for
+    // an index that has been taken, so a worker that starts after the last
+    // index has been taken returns without touching it.
+    auto work = [state, count, &func] {
+        for (;;) {
+            const auto index = state->nextIndex.fetch_add(1);
+            if (index >= count) {
+                return;
+            }
+            func(index);
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (++state->finishedCount == count) {
+                state->condition.notify_all();
+            }
+        }
+    };
+
+    const auto helperCount = std::min(count - 1, static_cast<std::size_t>(MaxWorkerThreadCount));
+    for (std::size_t i = 0; i < helperCount; ++i) {
+        ScheduleDecoding(work);
+    }
+
+    // NOTE: The calling thread also works instead of waiting idly. This also
+    // keeps this function from blocking forever when it is called on a worker
+    // thread and the other workers are busy.
+    work();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&] { return state->finishedCount == count; });
+}
+
+AssetKey AssetManager::MakeAssetKey(const std::string& assetName)
+{
+    auto filePath = GetAssetPath(assetName);
+    auto path = ToAssetKeyPath(filePath);
+
+    if (auto iter = keyIndices.find(path); iter != std::end(keyIndices)) {
+        return AssetKey{iter->second};
+    }
+
+    POMDOG_ASSERT(assets.size() < AssetKey::InvalidIndex);
+    const auto index = static_cast<std::uint32_t>(assets.size());
+
+    keyIndices.emplace(std::move(path), index);
+    keyFilePaths.push_back(std::move(filePath));
+    assets.emplace_back();
+
+    POMDOG_ASSERT(keyFilePaths.size() == assets.size());
+    return AssetKey{index};
+}
+
 void AssetManager::Unload()
 {
-    assets.clear();
+    // NOTE: The keys are kept so that they stay valid.
+    for (auto& entry : assets) {
+        entry = AssetEntry{};
+    }
+    memoryUsageByType.clear();
+    memoryUsage = 0;
+}
+
+void AssetManager::Unload(const std::string& assetName)
+{
+    const auto path = ToAssetKeyPath(GetAssetPath(assetName));
+    if (auto iter = keyIndices.find(path); iter != std::end(keyIndices)) {
+        EraseAsset(iter->second);
+    }
+}
+
+void AssetManager::Unload(const AssetKey& key)
+{
+    POMDOG_ASSERT(key.index < assets.size());
+    EraseAsset(key.index);
+}
+
+void AssetManager::SetMemoryBudget(std::size_t budgetInBytes)
+{
+    memoryBudget = budgetInBytes;
+    EvictUnusedAssets();
+}
+
+std::size_t AssetManager::GetMemoryBudget() const noexcept
+{
+    return memoryBudget;
+}
+
+std::size_t AssetManager::GetMemoryUsage() const noexcept
+{
+    return memoryUsage;
+}
+
+std::size_t AssetManager::GetMemoryUsage(std::type_index type) const noexcept
+{
+    if (auto iter = memoryUsageByType.find(type); iter != std::end(memoryUsageByType)) {
+        return iter->second;
+    }
+    return 0;
+}
+
+void AssetManager::StoreAsset(
+    std::uint32_t index,
+    const std::shared_ptr<void>& asset,
+    std::type_index type,
+    std::size_t byteSize,
+    ReloadFunction reload)
+{
+    POMDOG_ASSERT(asset != nullptr);
+
+    // NOTE: An asset of another type loaded from the same path is replaced.
+    EraseAsset(index);
+
+    auto& entry = assets[index];
+    entry.Asset = asset;
+    entry.Type = type;
+    entry.ByteSize = byteSize;
+    entry.LastAccess = ++accessCount;
+    entry.Reload = reload;
+
+    memoryUsage += byteSize;
+    memoryUsageByType[type] += byteSize;
+
+    EvictUnusedAssets();
+}
+
+void AssetManager::EraseAsset(std::uint32_t index)
+{
+    POMDOG_ASSERT(index < assets.size());
+
+    auto& entry = assets[index];
+    if (entry.Asset == nullptr) {
+        return;
+    }
+
+    POMDOG_ASSERT(memoryUsage >= entry.ByteSize);
+    memoryUsage -= entry.ByteSize;
+
+    if (auto usage = memoryUsageByType.find(entry.Type); usage != std::end(memoryUsageByType)) {
+        POMDOG_ASSERT(usage->second >= entry.ByteSize);
+        usage->second -= entry.ByteSize;
+    }
+
+    entry = AssetEntry{};
+}
+
+void AssetManager::EvictUnusedAssets()
+{
+    if (memoryUsage <= memoryBudget) {
+        return;
+    }
+
+    // NOTE: Disposing an asset that is referenced elsewhere frees no memory,
+    // so only the assets that this manager solely owns are candidates.
+    std::vector<std::uint32_t> candidates;
+    for (std::uint32_t index = 0; index < assets.size(); ++index) {
+        const auto& entry = assets[index];
+        if ((entry.ByteSize > 0) && (entry.Asset.use_count() == 1)) {
+            candidates.push_back(index);
+        }
+    }
+
+    std::sort(std::begin(candidates), std::end(candidates), [this](std::uint32_t a, std::uint32_t b) {
+        return assets[a].LastAccess < assets[b].LastAccess;
+    });
+
+    for (auto index : candidates) {
+        if (memoryUsage <= memoryBudget) {
+            break;
+        }
+        EraseAsset(index);
+    }
 }
 
 std::string AssetManager::GetContentDirectory() const
@@ -43,4 +389,147 @@ std::string AssetManager::GetAssetPath(const std::string& assetName) const
     return PathHelper::Join(contentDirectory, assetName);
 }
 
+std::shared_ptr<Error> AssetManager::Mount(const std::string& archivePath)
+{
+    // NOTE: The workers read `archives` without locking.
+    POMDOG_ASSERT(pendingLoads.empty());
+
+    auto [archive, err] = Detail::AssetArchive::Open(archivePath);
+    if (err != nullptr) {
+        return Errors::Wrap(std::move(err), "failed to mount the asset archive");
+    }
+
+    POMDOG_ASSERT(archive != nullptr);
+    archives.push_back(std::move(archive));
+    return nullptr;
+}
+
+void AssetManager::UnmountAll()
+{
+    POMDOG_ASSERT(pendingLoads.empty());
+    archives.clear();
+}
+
+std::shared_ptr<Error> AssetManager::EnableHotReload()
+{
+    if (fileWatcher != nullptr) {
+        return nullptr;
+    }
+
+    auto watcher = std::make_unique<FileWatcher>();
+    if (auto err = watcher->Watch(contentDirectory); err != nullptr) {
+        return Errors::Wrap(std::move(err), "failed to watch the content directory");
+    }
+
+    fileWatcher = std::move(watcher);
+    return nullptr;
+}
+
+void AssetManager::DisableHotReload()
+{
+    fileWatcher.reset();
+    changedFilePaths.clear();
+}
+
+void AssetManager::ReloadChangedAssets()
+{
+    POMDOG_ASSERT(fileWatcher != nullptr);
+
+    changedFilePaths.clear();
+    fileWatcher->Poll(changedFilePaths);
+    if (changedFilePaths.empty()) {
+        return;
+    }
+
+    // NOTE: A file that is written several times within a frame is reloaded once.
+    std::sort(std::begin(changedFilePaths), std::end(changedFilePaths));
+    changedFilePaths.erase(
+        std::unique(std::begin(changedFilePaths), std::end(changedFilePaths)),
+        std::end(changedFilePaths));
+
+    for (const auto& filePath : changedFilePaths) {
+        // NOTE: If the asset is not loaded, the next Load() reads the new file.
+        if (auto iter = keyIndices.find(ToAssetKeyPath(filePath)); iter != std::end(keyIndices)) {
+            const auto index = iter->second;
+            POMDOG_ASSERT(index < assets.size());
+
+            if (assets[index].Asset != nullptr) {
+                if (auto err = RefreshAsset(index); err != nullptr) {
+                    Log::Warning("Pomdog", "failed to reload the asset, " + err->ToString());
+                    continue;
+                }
+            }
+        }
+
+        AssetFileChanged(filePath);
+    }
+
+    EvictUnusedAssets();
+}
+
+std::shared_ptr<Error> AssetManager::RefreshAsset(std::uint32_t index)
+{
+    POMDOG_ASSERT(index < assets.size());
+    POMDOG_ASSERT(assets[index].Asset != nullptr);
+
+    const auto reload = assets[index].Reload;
+    if (reload == nullptr) {
+        EraseAsset(index);
+        return nullptr;
+    }
+
+    // NOTE: The path and the asset are copied because loaders can intern
+    // other assets, which reallocates `keyFilePaths` and `assets`.
+    const auto filePath = keyFilePaths[index];
+    const auto asset = assets[index].Asset;
+
+    auto [byteSize, err] = reload(*this, filePath, asset.get());
+    if (err != nullptr) {
+        return err;
+    }
+
+    auto& entry = assets[index];
+    POMDOG_ASSERT(entry.Asset == asset);
+    POMDOG_ASSERT(memoryUsage >= entry.ByteSize);
+    memoryUsage = memoryUsage - entry.ByteSize + byteSize;
+
+    auto& usage = memoryUsageByType[entry.Type];
+    POMDOG_ASSERT(usage >= entry.ByteSize);
+    usage = usage - entry.ByteSize + byteSize;
+
+    entry.ByteSize = byteSize;
+    entry.LastAccess = ++accessCount;
+    return nullptr;
+}
+
+std::tuple<MappedFile, std::shared_ptr<Error>>
+AssetManager::OpenAssetFile(const std::string& filePath) const
+{
+    if (!archives.empty()) {
+        // NOTE: The archives are indexed by the paths relative to the
+        // content directory.
+        const auto path = PathHelper::ToSlash(filePath);
+        const auto directory = PathHelper::ToSlash(contentDirectory);
+
+        std::string_view name = path;
+        if (!directory.empty()) {
+            const bool isInDirectory = (name.size() > directory.size()) &&
+                (name.compare(0, directory.size(), directory) == 0) &&
+                (name[directory.size()] == '/');
+            name = isInDirectory ? name.substr(directory.size() + 1) : std::string_view{};
+        }
+
+        if (!name.empty()) {
+            for (auto iter = std::rbegin(archives); iter != std::rend(archives); ++iter) {
+                const auto& archive = *iter;
+                if (auto entry = archive->Find(name); entry != nullptr) {
+                    return archive->OpenEntry(*entry);
+                }
+            }
+        }
+    }
+
+    return MappedFile::Open(filePath);
+}
+
 } // namespace Pomdog
@@ -14,6 +14,7 @@
 
 #include "../../Basic/ConditionalCompilation.hpp"
 #include "Pomdog/Audio/AudioClip.hpp"
+#include "Pomdog/Audio/AudioStream.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 
 #if defined(__clang__)
@@ -48,6 +49,9 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
+#include <limits>
+#include <string>
 #include <utility>
 
 namespace Pomdog::Vorbis {
@@ -102,18 +106,10 @@ struct PCMWaveFormat final {
     return AudioChannels::Mono;
 }
 
-} // namespace
-
-std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
-Load(const std::string& filename)
+[[nodiscard]] std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
+DecodeVorbis(stb_vorbis* vorbis)
 {
-    int error = 0;
-    auto vorbis = stb_vorbis_open_filename(filename.data(), &error, nullptr);
-
-    if (error != 0) {
-        auto err = Errors::New("failed to read ogg/vorbis file " + filename);
-        return std::make_tuple(nullptr, std::move(err));
-    }
+    POMDOG_ASSERT(vorbis != nullptr);
 
     auto info = stb_vorbis_get_info(vorbis);
 
@@ -188,4 +184,155 @@ Load(const std::string& filename)
     return std::make_tuple(std::move(audioClip), nullptr);
 }
 
+class VorbisStream final : public AudioStream {
+public:
+    VorbisStream(MappedFile&& fileIn, stb_vorbis* vorbisIn)
+        : file(std::move(fileIn))
+        , vorbis(vorbisIn)
+    {
+        POMDOG_ASSERT(vorbis != nullptr);
+        info = stb_vorbis_get_info(vorbis);
+        frameCount = stb_vorbis_stream_length_in_samples(vorbis);
+    }
+
+    VorbisStream(const VorbisStream&) = delete;
+    VorbisStream& operator=(const VorbisStream&) = delete;
+
+    ~VorbisStream() override
+    {
+        stb_vorbis_close(vorbis);
+    }
+
+    int GetSampleRate() const noexcept override
+    {
+        return static_cast<int>(info.sample_rate);
+    }
+
+    AudioChannels GetChannels() const noexcept override
+    {
+        return ToAudioChannels(info.channels);
+    }
+
+    std::size_t GetFrameCount() const noexcept override
+    {
+        return frameCount;
+    }
+
+    std::size_t Read(std::int16_t* samples, std::size_t count) override
+    {
+        POMDOG_ASSERT(samples != nullptr);
+
+        const auto maxCount = static_cast<std::size_t>(std::numeric_limits<int>::max() / info.channels);
+        const auto shortCount = static_cast<int>(std::min(count, maxCount)) * info.channels;
+
+        if (isEndOfStream) {
+            return 0;
+        }
+
+        const int decoded = stb_vorbis_get_samples_short_interleaved(
+            vorbis, info.channels, reinterpret_cast<short*>(samples), shortCount);
+        return static_cast<std::size_t>(std::max(decoded, 0));
+    }
+
+    bool Seek(std::size_t frame) override
+    {
+        if (frame > frameCount) {
+            return false;
+        }
+
+        // NOTE: stb_vorbis cannot seek past the last sample, so the end of
+        // stream is kept as a flag until the next seek.
+        isEndOfStream = (frame == frameCount);
+        if (isEndOfStream) {
+            return true;
+        }
+        if (frame == 0) {
+            return stb_vorbis_seek_start(vorbis) != 0;
+        }
+        return stb_vorbis_seek(vorbis, static_cast<unsigned int>(frame)) != 0;
+    }
+
+private:
+    // NOTE: stb_vorbis decodes the mapped file in place.
+    MappedFile file;
+    stb_vorbis* vorbis = nullptr;
+    stb_vorbis_info info;
+    std::size_t frameCount = 0;
+    bool isEndOfStream = false;
+};
+
+} // namespace
+
+std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
+Load(const std::string& filename)
+{
+    int error = 0;
+    auto vorbis = stb_vorbis_open_filename(filename.data(), &error, nullptr);
+
+    if (error != 0) {
+        auto err = Errors::New("failed to read ogg/vorbis file " + filename);
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    return DecodeVorbis(vorbis);
+}
+
+std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
+Load(const std::uint8_t* data, std::size_t byteLength)
+{
+    POMDOG_ASSERT(data != nullptr);
+
+    if (byteLength > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+        auto err = Errors::New("the ogg/vorbis data is too large");
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    int error = 0;
+    auto vorbis = stb_vorbis_open_memory(data, static_cast<int>(byteLength), &error, nullptr);
+
+    if (error != 0) {
+        auto err = Errors::New("failed to read ogg/vorbis data");
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    return DecodeVorbis(vorbis);
+}
+
+std::tuple<std::unique_ptr<AudioStream>, std::shared_ptr<Error>>
+OpenStream(const std::string& filename)
+{
+    auto [file, err] = MappedFile::Open(filename);
+    if (err != nullptr) {
+        return std::make_tuple(nullptr, Errors::Wrap(std::move(err), "failed to open ogg/vorbis file " + filename));
+    }
+    return OpenStream(std::move(file));
+}
+
+std::tuple<std::unique_ptr<AudioStream>, std::shared_ptr<Error>>
+OpenStream(MappedFile&& file)
+{
+    if ((file.GetData() == nullptr) || (file.GetSize() > static_cast<std::size_t>(std::numeric_limits<int>::max()))) {
+        auto err = Errors::New("invalid size of the ogg/vorbis data");
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    int error = 0;
+    auto vorbis = stb_vorbis_open_memory(file.GetData(), static_cast<int>(file.GetSize()), &error, nullptr);
+
+    if (error != 0) {
+        auto err = Errors::New("failed to read ogg/vorbis data");
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    POMDOG_ASSERT(vorbis != nullptr);
+    if (const auto info = stb_vorbis_get_info(vorbis); (info.channels < 1) || (info.channels > 2)) {
+        stb_vorbis_close(vorbis);
+        auto err = Errors::New("unsupported number of channels " + std::to_string(info.channels));
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    auto stream = std::make_unique<VorbisStream>(std::move(file), vorbis);
+    return std::make_tuple(std::move(stream), nullptr);
+}
+
 } // namespace Pomdog::Vorbis
@@ -77,15 +77,38 @@ struct WaveFormat final {
     std::vector<std::uint8_t> ExtraData;
 };
 
+/// A cursor that reads the wave file from memory.
+struct WaveReader final {
+    const std::uint8_t* Data = nullptr;
+    std::size_t Size = 0;
+    std::size_t Offset = 0;
+
+    template <typename T>
+    [[nodiscard]] bool CanRead() const noexcept
+    {
+        POMDOG_ASSERT(Offset <= Size);
+        return BinaryReader::CanRead<T>(Size - Offset);
+    }
+
+    template <typename T>
+    [[nodiscard]] T Read() noexcept
+    {
+        POMDOG_ASSERT(CanRead<T>());
+        auto value = BinaryReader::Read<T>(Data + Offset);
+        Offset += sizeof(T);
+        return value;
+    }
+};
+
 [[nodiscard]] std::shared_ptr<Error>
-ReadRIFFChunk(std::ifstream& stream)
+ReadRIFFChunk(WaveReader& reader)
 {
-    const auto riffChunk = BinaryReader::Read<RIFFChunk>(stream);
-
-    if (stream.fail()) {
+    if (!reader.CanRead<RIFFChunk>()) {
         return Errors::New("failed to read read RiffChunk");
     }
 
+    const auto riffChunk = reader.Read<RIFFChunk>();
+
     if (riffChunk.ChunkID != MakeFourCC('R', 'I', 'F', 'F')) {
         return Errors::New("missing RIFF chunk");
     }
@@ -97,15 +120,15 @@ ReadRIFFChunk(std::ifstream& stream)
 }
 
 [[nodiscard]] std::tuple<WaveFormat, std::shared_ptr<Error>>
-ReadWaveFormat(std::ifstream& stream)
+ReadWaveFormat(WaveReader& reader)
 {
-    const auto fmtChunkHeader = BinaryReader::Read<SubChunkHeader>(stream);
-
-    if (stream.fail()) {
+    if (!reader.CanRead<SubChunkHeader>()) {
         auto err = Errors::New("failed to read SubChunkHeader");
         return std::make_tuple(WaveFormat{}, std::move(err));
     }
 
+    const auto fmtChunkHeader = reader.Read<SubChunkHeader>();
+
     if (fmtChunkHeader.ChunkID != MakeFourCC('f', 'm', 't', ' ')) {
         auto err = Errors::New("cannot find the 'fmt ' chunk");
         return std::make_tuple(WaveFormat{}, std::move(err));
@@ -115,15 +138,15 @@ ReadWaveFormat(std::ifstream& stream)
         return std::make_tuple(WaveFormat{}, std::move(err));
     }
 
-    WaveFormat waveFormat;
-    waveFormat.PCMFormat = BinaryReader::Read<PCMWaveFormat>(stream);
-    waveFormat.ExtraBytes = 0;
-
-    if (stream.fail()) {
+    if (!reader.CanRead<PCMWaveFormat>()) {
         auto err = Errors::New("failed to read the 'fmt ' chunk into PCMWaveFormat");
-        return std::make_tuple(std::move(waveFormat), std::move(err));
+        return std::make_tuple(WaveFormat{}, std::move(err));
     }
 
+    WaveFormat waveFormat;
+    waveFormat.PCMFormat = reader.Read<PCMWaveFormat>();
+    waveFormat.ExtraBytes = 0;
+
     // NOTE: WAVE_FORMAT_PCM
     constexpr std::uint16_t WaveFormatTagPCM = 0x0001;
 
@@ -132,35 +155,35 @@ ReadWaveFormat(std::ifstream& stream)
         waveFormat.ExtraData.clear();
     }
     else {
-        waveFormat.ExtraBytes = BinaryReader::Read<std::uint16_t>(stream);
-        if (stream.fail()) {
+        if (!reader.CanRead<std::uint16_t>()) {
             auto err = Errors::New("failed to read read the extra bytes");
             return std::make_tuple(std::move(waveFormat), std::move(err));
         }
+        waveFormat.ExtraBytes = reader.Read<std::uint16_t>();
 
-        waveFormat.ExtraData.resize(waveFormat.ExtraBytes);
-        stream.read(reinterpret_cast<char*>(waveFormat.ExtraData.data()), waveFormat.ExtraBytes);
-
-        if (stream.fail()) {
+        if ((reader.Size - reader.Offset) < waveFormat.ExtraBytes) {
             auto err = Errors::New("failed to read read the extra data");
             return std::make_tuple(std::move(waveFormat), std::move(err));
         }
+
+        const auto extraData = reader.Data + reader.Offset;
+        waveFormat.ExtraData.assign(extraData, extraData + waveFormat.ExtraBytes);
+        reader.Offset += waveFormat.ExtraBytes;
     }
 
     return std::make_tuple(std::move(waveFormat), nullptr);
 }
 
 [[nodiscard]] std::tuple<std::vector<std::uint8_t>, std::shared_ptr<Error>>
-ReadWaveAudioData(std::ifstream& stream)
+ReadWaveAudioData(WaveReader& reader)
 {
-    POMDOG_ASSERT(stream);
-
-    const auto chunkHeader = BinaryReader::Read<SubChunkHeader>(stream);
-
-    if (stream.fail()) {
+    if (!reader.CanRead<SubChunkHeader>()) {
         auto err = Errors::New("failed to read 'data' chunk header");
         return std::make_tuple(std::vector<std::uint8_t>{}, std::move(err));
     }
+
+    const auto chunkHeader = reader.Read<SubChunkHeader>();
+
     if (chunkHeader.ChunkID != MakeFourCC('d', 'a', 't', 'a')) {
         auto err = Errors::New("cannot find the 'data' chunk");
         return std::make_tuple(std::vector<std::uint8_t>{}, std::move(err));
@@ -169,18 +192,16 @@ ReadWaveAudioData(std::ifstream& stream)
         auto err = Errors::New("data chunk is empty");
         return std::make_tuple(std::vector<std::uint8_t>{}, std::move(err));
     }
-
-    std::vector<std::uint8_t> audioData;
-    audioData.resize(chunkHeader.ChunkSize);
-
-    for (auto& dest : audioData) {
-        dest = BinaryReader::Read<std::uint8_t>(stream);
-        if (stream.fail()) {
-            auto err = Errors::New("failed to read wave data");
-            return std::make_tuple(std::move(audioData), std::move(err));
-        }
+    if ((reader.Size - reader.Offset) < chunkHeader.ChunkSize) {
+        auto err = Errors::New("failed to read wave data");
+        return std::make_tuple(std::vector<std::uint8_t>{}, std::move(err));
     }
 
+    // NOTE: The samples are copied at once instead of byte by byte.
+    const auto audioBegin = reader.Data + reader.Offset;
+    std::vector<std::uint8_t> audioData(audioBegin, audioBegin + chunkHeader.ChunkSize);
+    reader.Offset += chunkHeader.ChunkSize;
+
     return std::make_tuple(std::move(audioData), nullptr);
 }
 
@@ -204,28 +225,47 @@ ReadWaveAudioData(std::ifstream& stream)
 
 [[nodiscard]] std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
 Load(std::ifstream&& stream, std::size_t byteLength)
+{
+    if (!stream) {
+        return std::make_tuple(nullptr, Errors::New("invalid file stream"));
+    }
+
+    std::vector<std::uint8_t> binary(byteLength);
+    stream.read(reinterpret_cast<char*>(binary.data()), binary.size());
+    if (stream.fail()) {
+        return std::make_tuple(nullptr, Errors::New("failed to read the wave file"));
+    }
+
+    return Load(binary.data(), binary.size());
+}
+
+[[nodiscard]] std::tuple<std::shared_ptr<AudioClip>, std::shared_ptr<Error>>
+Load(const std::uint8_t* data, std::size_t byteLength)
 {
     constexpr auto MinimumWaveFormatSizeInBytes = 4 * 11;
     if (byteLength < MinimumWaveFormatSizeInBytes) {
         return std::make_tuple(nullptr, Errors::New("the wave file is too small"));
     }
 
-    if (!stream) {
-        return std::make_tuple(nullptr, Errors::New("invalid file stream"));
-    }
+    POMDOG_ASSERT(data != nullptr);
+
+    WaveReader reader;
+    reader.Data = data;
+    reader.Size = byteLength;
+    reader.Offset = 0;
 
-    if (auto readErr = ReadRIFFChunk(stream); readErr != nullptr) {
+    if (auto readErr = ReadRIFFChunk(reader); readErr != nullptr) {
         auto err = Errors::Wrap(std::move(readErr), "cannot read the wave file");
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    auto [waveFormat, waveFormatErr] = ReadWaveFormat(stream);
+    auto [waveFormat, waveFormatErr] = ReadWaveFormat(reader);
     if (waveFormatErr != nullptr) {
         auto err = Errors::Wrap(std::move(waveFormatErr), "cannot read the wave format");
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    auto [audioData, audioDataErr] = ReadWaveAudioData(stream);
+    auto [audioData, audioDataErr] = ReadWaveAudioData(reader);
     if (audioDataErr != nullptr) {
         auto err = Errors::Wrap(std::move(audioDataErr), "cannot read the wave audio data");
         return std::make_tuple(nullptr, std::move(err));
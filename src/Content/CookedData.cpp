@@ -0,0 +1,99 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Content/Utility/CookedData.hpp"
+#include "Pomdog/Content/Utility/BinaryReader.hpp"
+#include <string>
+
+namespace Pomdog::Detail {
+namespace {
+
+constexpr std::uint32_t SectionAlignment = 8;
+
+[[nodiscard]] bool IsInRange(std::uint64_t offset, std::uint64_t size, std::size_t fileSize) noexcept
+{
+    return (offset <= fileSize) && (size <= fileSize - offset);
+}
+
+} // namespace
+
+bool CookedDataReader::HasSignature(const std::uint8_t* data, std::size_t size, std::uint32_t signature) noexcept
+{
+    if (!BinaryReader::CanRead<std::uint32_t>(size)) {
+        return false;
+    }
+    return BinaryReader::Read<std::uint32_t>(data) == signature;
+}
+
+std::shared_ptr<Error>
+CookedDataReader::Open(
+    const std::uint8_t* dataIn,
+    std::size_t size,
+    std::uint32_t signature,
+    std::uint32_t version,
+    std::uint32_t sectionCountIn)
+{
+    POMDOG_ASSERT(sectionCountIn > 0);
+    valid = false;
+
+    if (!BinaryReader::CanRead<CookedDataHeader>(size)) {
+        return Errors::New("the file is too small");
+    }
+
+    const auto header = BinaryReader::Read<CookedDataHeader>(dataIn);
+    if (header.Signature != signature) {
+        return Errors::New("the signature does not match");
+    }
+    if (header.Version != version) {
+        return Errors::New("unsupported version " + std::to_string(header.Version));
+    }
+    if (header.SectionCount != sectionCountIn) {
+        return Errors::New("the number of sections does not match");
+    }
+
+    // NOTE: The records are read in place, so the sections must be aligned.
+    // Mapped files and buffers are aligned at least to 8 bytes.
+    if ((reinterpret_cast<std::uintptr_t>(dataIn) % SectionAlignment) != 0) {
+        return Errors::New("the data is not aligned");
+    }
+
+    const auto tableSize = static_cast<std::uint64_t>(header.SectionCount) * sizeof(CookedDataSection);
+    if (!IsInRange(sizeof(CookedDataHeader), tableSize, size)) {
+        return Errors::New("the section table is out of range");
+    }
+
+    auto table = reinterpret_cast<const CookedDataSection*>(dataIn + sizeof(CookedDataHeader));
+    for (std::uint32_t i = 0; i < header.SectionCount; ++i) {
+        if (!IsInRange(table[i].Offset, table[i].Size, size)) {
+            return Errors::New("a section is out of range");
+        }
+        if ((table[i].Offset % SectionAlignment) != 0) {
+            return Errors::New("a section is not aligned");
+        }
+    }
+
+    data = dataIn;
+    sections = table;
+    sectionCount = header.SectionCount;
+    valid = true;
+    return nullptr;
+}
+
+std::string_view CookedDataReader::GetString(const CookedString& s) noexcept
+{
+    POMDOG_ASSERT(sectionCount > 0);
+
+    // NOTE: The first section holds the characters of the strings.
+    const auto& section = sections[0];
+    if (!IsInRange(s.Offset, s.Length, section.Size)) {
+        valid = false;
+        return {};
+    }
+    return std::string_view{reinterpret_cast<const char*>(data + section.Offset + s.Offset), s.Length};
+}
+
+bool CookedDataReader::IsValid() const noexcept
+{
+    return valid;
+}
+
+} // namespace Pomdog::Detail
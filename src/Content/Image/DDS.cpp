@@ -2,14 +2,17 @@
 
 #include "Pomdog/Content/Image/DDS.hpp"
 #include "../../Basic/ConditionalCompilation.hpp"
+#include "../../RenderSystem/TextureHelper.hpp"
 #include "Pomdog/Content/Utility/BinaryReader.hpp"
 #include "Pomdog/Content/Utility/MakeFourCC.hpp"
 #include "Pomdog/Graphics/SurfaceFormat.hpp"
 #include "Pomdog/Utility/Assert.hpp"
+#include <algorithm>
 #include <optional>
 
 using Pomdog::Detail::BinaryReader;
 using Pomdog::Detail::MakeFourCC;
+using Pomdog::Detail::TextureHelper;
 
 namespace Pomdog::DDS {
 namespace {
@@ -181,40 +184,6 @@ ToSurfaceFormat(const DDSPixelFormat& pixelFormat)
     return std::nullopt;
 }
 
-[[nodiscard]] std::size_t
-ComputePixelDataByteLength(const DDSHeader& ddsHeader, SurfaceFormat format)
-{
-    const auto levelCount = (ddsHeader.MipMapCount > 0) ? ddsHeader.MipMapCount : 1;
-
-    const auto bytesPerBlock = [&format]() -> int {
-        switch (format) {
-        case SurfaceFormat::BlockComp1_UNorm:
-            return 8;
-        case SurfaceFormat::BlockComp2_UNorm:
-            return 16;
-        case SurfaceFormat::BlockComp3_UNorm:
-            return 16;
-        default:
-            break;
-        }
-        return 16;
-    }();
-
-    std::size_t result = 0;
-    std::size_t mipmapPixelWidth = ddsHeader.PixelWidth;
-    std::size_t mipmapPixelHeight = ddsHeader.PixelHeight;
-
-    for (std::uint32_t mipmapLevel = 0; mipmapLevel < levelCount; ++mipmapLevel) {
-        std::size_t const strideBytesPerMipMap = ((mipmapPixelWidth + 3) / 4) * ((mipmapPixelHeight + 3) / 4) * bytesPerBlock;
-
-        result += strideBytesPerMipMap;
-
-        mipmapPixelWidth = (mipmapPixelWidth >> 1) ? (mipmapPixelWidth >> 1) : 1;
-        mipmapPixelHeight = (mipmapPixelHeight >> 1) ? (mipmapPixelHeight >> 1) : 1;
-    }
-    return result;
-}
-
 } // namespace
 
 std::tuple<ImageBuffer, std::shared_ptr<Error>>
@@ -274,7 +243,18 @@ Decode(const std::uint8_t* data, std::size_t size)
     else {
         return std::make_tuple(std::move(image), Errors::New("cannot find the surface format. Undefined or not supported"));
     }
-    image.ByteLength = ComputePixelDataByteLength(ddsHeader, image.Format);
+
+    if ((image.Width <= 0) || (image.Height <= 0)) {
+        return std::make_tuple(std::move(image), Errors::New("dds header has an invalid size"));
+    }
+
+    const auto levelCount = std::max(image.MipmapCount, 1);
+    if (levelCount > TextureHelper::ComputeMipmapLevelCount(image.Width, image.Height)) {
+        return std::make_tuple(std::move(image), Errors::New("dds header has an invalid mipmap count"));
+    }
+
+    image.ByteLength = static_cast<std::size_t>(TextureHelper::ComputeTextureSizeInBytes(
+        image.Width, image.Height, levelCount, image.Format));
 
     if ((size - offsetBytes) < image.ByteLength) {
         return std::make_tuple(std::move(image), Errors::New("dds header has an invalid format"));
@@ -2,6 +2,7 @@
 
 #include "Pomdog/Content/Image/PNG.hpp"
 #include "../../Utility/ScopeGuard.hpp"
+#include "Pomdog/Content/AssetManager.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 extern "C" {
 #include <png.h>
@@ -159,4 +160,20 @@ Decode(const std::uint8_t* data, std::size_t byteLength)
     return std::make_tuple(std::move(image), nullptr);
 }
 
+std::vector<std::tuple<ImageBuffer, std::shared_ptr<Error>>>
+DecodeBatch(
+    AssetManager& assets,
+    const std::vector<std::tuple<const std::uint8_t*, std::size_t>>& sources)
+{
+    std::vector<std::tuple<ImageBuffer, std::shared_ptr<Error>>> results(sources.size());
+
+    // NOTE: Each image has its own libpng context, so they can be decoded in parallel.
+    assets.ParallelFor(sources.size(), [&](std::size_t index) {
+        const auto [data, byteLength] = sources[index];
+        results[index] = Decode(data, byteLength);
+    });
+
+    return results;
+}
+
 } // namespace Pomdog::PNG
@@ -0,0 +1,221 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Content/Image/PixelConversion.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define POMDOG_PIXELCONVERSION_USE_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define POMDOG_PIXELCONVERSION_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace Pomdog::PixelConversion {
+namespace {
+
+// NOTE: Computes round(color * alpha / 255) without division.
+// The SIMD paths use the same arithmetic, so that every path produces the same results.
+[[nodiscard]] std::uint8_t MultiplyAlpha(std::uint8_t color, std::uint8_t alpha) noexcept
+{
+    const auto t = static_cast<unsigned int>(color) * alpha + 128u;
+    return static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+}
+
+#if defined(POMDOG_PIXELCONVERSION_USE_SSE2)
+/// Premultiplies two pixels that are widened to 16-bit lanes.
+[[nodiscard]] __m128i MultiplyAlpha(__m128i pixels, __m128i alphaMask, __m128i alphaScale, __m128i bias) noexcept
+{
+    auto alpha = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+
+    // NOTE: The alpha channel is multiplied by 255, so that it is kept as is.
+    alpha = _mm_or_si128(_mm_andnot_si128(alphaMask, alpha), alphaScale);
+
+    const auto t = _mm_add_epi16(_mm_mullo_epi16(pixels, alpha), bias);
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+#elif defined(POMDOG_PIXELCONVERSION_USE_NEON)
+[[nodiscard]] uint8x16_t MultiplyAlpha(uint8x16_t color, uint8x16_t alpha) noexcept
+{
+    const auto lo = vmull_u8(vget_low_u8(color), vget_low_u8(alpha));
+    const auto hi = vmull_u8(vget_high_u8(color), vget_high_u8(alpha));
+
+    // NOTE: (t + ((t + 128) >> 8) + 128) >> 8 is equal to the scalar version.
+    return vcombine_u8(
+        vrshrn_n_u16(vrsraq_n_u16(lo, lo, 8), 8),
+        vrshrn_n_u16(vrsraq_n_u16(hi, hi, 8), 8));
+}
+#endif
+
+} // namespace
+
+void PremultiplyAlpha(std::uint8_t* pixels, std::size_t pixelCount) noexcept
+{
+    POMDOG_ASSERT(pixels != nullptr || pixelCount == 0);
+
+    std::size_t i = 0;
+
+#if defined(POMDOG_PIXELCONVERSION_USE_SSE2)
+    const auto zero = _mm_setzero_si128();
+    const auto alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const auto alphaScale = _mm_and_si128(alphaMask, _mm_set1_epi16(255));
+    const auto bias = _mm_set1_epi16(128);
+
+    for (; i + 4 <= pixelCount; i += 4) {
+        auto p = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const auto source = _mm_loadu_si128(p);
+        const auto lo = MultiplyAlpha(_mm_unpacklo_epi8(source, zero), alphaMask, alphaScale, bias);
+        const auto hi = MultiplyAlpha(_mm_unpackhi_epi8(source, zero), alphaMask, alphaScale, bias);
+        _mm_storeu_si128(p, _mm_packus_epi16(lo, hi));
+    }
+#elif defined(POMDOG_PIXELCONVERSION_USE_NEON)
+    for (; i + 16 <= pixelCount; i += 16) {
+        auto p = pixels + i * 4;
+        auto source = vld4q_u8(p);
+        source.val[0] = MultiplyAlpha(source.val[0], source.val[3]);
+        source.val[1] = MultiplyAlpha(source.val[1], source.val[3]);
+        source.val[2] = MultiplyAlpha(source.val[2], source.val[3]);
+        vst4q_u8(p, source);
+    }
+#endif
+
+    for (; i < pixelCount; ++i) {
+        auto p = pixels + i * 4;
+        const auto alpha = p[3];
+        p[0] = MultiplyAlpha(p[0], alpha);
+        p[1] = MultiplyAlpha(p[1], alpha);
+        p[2] = MultiplyAlpha(p[2], alpha);
+    }
+}
+
+void SwapRedBlue(std::uint8_t* pixels, std::size_t pixelCount) noexcept
+{
+    POMDOG_ASSERT(pixels != nullptr || pixelCount == 0);
+
+    std::size_t i = 0;
+
+#if defined(POMDOG_PIXELCONVERSION_USE_SSE2)
+    const auto redBlueMask = _mm_set1_epi32(0x00FF00FF);
+
+    for (; i + 4 <= pixelCount; i += 4) {
+        auto p = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const auto source = _mm_loadu_si128(p);
+        const auto greenAlpha = _mm_andnot_si128(redBlueMask, source);
+        const auto redBlue = _mm_and_si128(redBlueMask, source);
+        const auto blueRed = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+        _mm_storeu_si128(p, _mm_or_si128(greenAlpha, blueRed));
+    }
+#elif defined(POMDOG_PIXELCONVERSION_USE_NEON)
+    for (; i + 16 <= pixelCount; i += 16) {
+        auto p = pixels + i * 4;
+        auto source = vld4q_u8(p);
+        std::swap(source.val[0], source.val[2]);
+        vst4q_u8(p, source);
+    }
+#endif
+
+    for (; i < pixelCount; ++i) {
+        auto p = pixels + i * 4;
+        std::swap(p[0], p[2]);
+    }
+}
+
+void ConvertA8ToR8G8B8A8(
+    const std::uint8_t* source,
+    std::uint8_t* destination,
+    std::size_t pixelCount) noexcept
+{
+    POMDOG_ASSERT(source != nullptr || pixelCount == 0);
+    POMDOG_ASSERT(destination != nullptr || pixelCount == 0);
+
+    std::size_t i = 0;
+
+#if defined(POMDOG_PIXELCONVERSION_USE_SSE2)
+    const auto zero = _mm_setzero_si128();
+    const auto white = _mm_set1_epi32(0x00FFFFFF);
+
+    for (; i + 16 <= pixelCount; i += 16) {
+        const auto alpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+
+        // NOTE: Moves each alpha to the highest byte of the 32-bit lanes.
+        const auto lo = _mm_unpacklo_epi8(zero, alpha);
+        const auto hi = _mm_unpackhi_epi8(zero, alpha);
+
+        auto p = reinterpret_cast<__m128i*>(destination + i * 4);
+        _mm_storeu_si128(p + 0, _mm_or_si128(white, _mm_unpacklo_epi16(zero, lo)));
+        _mm_storeu_si128(p + 1, _mm_or_si128(white, _mm_unpackhi_epi16(zero, lo)));
+        _mm_storeu_si128(p + 2, _mm_or_si128(white, _mm_unpacklo_epi16(zero, hi)));
+        _mm_storeu_si128(p + 3, _mm_or_si128(white, _mm_unpackhi_epi16(zero, hi)));
+    }
+#elif defined(POMDOG_PIXELCONVERSION_USE_NEON)
+    const auto white = vdupq_n_u8(255);
+
+    for (; i + 16 <= pixelCount; i += 16) {
+        uint8x16x4_t pixels;
+        pixels.val[0] = white;
+        pixels.val[1] = white;
+        pixels.val[2] = white;
+        pixels.val[3] = vld1q_u8(source + i);
+        vst4q_u8(destination + i * 4, pixels);
+    }
+#endif
+
+    for (; i < pixelCount; ++i) {
+        auto p = destination + i * 4;
+        p[0] = 255;
+        p[1] = 255;
+        p[2] = 255;
+        p[3] = source[i];
+    }
+}
+
+void FillColorChannels(
+    std::uint8_t* pixels,
+    std::size_t pixelCount,
+    std::uint8_t red,
+    std::uint8_t green,
+    std::uint8_t blue) noexcept
+{
+    POMDOG_ASSERT(pixels != nullptr || pixelCount == 0);
+
+    std::size_t i = 0;
+
+#if defined(POMDOG_PIXELCONVERSION_USE_SSE2)
+    // NOTE: The pixels are loaded as little-endian 32-bit lanes, so the alpha is the highest byte.
+    const auto alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    const auto color = _mm_set1_epi32(static_cast<int>(
+        static_cast<std::uint32_t>(red) |
+        (static_cast<std::uint32_t>(green) << 8) |
+        (static_cast<std::uint32_t>(blue) << 16)));
+
+    for (; i + 4 <= pixelCount; i += 4) {
+        auto p = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const auto source = _mm_loadu_si128(p);
+        _mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(alphaMask, source), color));
+    }
+#elif defined(POMDOG_PIXELCONVERSION_USE_NEON)
+    const auto redLanes = vdupq_n_u8(red);
+    const auto greenLanes = vdupq_n_u8(green);
+    const auto blueLanes = vdupq_n_u8(blue);
+
+    for (; i + 16 <= pixelCount; i += 16) {
+        auto p = pixels + i * 4;
+        auto source = vld4q_u8(p);
+        source.val[0] = redLanes;
+        source.val[1] = greenLanes;
+        source.val[2] = blueLanes;
+        vst4q_u8(p, source);
+    }
+#endif
+
+    for (; i < pixelCount; ++i) {
+        auto p = pixels + i * 4;
+        p[0] = red;
+        p[1] = green;
+        p[2] = blue;
+    }
+}
+
+} // namespace Pomdog::PixelConversion
@@ -31,6 +31,11 @@ bool CheckBox::IsOn() const
 
 void CheckBox::SetOn(bool isOnIn)
 {
+    if (this->isOn == isOnIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isOn = isOnIn;
 }
 
@@ -41,6 +46,11 @@ bool CheckBox::IsEnabled() const
 
 void CheckBox::SetEnabled(bool isEnabledIn)
 {
+    if (this->isEnabled == isEnabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = isEnabledIn;
     if (isEnabled) {
         SetCursor(MouseCursor::PointingHand);
@@ -42,8 +42,13 @@ void ContextMenu::SetPosition(const Point2D& positionIn)
 
 void ContextMenu::SetPadding(const Thickness& paddingIn)
 {
+    if (padding == paddingIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     padding = paddingIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void ContextMenu::MarkParentTransformDirty()
@@ -57,6 +62,7 @@ void ContextMenu::MarkParentTransformDirty()
 void ContextMenu::MarkContentLayoutDirty()
 {
     needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
 }
 
 bool ContextMenu::GetSizeToFitContent() const noexcept
@@ -96,7 +102,7 @@ void ContextMenu::AddChild(const std::shared_ptr<Widget>& widget)
 {
     POMDOG_ASSERT(verticalLayout);
     verticalLayout->AddChild(widget);
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 std::shared_ptr<Widget> ContextMenu::GetChildAt(const Point2D& position)
@@ -118,7 +124,7 @@ void ContextMenu::UpdateAnimation(const Duration& frameDuration)
 void ContextMenu::UpdateLayout()
 {
     POMDOG_ASSERT(scrollView);
-    scrollView->DoLayout();
+    scrollView->DoLayoutIfNeeded();
 
     if (!needToUpdateLayout) {
         return;
@@ -153,8 +159,10 @@ void ContextMenu::UpdateLayout()
         switch (scrollView->GetHorizontalAlignment()) {
         case HorizontalAlignment::Stretch: {
             auto childWidth = GetWidth() - (padding.Left + padding.Right);
-            scrollView->SetSize(childWidth, scrollView->GetHeight());
-            scrollView->MarkContentLayoutDirty();
+            if (childWidth != scrollView->GetWidth()) {
+                scrollView->SetSize(childWidth, scrollView->GetHeight());
+                scrollView->MarkContentLayoutDirty();
+            }
             break;
         }
         case HorizontalAlignment::Left:
@@ -33,6 +33,11 @@ bool ContextMenuButton::IsEnabled() const
 
 void ContextMenuButton::SetEnabled(bool isEnabledIn)
 {
+    if (this->isEnabled == isEnabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = isEnabledIn;
 }
 
@@ -48,6 +53,11 @@ bool ContextMenuButton::IsFocused() const
 
 void ContextMenuButton::SetFontWeight(FontWeight fontWeightIn)
 {
+    if (this->fontWeight == fontWeightIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->fontWeight = fontWeightIn;
 }
 
@@ -58,11 +68,21 @@ std::string ContextMenuButton::GetText() const
 
 void ContextMenuButton::SetText(const std::string& textIn)
 {
+    if (this->text == textIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->text = textIn;
 }
 
 void ContextMenuButton::SetTextAlignment(TextAlignment textAlign)
 {
+    if (this->textAlignment == textAlign) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->textAlignment = textAlign;
 }
 
@@ -71,17 +91,34 @@ void ContextMenuButton::SetMargin(const Thickness& margin)
     static_assert(std::is_same_v<decltype(marginLeft), std::int16_t>);
     static_assert(std::is_same_v<decltype(marginRight), std::int16_t>);
 
-    marginLeft = static_cast<std::int16_t>(margin.Left);
-    marginRight = static_cast<std::int16_t>(margin.Right);
+    const auto left = static_cast<std::int16_t>(margin.Left);
+    const auto right = static_cast<std::int16_t>(margin.Right);
+    if ((marginLeft == left) && (marginRight == right)) {
+        return;
+    }
+
+    MarkRenderDirty();
+    marginLeft = left;
+    marginRight = right;
 }
 
 void ContextMenuButton::SetHorizontalAlignment(HorizontalAlignment horizontalAlignmentIn) noexcept
 {
+    if (this->horizontalAlignment == horizontalAlignmentIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->horizontalAlignment = horizontalAlignmentIn;
 }
 
 void ContextMenuButton::SetVerticalAlignment(VerticalAlignment verticalAlignmentIn) noexcept
 {
+    if (this->verticalAlignment == verticalAlignmentIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->verticalAlignment = verticalAlignmentIn;
 }
 
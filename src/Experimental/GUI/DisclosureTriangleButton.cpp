@@ -25,6 +25,11 @@ bool DisclosureTriangleButton::IsOn() const
 
 void DisclosureTriangleButton::SetOn(bool isOnIn)
 {
+    if (this->isOn == isOnIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isOn = isOnIn;
 }
 
@@ -35,6 +40,11 @@ bool DisclosureTriangleButton::IsEnabled() const
 
 void DisclosureTriangleButton::SetEnabled(bool isEnabledIn)
 {
+    if (this->isEnabled == isEnabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = isEnabledIn;
     if (isEnabled) {
         SetCursor(MouseCursor::PointingHand);
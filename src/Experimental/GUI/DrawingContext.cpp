@@ -2,6 +2,7 @@
 
 #include "Pomdog/Experimental/GUI/DrawingContext.hpp"
 #include "Pomdog/Content/AssetManager.hpp"
+#include "Pomdog/Content/Image/PixelConversion.hpp"
 #include "Pomdog/Experimental/Graphics/TrueTypeFontLoader.hpp"
 #include "Pomdog/Experimental/Image/Image.hpp"
 #include "Pomdog/Experimental/Image/SVGLoader.hpp"
@@ -13,6 +14,8 @@
 #include "Pomdog/Graphics/SamplerDescription.hpp"
 #include "Pomdog/Graphics/Texture2D.hpp"
 #include "Pomdog/Logging/Log.hpp"
+#include <string>
+#include <vector>
 
 namespace Pomdog::GUI {
 namespace {
@@ -29,7 +32,8 @@ std::uint32_t MakeFontID(FontWeight fontWeight, FontSize fontSize)
 DrawingContext::DrawingContext(
     const std::shared_ptr<GraphicsDevice>& graphicsDevice,
     AssetManager& assets)
-    : viewportWidth(1)
+    : recordingCache(nullptr)
+    , viewportWidth(1)
     , viewportHeight(1)
 {
     primitiveBatch = std::make_shared<PrimitiveBatch>(
@@ -158,33 +162,38 @@ DrawingContext::DrawingContext(
     constexpr int canvasWidth = 32;
     constexpr int canvasHeight = 32;
 
-    // Generating texture atlas from SVG image
+    std::vector<std::string> filePaths;
+    filePaths.reserve(svgFiles.size());
     for (const auto& filename : svgFiles) {
-        // NOTE: Load SVG texture.
-        auto filePath = PathHelper::Join(svgDir, filename);
+        filePaths.push_back(PathHelper::Join(svgDir, filename));
+    }
 
-        if (auto [res, err] = SVG::DecodeFile(filePath, canvasWidth, canvasHeight); err != nullptr) {
+    // NOTE: Load SVG textures in parallel on the worker threads of the asset manager.
+    auto images = SVG::DecodeFiles(assets, filePaths, canvasWidth, canvasHeight);
+    POMDOG_ASSERT(images.size() == svgFiles.size());
+
+    // Generating texture atlas from SVG image
+    auto filename = std::begin(svgFiles);
+    for (auto& [res, err] : images) {
+        std::shared_ptr<Image> image;
+        if (err == nullptr) {
+            // NOTE: The icons are drawn in white, and are tinted when drawing.
+            PixelConversion::FillColorChannels(res.RawData.data(), res.RawData.size() / 4, 255, 255, 255);
+
+            image = std::make_shared<Image>(res.Width, res.Height);
+            err = image->SetData(res);
+        }
+
+        if (err != nullptr) {
             Log::Verbose("failed to load texture: " + err->ToString());
         }
         else {
-            auto image = std::make_shared<Image>(res.Width, res.Height);
-            image->SetData(reinterpret_cast<const Color*>(res.PixelData));
-
-            for (int y = 0; y < image->GetHeight(); y++) {
-                for (int x = 0; x < image->GetWidth(); x++) {
-                    auto pixel = image->GetPixel(x, y);
-                    pixel.R = 255;
-                    pixel.G = 255;
-                    pixel.B = 255;
-                    image->SetPixel(x, y, pixel);
-                }
-            }
-
             TexturePacker::TextureAtlasGeneratorSource src;
             src.Image = std::move(image);
-            src.Name = filename;
+            src.Name = *filename;
             sources.push_back(std::move(src));
         }
+        ++filename;
     }
 
     auto result = TexturePacker::TextureAtlasGenerator::Generate(sources, 256, 256);
@@ -311,7 +320,7 @@ void DrawingContext::PushScissorRect(const Rectangle& scissorRect)
     primitiveBatch->Flush();
     spriteBatch->Flush();
 
-    commandList->SetScissorRect(rect);
+    SetScissorRect(rect);
     scissorRects.push_back(rect);
 }
 
@@ -324,7 +333,19 @@ void DrawingContext::PopScissorRect()
     if (!scissorRects.empty()) {
         scissorRect = scissorRects.back();
     }
+    SetScissorRect(scissorRect);
+}
+
+void DrawingContext::SetScissorRect(const Rectangle& scissorRect)
+{
     commandList->SetScissorRect(scissorRect);
+
+    if (recordingCache != nullptr) {
+        DrawingCommand command;
+        command.ScissorRect = scissorRect;
+        command.Type = DrawingCommandType::ScissorRect;
+        recordingCache->Commands.push_back(std::move(command));
+    }
 }
 
 void DrawingContext::BeginDraw(
@@ -339,10 +360,118 @@ void DrawingContext::BeginDraw(
 
 void DrawingContext::EndDraw()
 {
+    POMDOG_ASSERT(recordingCache == nullptr);
     primitiveBatch->End();
     spriteBatch->End();
 }
 
+void DrawingContext::BeginRecording(DrawingCache& cache)
+{
+    POMDOG_ASSERT(commandList);
+    POMDOG_ASSERT(recordingCache == nullptr);
+
+    // NOTE: Submits the pending shapes so that they are not recorded.
+    primitiveBatch->Flush();
+    spriteBatch->Flush();
+
+    cache.Clear();
+    cache.ViewportWidth = viewportWidth;
+    cache.ViewportHeight = viewportHeight;
+    recordingCache = &cache;
+
+    primitiveBatch->SetFlushCallback([this](const PrimitiveBatchVertex* vertices, std::size_t vertexCount) {
+        POMDOG_ASSERT(recordingCache != nullptr);
+        auto& cache = *recordingCache;
+
+        DrawingCommand command;
+        command.StartIndex = cache.Vertices.size();
+        command.Count = vertexCount;
+        command.Type = DrawingCommandType::Primitives;
+        cache.Commands.push_back(std::move(command));
+        cache.Vertices.insert(std::end(cache.Vertices), vertices, vertices + vertexCount);
+    });
+
+    spriteBatch->SetFlushCallback([this](const Texture2DView& texture, const SpriteDesc* sprites, std::size_t spriteCount) {
+        POMDOG_ASSERT(recordingCache != nullptr);
+        auto& cache = *recordingCache;
+
+        DrawingCommand command;
+        command.Texture = texture;
+        command.StartIndex = cache.Sprites.size();
+        command.Count = spriteCount;
+        command.Type = DrawingCommandType::Sprites;
+        cache.Commands.push_back(std::move(command));
+        cache.Sprites.insert(std::end(cache.Sprites), sprites, sprites + spriteCount);
+    });
+}
+
+void DrawingContext::EndRecording()
+{
+    POMDOG_ASSERT(recordingCache != nullptr);
+
+    primitiveBatch->Flush();
+    spriteBatch->Flush();
+
+    primitiveBatch->SetFlushCallback(nullptr);
+    spriteBatch->SetFlushCallback(nullptr);
+
+    recordingCache->IsValid = scissorRects.empty();
+    recordingCache = nullptr;
+}
+
+bool DrawingContext::CanReplay(const DrawingCache& cache) const
+{
+    if (!cache.IsValid) {
+        return false;
+    }
+    if ((cache.ViewportWidth != viewportWidth) || (cache.ViewportHeight != viewportHeight)) {
+        return false;
+    }
+
+    // NOTE: Text drawn while glyphs are rasterized on worker threads uses the
+    // default character, so it must be drawn again once the glyphs arrive.
+    for (const auto& pair : spriteFonts) {
+        if (pair.second->HasPendingGlyphs()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DrawingContext::Replay(const DrawingCache& cache)
+{
+    POMDOG_ASSERT(commandList);
+    POMDOG_ASSERT(recordingCache == nullptr);
+    POMDOG_ASSERT(cache.IsValid);
+
+    primitiveBatch->Flush();
+    spriteBatch->Flush();
+
+    for (const auto& command : cache.Commands) {
+        switch (command.Type) {
+        case DrawingCommandType::Primitives:
+            POMDOG_ASSERT((command.StartIndex + command.Count) <= cache.Vertices.size());
+            primitiveBatch->DrawVertices(cache.Vertices.data() + command.StartIndex, command.Count);
+            break;
+        case DrawingCommandType::Sprites: {
+            POMDOG_ASSERT((command.StartIndex + command.Count) <= cache.Sprites.size());
+            const auto sprites = cache.Sprites.data() + command.StartIndex;
+            if (command.Texture.GetIndex() == Texture2DViewIndex::Texture2D) {
+                spriteBatch->DrawBatch(command.Texture.AsTexture2D(), sprites, command.Count);
+            }
+            else {
+                spriteBatch->DrawBatch(command.Texture.AsRenderTarget2D(), sprites, command.Count);
+            }
+            spriteBatch->Flush();
+            break;
+        }
+        case DrawingCommandType::ScissorRect:
+            commandList->SetScissorRect(command.ScissorRect);
+            break;
+        }
+    }
+}
+
 void DrawingContext::DrawIcon(
     const std::string& name,
     const Vector2& position,
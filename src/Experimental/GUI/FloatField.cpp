@@ -217,6 +217,10 @@ double FloatField::GetValue() const
 void FloatField::SetValue(double valueIn)
 {
     POMDOG_ASSERT(dataContext != nullptr);
+    if (dataContext->GetValue() == valueIn) {
+        return;
+    }
+
     dataContext->SetValue(valueIn);
 
     POMDOG_ASSERT(numberField != nullptr);
@@ -232,6 +236,11 @@ double FloatField::GetMinimum() const noexcept
 void FloatField::SetMinimum(double minimum)
 {
     POMDOG_ASSERT(dataContext != nullptr);
+    if (dataContext->GetMinimum() == minimum) {
+        return;
+    }
+
+    MarkRenderDirty();
     dataContext->SetMinimum(minimum);
 }
 
@@ -244,6 +253,11 @@ double FloatField::GetMaximum() const noexcept
 void FloatField::SetMaximum(double maximum)
 {
     POMDOG_ASSERT(dataContext != nullptr);
+    if (dataContext->GetMaximum() == maximum) {
+        return;
+    }
+
+    MarkRenderDirty();
     dataContext->SetMaximum(maximum);
 }
 
@@ -256,6 +270,11 @@ int FloatField::GetDecimals() const
 void FloatField::SetDecimals(int precision)
 {
     POMDOG_ASSERT(dataContext != nullptr);
+    if (dataContext->GetDecimals() == precision) {
+        return;
+    }
+
+    MarkRenderDirty();
     dataContext->SetDecimals(precision);
 }
 
@@ -24,14 +24,24 @@ HorizontalLayout::HorizontalLayout(
 
 void HorizontalLayout::SetMargin(const Thickness& marginIn)
 {
+    if (margin == marginIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     margin = marginIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void HorizontalLayout::SetLayoutSpacing(int spacingIn)
 {
+    if (layoutSpacing == spacingIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     layoutSpacing = spacingIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void HorizontalLayout::SetStackedLayout(bool isStackedLayoutIn)
@@ -40,8 +50,9 @@ void HorizontalLayout::SetStackedLayout(bool isStackedLayoutIn)
         return;
     }
 
+    MarkRenderDirty();
     isStackedLayout = isStackedLayoutIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void HorizontalLayout::SetPosition(const Point2D& positionIn)
@@ -66,6 +77,7 @@ void HorizontalLayout::MarkParentTransformDirty()
 void HorizontalLayout::MarkContentLayoutDirty()
 {
     needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
 }
 
 bool HorizontalLayout::GetSizeToFitContent() const noexcept
@@ -92,11 +104,14 @@ void HorizontalLayout::AddChild(const std::shared_ptr<Widget>& widget)
     widget->SetParent(shared_from_this());
     widget->OnEnter();
 
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 std::shared_ptr<Widget> HorizontalLayout::GetChildAt(const Point2D& position)
 {
+    // NOTE: Unlike VerticalLayout, the children are not binary-searched.
+    // A left or right aligned child can be wider than its cell and overlap
+    // the next one, so the children are not ordered by their bounds.
     for (auto& child : children) {
         POMDOG_ASSERT(child.widget != nullptr);
         auto bounds = child.widget->GetBounds();
@@ -125,7 +140,10 @@ void HorizontalLayout::SetStretchFactor(int index, int stretch)
     }
     if (index < static_cast<int>(children.size())) {
         auto& child = children[static_cast<size_t>(index)];
-        child.stretch = stretch;
+        if (child.stretch != stretch) {
+            MarkRenderDirty();
+            child.stretch = stretch;
+        }
     }
 }
 
@@ -147,7 +165,8 @@ void HorizontalLayout::SetStretchFactor(const std::shared_ptr<Widget>& widget, i
         std::end(children),
         [&](const auto& c) -> bool { return c.widget == widget; });
 
-    if (iter != std::end(children)) {
+    if ((iter != std::end(children)) && (iter->stretch != stretch)) {
+        MarkRenderDirty();
         iter->stretch = stretch;
     }
 }
@@ -157,7 +176,7 @@ void HorizontalLayout::UpdateLayout()
     bool hasStretchFactor = false;
     int totalStretchFactor = 0;
     for (auto& child : children) {
-        child.widget->DoLayout();
+        child.widget->DoLayoutIfNeeded();
         if (child.stretch > 1) {
             hasStretchFactor = true;
         }
@@ -235,8 +254,10 @@ void HorizontalLayout::UpdateLayout()
 
         switch (child.widget->GetHorizontalAlignment()) {
         case HorizontalAlignment::Stretch:
-            child.widget->SetSize(calcWidth(child.stretch), child.widget->GetHeight());
-            child.widget->MarkContentLayoutDirty();
+            if (const auto childWidth = calcWidth(child.stretch); childWidth != child.widget->GetWidth()) {
+                child.widget->SetSize(childWidth, child.widget->GetHeight());
+                child.widget->MarkContentLayoutDirty();
+            }
             break;
         case HorizontalAlignment::Right:
             if (!isStackedLayout) {
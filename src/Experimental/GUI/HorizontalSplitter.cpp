@@ -62,23 +62,38 @@ HorizontalSplitter::HorizontalSplitter(
 
 void HorizontalSplitter::SetMargin(const Thickness& marginIn)
 {
+    if (margin == marginIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     margin = marginIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void HorizontalSplitter::SetLayoutSpacing(int spacing)
 {
     POMDOG_ASSERT(splitterHandle);
     POMDOG_ASSERT(spacing >= 1);
+    if (splitterHandle->GetWidth() == spacing) {
+        return;
+    }
+
+    MarkRenderDirty();
     splitterHandle->SetSize(spacing, GetHeight());
     if (childSplitter) {
         childSplitter->SetLayoutSpacing(spacing);
     }
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void HorizontalSplitter::SetBackgroundColor(const Color& color)
 {
+    if (backgroundColor == color) {
+        return;
+    }
+
+    MarkRenderDirty();
     backgroundColor = color;
     if (childSplitter) {
         childSplitter->SetBackgroundColor(color);
@@ -122,6 +137,7 @@ void HorizontalSplitter::MarkParentTransformDirty()
 void HorizontalSplitter::MarkContentLayoutDirty()
 {
     needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
 }
 
 bool HorizontalSplitter::GetSizeToFitContent() const noexcept
@@ -148,7 +164,7 @@ void HorizontalSplitter::OnEnter()
         }
 
         splitterHandle->SetPosition(pos);
-        needToUpdateLayout = true;
+        MarkContentLayoutDirty();
     });
 }
 
@@ -192,7 +208,7 @@ void HorizontalSplitter::AddChild(const std::shared_ptr<Widget>& widget)
         childSplitter->AddChild(widget);
 
         right.widget = childSplitter;
-        needToUpdateLayout = true;
+        MarkContentLayoutDirty();
         return;
     }
     else {
@@ -200,7 +216,7 @@ void HorizontalSplitter::AddChild(const std::shared_ptr<Widget>& widget)
         POMDOG_ASSERT(children[1].widget != nullptr);
         POMDOG_ASSERT(childSplitter != nullptr);
         childSplitter->AddChild(widget);
-        needToUpdateLayout = true;
+        MarkContentLayoutDirty();
         return;
     }
 
@@ -210,7 +226,7 @@ void HorizontalSplitter::AddChild(const std::shared_ptr<Widget>& widget)
     widget->SetParent(shared_from_this());
     widget->OnEnter();
 
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 std::shared_ptr<Widget> HorizontalSplitter::GetChildAt(const Point2D& position)
@@ -256,7 +272,10 @@ void HorizontalSplitter::SetMinimumWidth(int index, int minimumWidth)
     const auto count = static_cast<int>(children.size());
     if (index < count) {
         auto& child = children[static_cast<size_t>(index)];
-        child.minimumWidth = minimumWidth;
+        if (child.minimumWidth != minimumWidth) {
+            MarkRenderDirty();
+            child.minimumWidth = minimumWidth;
+        }
     }
     else if (childSplitter != nullptr) {
         POMDOG_ASSERT(index >= static_cast<int>(children.size()));
@@ -288,7 +307,8 @@ void HorizontalSplitter::SetMinimumWidth(const std::shared_ptr<Widget>& widget,
         std::end(children),
         [&](const auto& c) -> bool { return c.widget == widget; });
 
-    if (iter != std::end(children)) {
+    if ((iter != std::end(children)) && (iter->minimumWidth != minimumWidth)) {
+        MarkRenderDirty();
         iter->minimumWidth = minimumWidth;
     }
 }
@@ -301,7 +321,7 @@ void HorizontalSplitter::UpdateLayout()
 
     for (auto& child : children) {
         if (child.widget != nullptr) {
-            child.widget->DoLayout();
+            child.widget->DoLayoutIfNeeded();
         }
     }
 
@@ -377,8 +397,10 @@ void HorizontalSplitter::UpdateLayout()
             if (child.widget->GetVerticalAlignment() == VerticalAlignment::Stretch) {
                 h = GetHeight() - (margin.Bottom + margin.Top);
             }
-            child.widget->SetSize(requiredWidth, h);
-            child.widget->MarkContentLayoutDirty();
+            if ((requiredWidth != child.widget->GetWidth()) || (h != child.widget->GetHeight())) {
+                child.widget->SetSize(requiredWidth, h);
+                child.widget->MarkContentLayoutDirty();
+            }
             break;
         }
         case HorizontalAlignment::Right:
@@ -466,6 +488,11 @@ bool HorizontalSplitterHandle::IsEnabled() const noexcept
 
 void HorizontalSplitterHandle::SetEnabled(bool enabledIn) noexcept
 {
+    if (isEnabled == enabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     isEnabled = enabledIn;
 }
 
@@ -476,11 +503,21 @@ bool HorizontalSplitterHandle::IsVisible() const noexcept
 
 void HorizontalSplitterHandle::SetVisible(bool visibleIn) noexcept
 {
+    if (isVisible == visibleIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     isVisible = visibleIn;
 }
 
 void HorizontalSplitterHandle::SetColor(const Color& colorIn) noexcept
 {
+    if (color == colorIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     color = colorIn;
 }
 
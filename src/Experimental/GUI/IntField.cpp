@@ -145,6 +145,10 @@ int IntField::GetValue() const
 void IntField::SetValue(int valueIn)
 {
     POMDOG_ASSERT(dataContext != nullptr);
+    if (dataContext->GetValue() == valueIn) {
+        return;
+    }
+
     dataContext->SetValue(valueIn);
 
     POMDOG_ASSERT(numberField != nullptr);
@@ -39,8 +39,13 @@ void ListView::SetPosition(const Point2D& positionIn)
 
 void ListView::SetPadding(const Thickness& paddingIn)
 {
+    if (padding == paddingIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     padding = paddingIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void ListView::MarkParentTransformDirty()
@@ -54,6 +59,7 @@ void ListView::MarkParentTransformDirty()
 void ListView::MarkContentLayoutDirty()
 {
     needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
 }
 
 bool ListView::GetSizeToFitContent() const noexcept
@@ -83,7 +89,7 @@ void ListView::AddChild(const std::shared_ptr<Widget>& widget)
     item->SetListViewIndex(itemCount);
 
     verticalLayout->AddChild(item);
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void ListView::RemoveChild(const std::shared_ptr<Widget>& widget)
@@ -98,7 +104,7 @@ void ListView::RemoveChild(const std::shared_ptr<Widget>& widget)
         item->SetListViewIndex(i);
     }
 
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void ListView::RemoveChild(int index)
@@ -113,7 +119,7 @@ void ListView::RemoveChild(int index)
         item->SetListViewIndex(i);
     }
 
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 int ListView::GetItemCount() const noexcept
@@ -129,6 +135,11 @@ std::optional<int> ListView::GetCurrentIndex() const noexcept
 
 void ListView::SetCurrentIndex(int index)
 {
+    if (currentIndex == index) {
+        return;
+    }
+
+    MarkRenderDirty();
     POMDOG_ASSERT(verticalLayout != nullptr);
 
     if ((currentIndex != std::nullopt) &&
@@ -182,7 +193,7 @@ void ListView::UpdateAnimation(const Duration& frameDuration)
 void ListView::UpdateLayout()
 {
     POMDOG_ASSERT(verticalLayout != nullptr);
-    verticalLayout->DoLayout();
+    verticalLayout->DoLayoutIfNeeded();
 
     if (!needToUpdateLayout) {
         return;
@@ -210,8 +221,10 @@ void ListView::UpdateLayout()
         switch (verticalLayout->GetHorizontalAlignment()) {
         case HorizontalAlignment::Stretch: {
             auto childWidth = GetWidth() - (padding.Left + padding.Right);
-            verticalLayout->SetSize(childWidth, verticalLayout->GetHeight());
-            verticalLayout->MarkContentLayoutDirty();
+            if (childWidth != verticalLayout->GetWidth()) {
+                verticalLayout->SetSize(childWidth, verticalLayout->GetHeight());
+                verticalLayout->MarkContentLayoutDirty();
+            }
             break;
         }
         case HorizontalAlignment::Left:
@@ -6,6 +6,7 @@
 #include "Pomdog/Experimental/GUI/PointerPoint.hpp"
 #include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
 #include "Pomdog/Experimental/GUI/UIHelper.hpp"
+#include "Pomdog/Experimental/GUI/VirtualizedListView.hpp"
 #include "Pomdog/Math/MathHelper.hpp"
 
 namespace Pomdog::GUI {
@@ -32,6 +33,11 @@ bool ListViewItem::IsEnabled() const noexcept
 
 void ListViewItem::SetEnabled(bool isEnabledIn)
 {
+    if (this->isEnabled == isEnabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = isEnabledIn;
 }
 
@@ -52,6 +58,11 @@ bool ListViewItem::IsSelected() const noexcept
 
 void ListViewItem::SetSelected(bool selected)
 {
+    if (isSelected == selected) {
+        return;
+    }
+
+    MarkRenderDirty();
     isSelected = selected;
 }
 
@@ -62,11 +73,21 @@ int ListViewItem::GetListViewIndex() const noexcept
 
 void ListViewItem::SetListViewIndex(int index) noexcept
 {
+    if (listViewIndex == index) {
+        return;
+    }
+
+    MarkRenderDirty();
     listViewIndex = static_cast<std::int32_t>(index);
 }
 
 void ListViewItem::SetWidget(const std::shared_ptr<Widget>& widget)
 {
+    if (child == widget) {
+        return;
+    }
+
+    MarkRenderDirty();
     POMDOG_ASSERT(widget != nullptr);
     POMDOG_ASSERT(!widget->GetParent());
 
@@ -86,17 +107,34 @@ void ListViewItem::SetMargin(const Thickness& margin)
     static_assert(std::is_same_v<decltype(marginLeft), std::int16_t>);
     static_assert(std::is_same_v<decltype(marginRight), std::int16_t>);
 
-    marginLeft = static_cast<std::int16_t>(margin.Left);
-    marginRight = static_cast<std::int16_t>(margin.Right);
+    const auto left = static_cast<std::int16_t>(margin.Left);
+    const auto right = static_cast<std::int16_t>(margin.Right);
+    if ((marginLeft == left) && (marginRight == right)) {
+        return;
+    }
+
+    MarkRenderDirty();
+    marginLeft = left;
+    marginRight = right;
 }
 
 void ListViewItem::SetHorizontalAlignment(HorizontalAlignment horizontalAlignmentIn) noexcept
 {
+    if (this->horizontalAlignment == horizontalAlignmentIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->horizontalAlignment = horizontalAlignmentIn;
 }
 
 void ListViewItem::SetVerticalAlignment(VerticalAlignment verticalAlignmentIn) noexcept
 {
+    if (this->verticalAlignment == verticalAlignmentIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->verticalAlignment = verticalAlignmentIn;
 }
 
@@ -150,6 +188,12 @@ void ListViewItem::OnPointerReleased([[maybe_unused]] const PointerPoint& pointe
 
     auto parent = GetParent();
     POMDOG_ASSERT(parent);
+
+    if (auto virtualizedListView = std::dynamic_pointer_cast<VirtualizedListView>(parent); virtualizedListView != nullptr) {
+        virtualizedListView->SetCurrentIndex(listViewIndex);
+        return;
+    }
+
     POMDOG_ASSERT(std::dynamic_pointer_cast<VerticalLayout>(parent) != nullptr);
 
     auto listView = std::static_pointer_cast<ListView>(parent->GetParent());
@@ -185,7 +229,7 @@ void ListViewItem::UpdateAnimation(const Duration& frameDuration)
 void ListViewItem::DoLayout()
 {
     if (child != nullptr) {
-        child->DoLayout();
+        child->DoLayoutIfNeeded();
     }
 }
 
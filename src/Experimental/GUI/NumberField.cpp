@@ -118,16 +118,28 @@ void NumberField::Deselect()
 
 void NumberField::SetPrependAreaColor(const std::optional<Color>& color)
 {
-    if (color != std::nullopt) {
-        prependAreaColor = Color{color->R, color->G, color->B, 255};
-    }
-    else {
-        prependAreaColor = Color{255, 255, 255, 0};
+    const auto newColor = (color != std::nullopt)
+        ? Color{color->R, color->G, color->B, 255}
+        : Color{255, 255, 255, 0};
+
+    if (prependAreaColor == newColor) {
+        return;
     }
+
+    MarkRenderDirty();
+    prependAreaColor = newColor;
+
+    // NOTE: The prepend area changes the bounds of the text edit.
+    MarkContentLayoutDirty();
 }
 
 void NumberField::SetPrependAreaString(const std::string& text)
 {
+    if (prependAreaText == text) {
+        return;
+    }
+
+    MarkRenderDirty();
     prependAreaText = text;
 }
 
@@ -32,6 +32,11 @@ bool PopupMenu::IsEnabled() const
 
 void PopupMenu::SetEnabled(bool isEnabledIn)
 {
+    if (this->isEnabled == isEnabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = isEnabledIn;
 }
 
@@ -78,11 +83,21 @@ void PopupMenu::SetCurrentIndex(int index)
 {
     POMDOG_ASSERT(index >= 0);
     POMDOG_ASSERT(index < static_cast<int>(items.size()));
+    if (currentIndex == index) {
+        return;
+    }
+
+    MarkRenderDirty();
     currentIndex = index;
 }
 
 void PopupMenu::SetFontWeight(FontWeight fontWeightIn)
 {
+    if (this->fontWeight == fontWeightIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->fontWeight = fontWeightIn;
 }
 
@@ -99,16 +114,31 @@ std::string PopupMenu::GetText() const
 
 void PopupMenu::SetTextAlignment(TextAlignment textAlign)
 {
+    if (this->textAlignment == textAlign) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->textAlignment = textAlign;
 }
 
 void PopupMenu::SetHorizontalAlignment(HorizontalAlignment horizontalAlignmentIn) noexcept
 {
+    if (this->horizontalAlignment == horizontalAlignmentIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->horizontalAlignment = horizontalAlignmentIn;
 }
 
 void PopupMenu::SetVerticalAlignment(VerticalAlignment verticalAlignmentIn) noexcept
 {
+    if (this->verticalAlignment == verticalAlignmentIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->verticalAlignment = verticalAlignmentIn;
 }
 
@@ -31,6 +31,11 @@ bool PushButton::IsEnabled() const
 
 void PushButton::SetEnabled(bool isEnabledIn)
 {
+    if (this->isEnabled == isEnabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = isEnabledIn;
     if (isEnabled) {
         SetCursor(MouseCursor::PointingHand);
@@ -52,6 +57,11 @@ bool PushButton::IsFocused() const
 
 void PushButton::SetFontWeight(FontWeight fontWeightIn)
 {
+    if (this->fontWeight == fontWeightIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->fontWeight = fontWeightIn;
 }
 
@@ -62,21 +72,41 @@ std::string PushButton::GetText() const
 
 void PushButton::SetText(const std::string& textIn)
 {
+    if (this->text == textIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->text = textIn;
 }
 
 void PushButton::SetTextAlignment(TextAlignment textAlign)
 {
+    if (this->textAlignment == textAlign) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->textAlignment = textAlign;
 }
 
 void PushButton::SetHorizontalAlignment(HorizontalAlignment horizontalAlignmentIn) noexcept
 {
+    if (this->horizontalAlignment == horizontalAlignmentIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->horizontalAlignment = horizontalAlignmentIn;
 }
 
 void PushButton::SetVerticalAlignment(VerticalAlignment verticalAlignmentIn) noexcept
 {
+    if (this->verticalAlignment == verticalAlignmentIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->verticalAlignment = verticalAlignmentIn;
 }
 
@@ -84,6 +84,11 @@ bool ScenePanel::IsEnabled() const
 
 void ScenePanel::SetEnabled(bool isEnabledIn)
 {
+    if (this->isEnabled == isEnabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = isEnabledIn;
 }
 
@@ -32,8 +32,13 @@ ScrollView::ScrollView(
 
 void ScrollView::SetMargin(const Thickness& marginIn)
 {
+    if (margin == marginIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     margin = marginIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void ScrollView::SetPosition(const Point2D& positionIn)
@@ -50,6 +55,11 @@ void ScrollView::SetPosition(const Point2D& positionIn)
 
 void ScrollView::SetBackgroundColor(const Color& color) noexcept
 {
+    if (backgroundColor == color) {
+        return;
+    }
+
+    MarkRenderDirty();
     backgroundColor = color;
 }
 
@@ -68,6 +78,7 @@ void ScrollView::MarkParentTransformDirty()
 void ScrollView::MarkContentLayoutDirty()
 {
     needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
 }
 
 bool ScrollView::GetSizeToFitContent() const noexcept
@@ -85,7 +96,7 @@ void ScrollView::ScrollToTop()
 
     if (child->GetHeight() > GetHeight()) {
         scrollBar->SetValue(scrollBar->GetMaximum());
-        needToUpdateLayout = true;
+        MarkContentLayoutDirty();
     }
 }
 
@@ -99,7 +110,7 @@ void ScrollView::ScrollToEnd()
 
     if (child->GetHeight() > GetHeight()) {
         scrollBar->SetValue(scrollBar->GetMinimum());
-        needToUpdateLayout = true;
+        MarkContentLayoutDirty();
     }
 }
 
@@ -120,12 +131,17 @@ void ScrollView::ScrollTo(const std::shared_ptr<Widget>& widget)
         const auto h = scrollBar->GetHeight();
         const auto v = w.Y - (s.Y + h);
         scrollBar->SetValue(std::clamp(static_cast<double>(v), scrollBar->GetMinimum(), scrollBar->GetMaximum()));
-        needToUpdateLayout = true;
+        MarkContentLayoutDirty();
     }
 }
 
 void ScrollView::SetHorizontalAlignment(HorizontalAlignment horizontalAlignmentIn) noexcept
 {
+    if (this->horizontalAlignment == horizontalAlignmentIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->horizontalAlignment = horizontalAlignmentIn;
 }
 
@@ -157,11 +173,16 @@ void ScrollView::OnPointerWheelChanged(const PointerPoint& pointerPoint)
     const auto v = scrollBar->GetValue() + wheelSpeed * pointerPoint.MouseWheelDelta;
     scrollBar->SetValue(std::clamp(v, scrollBar->GetMinimum(), scrollBar->GetMaximum()));
 
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void ScrollView::SetWidget(const std::shared_ptr<Widget>& widget)
 {
+    if (child == widget) {
+        return;
+    }
+
+    MarkRenderDirty();
     POMDOG_ASSERT(widget != nullptr);
     POMDOG_ASSERT(!widget->GetParent());
 
@@ -186,7 +207,7 @@ void ScrollView::SetWidget(const std::shared_ptr<Widget>& widget)
         scrollBar->SetValue(scrollBar->GetMaximum());
     }
 
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 std::shared_ptr<Widget> ScrollView::GetChildAt(const Point2D& position)
@@ -225,10 +246,10 @@ void ScrollView::UpdateAnimation(const Duration& frameDuration)
 void ScrollView::UpdateLayout()
 {
     if (scrollBar != nullptr) {
-        scrollBar->DoLayout();
+        scrollBar->DoLayoutIfNeeded();
     }
     if (child != nullptr) {
-        child->DoLayout();
+        child->DoLayoutIfNeeded();
     }
 
     if (!needToUpdateLayout) {
@@ -248,10 +269,8 @@ void ScrollView::UpdateLayout()
 
     POMDOG_ASSERT(child != nullptr);
 
-    if (auto parent = GetParent(); parent != nullptr) {
-        parent->MarkContentLayoutDirty();
-    }
-
+    // NOTE: Scrolling does not change the size of this view, so the parent
+    // is not laid out again here.
     scrollBar->SetSize(scrollBar->GetWidth(), GetHeight());
     scrollBar->SetPosition(Point2D{GetWidth() - scrollBar->GetWidth(), 0});
     scrollBar->SetMinimum(0.0);
@@ -263,6 +282,7 @@ void ScrollView::UpdateLayout()
         POMDOG_ASSERT(scrollBar != nullptr);
 
         const auto scrollBarVisible = child->GetHeight() > GetHeight();
+        const auto oldChildWidth = child->GetWidth();
 
         if (scrollBarVisible) {
             child->SetSize(GetWidth() - scrollBar->GetWidth(), child->GetHeight());
@@ -273,8 +293,10 @@ void ScrollView::UpdateLayout()
             child->SetPosition(Point2D{0, GetHeight() - child->GetHeight()});
         }
 
-        child->MarkContentLayoutDirty();
-        child->DoLayout();
+        if (child->GetWidth() != oldChildWidth) {
+            child->MarkContentLayoutDirty();
+        }
+        child->DoLayoutIfNeeded();
 
         if (!scrollBarVisible) {
             scrollBar->SetEnabled(false);
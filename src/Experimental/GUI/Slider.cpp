@@ -37,6 +37,8 @@ void Slider::SetValue(double valueIn)
     if (value == valueIn) {
         return;
     }
+
+    MarkRenderDirty();
     this->value = valueIn;
     ValueChanged(this->value);
 }
@@ -56,6 +58,8 @@ void Slider::SetMinimum(double minimumIn)
     if (minimum == minimumIn) {
         return;
     }
+
+    MarkRenderDirty();
     minimum = minimumIn;
     if (minimum > value) {
         value = minimum;
@@ -68,6 +72,8 @@ void Slider::SetMaximum(double maximumIn)
     if (maximum == maximumIn) {
         return;
     }
+
+    MarkRenderDirty();
     maximum = maximumIn;
     if (maximum < value) {
         value = maximum;
@@ -87,16 +93,31 @@ bool Slider::IsEnabled() const noexcept
 
 void Slider::SetEnabled(bool enabledIn) noexcept
 {
+    if (this->isEnabled == enabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = enabledIn;
 }
 
 void Slider::SetTextVisible(bool isTextVisibleIn)
 {
+    if (isTextVisible == isTextVisibleIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     isTextVisible = isTextVisibleIn;
 }
 
 void Slider::SetThumbVisible(bool isThumbVisibleIn)
 {
+    if (isThumbVisible == isThumbVisibleIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     isThumbVisible = isThumbVisibleIn;
 }
 
@@ -200,6 +221,8 @@ void Slider::UpdateAnimation(const Duration& frameDuration)
         return;
     }
 
+    MarkRenderDirty();
+
     colorAnimation->time += static_cast<float>(frameDuration.count());
     colorAnimation->time = std::min(colorAnimation->time, colorAnimation->duration);
 
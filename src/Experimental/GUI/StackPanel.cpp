@@ -35,8 +35,13 @@ void StackPanel::SetPosition(const Point2D& positionIn)
 
 void StackPanel::SetPadding(const Thickness& paddingIn)
 {
+    if (padding == paddingIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     padding = paddingIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void StackPanel::MarkParentTransformDirty()
@@ -50,6 +55,7 @@ void StackPanel::MarkParentTransformDirty()
 void StackPanel::MarkContentLayoutDirty()
 {
     needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
 }
 
 bool StackPanel::GetSizeToFitContent() const noexcept
@@ -122,7 +128,7 @@ void StackPanel::AddChild(const std::shared_ptr<Widget>& widget)
 {
     POMDOG_ASSERT(verticalLayout);
     verticalLayout->AddChild(widget);
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 std::shared_ptr<Widget> StackPanel::GetChildAt(const Point2D& position)
@@ -144,7 +150,7 @@ void StackPanel::UpdateAnimation(const Duration& frameDuration)
 void StackPanel::UpdateLayout()
 {
     POMDOG_ASSERT(verticalLayout);
-    verticalLayout->DoLayout();
+    verticalLayout->DoLayoutIfNeeded();
 
     if (!needToUpdateLayout) {
         return;
@@ -172,8 +178,10 @@ void StackPanel::UpdateLayout()
         switch (verticalLayout->GetHorizontalAlignment()) {
         case HorizontalAlignment::Stretch: {
             auto childWidth = GetWidth() - (padding.Left + padding.Right);
-            verticalLayout->SetSize(childWidth, verticalLayout->GetHeight());
-            verticalLayout->MarkContentLayoutDirty();
+            if (childWidth != verticalLayout->GetWidth()) {
+                verticalLayout->SetSize(childWidth, verticalLayout->GetHeight());
+                verticalLayout->MarkContentLayoutDirty();
+            }
             break;
         }
         case HorizontalAlignment::Left:
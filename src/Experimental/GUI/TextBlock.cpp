@@ -24,16 +24,31 @@ TextBlock::TextBlock(const std::shared_ptr<UIEventDispatcher>& dispatcher)
 
 void TextBlock::SetColor(const Color& color)
 {
+    if (textColor == color) {
+        return;
+    }
+
+    MarkRenderDirty();
     textColor = color;
 }
 
 void TextBlock::SetFontWeight(FontWeight fontWeightIn)
 {
+    if (fontWeight == fontWeightIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     fontWeight = fontWeightIn;
 }
 
 void TextBlock::SetFontSize(FontSize fontSizeIn)
 {
+    if (fontSize == fontSizeIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     fontSize = fontSizeIn;
 }
 
@@ -44,16 +59,31 @@ std::string TextBlock::GetText() const
 
 void TextBlock::SetText(const std::string& textIn)
 {
+    if (this->text == textIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->text = textIn;
 }
 
 void TextBlock::SetBaselineHeight(float pixelSize)
 {
+    if (this->baselineHeight == pixelSize) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->baselineHeight = pixelSize;
 }
 
 void TextBlock::SetTextAlignment(TextAlignment textAlign)
 {
+    if (this->textAlignment == textAlign) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->textAlignment = textAlign;
 }
 
@@ -62,6 +92,8 @@ void TextBlock::SetHorizontalAlignment(HorizontalAlignment horizontalAlignmentIn
     if (horizontalAlignment == horizontalAlignmentIn) {
         return;
     }
+
+    MarkRenderDirty();
     horizontalAlignment = horizontalAlignmentIn;
     if (auto parent = GetParent()) {
         parent->MarkContentLayoutDirty();
@@ -5,6 +5,7 @@
 #include "Pomdog/Experimental/GUI/PointerPoint.hpp"
 #include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
 #include "Pomdog/Experimental/GUI/UIHelper.hpp"
+#include "Pomdog/Experimental/Graphics/SpriteFont.hpp"
 #include "Pomdog/Input/KeyboardState.hpp"
 #include "Pomdog/Input/Keys.hpp"
 #include "Pomdog/Math/MathHelper.hpp"
@@ -97,6 +98,7 @@ void BackspaceText(
 
 TextEdit::TextEdit(const std::shared_ptr<UIEventDispatcher>& dispatcher)
     : Widget(dispatcher)
+    , validCaretOffsetCount(0)
     , textMargin({4, 4, 4, 4})
     , cursorBlinkInterval(Duration::zero())
     , cursorMoveInterval(Duration::zero())
@@ -115,11 +117,21 @@ TextEdit::TextEdit(const std::shared_ptr<UIEventDispatcher>& dispatcher)
 
 void TextEdit::SetFontWeight(FontWeight fontWeightIn)
 {
+    if (fontWeight == fontWeightIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     fontWeight = fontWeightIn;
 }
 
 void TextEdit::SetFontSize(FontSize fontSizeIn)
 {
+    if (fontSize == fontSizeIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     fontSize = fontSizeIn;
 }
 
@@ -135,6 +147,11 @@ bool TextEdit::IsEnabled() const
 
 void TextEdit::SetEnabled(bool enabledIn)
 {
+    if (this->isEnabled == enabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = enabledIn;
     if (!isEnabled) {
         this->cursorPosition = std::nullopt;
@@ -148,6 +165,11 @@ bool TextEdit::IsReadOnly() const
 
 void TextEdit::SetReadOnly(bool readOnlyIn)
 {
+    if (this->isReadOnly == readOnlyIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isReadOnly = readOnlyIn;
 }
 
@@ -158,6 +180,11 @@ bool TextEdit::IsAcceptable() const
 
 void TextEdit::SetAcceptable(bool acceptableIn)
 {
+    if (this->isAcceptable == acceptableIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isAcceptable = acceptableIn;
 }
 
@@ -168,7 +195,13 @@ std::string TextEdit::GetText() const
 
 void TextEdit::SetText(const std::string& textIn)
 {
+    if (this->text == textIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->text = textIn;
+    InvalidateCaretOffsets(0);
 
     if (startSelectionPosition != std::nullopt) {
         // FIXME: UTF-8
@@ -187,6 +220,11 @@ std::string TextEdit::GetPlaceholderText() const
 
 void TextEdit::SetPlaceholderText(const std::string& textIn)
 {
+    if (this->placeholderText == textIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->placeholderText = textIn;
 }
 
@@ -197,11 +235,21 @@ Thickness TextEdit::GetTextMargin() const
 
 void TextEdit::SetTextMargin(const Thickness& margin)
 {
+    if (this->textMargin == margin) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->textMargin = margin;
 }
 
 void TextEdit::SetBaselineHeight(float pixelSize)
 {
+    if (this->baselineHeight == pixelSize) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->baselineHeight = pixelSize;
 }
 
@@ -212,13 +260,23 @@ bool TextEdit::HasSelectedText() const
 
 void TextEdit::SetSelection(int start, int length)
 {
+    auto newStartSelectionPosition = startSelectionPosition;
+    auto newCursorPosition = cursorPosition;
     if (length == 0) {
-        startSelectionPosition = std::nullopt;
+        newStartSelectionPosition = std::nullopt;
     }
     else {
-        startSelectionPosition = std::clamp(start, 0, static_cast<int>(text.size()));
-        cursorPosition = std::clamp(*cursorPosition, 0, start + length);
+        newStartSelectionPosition = std::clamp(start, 0, static_cast<int>(text.size()));
+        newCursorPosition = std::clamp(*cursorPosition, 0, start + length);
     }
+
+    if ((startSelectionPosition == newStartSelectionPosition) && (cursorPosition == newCursorPosition)) {
+        return;
+    }
+
+    MarkRenderDirty();
+    startSelectionPosition = newStartSelectionPosition;
+    cursorPosition = newCursorPosition;
 }
 
 void TextEdit::Deselect()
@@ -231,6 +289,8 @@ void TextEdit::SetHorizontalAlignment(HorizontalAlignment horizontalAlignmentIn)
     if (horizontalAlignment == horizontalAlignmentIn) {
         return;
     }
+
+    MarkRenderDirty();
     horizontalAlignment = horizontalAlignmentIn;
     if (auto parent = GetParent()) {
         parent->MarkContentLayoutDirty();
@@ -299,6 +359,7 @@ void TextEdit::OnTextInput([[maybe_unused]] const KeyboardState& keyboardState,
         case 0x8:
             // NOTE: "Backspace" key
             if (!isReadOnly) {
+                InvalidateCaretOffsets(std::min(*cursorPosition, startSelectionPosition.value_or(*cursorPosition)) - 1);
                 BackspaceText(text, *cursorPosition, startSelectionPosition);
                 textChanged = true;
             }
@@ -306,6 +367,7 @@ void TextEdit::OnTextInput([[maybe_unused]] const KeyboardState& keyboardState,
         case 0x7F:
             // NOTE: "Delete" key
             if (!isReadOnly) {
+                InvalidateCaretOffsets(std::min(*cursorPosition, startSelectionPosition.value_or(*cursorPosition)) - 1);
                 BackspaceText(text, *cursorPosition, startSelectionPosition);
                 textChanged = true;
             }
@@ -327,6 +389,8 @@ void TextEdit::OnTextInput([[maybe_unused]] const KeyboardState& keyboardState,
             break;
         default:
             if (!isReadOnly && (character > 31) && (character < 127)) {
+                InvalidateCaretOffsets(std::min(*cursorPosition, startSelectionPosition.value_or(*cursorPosition)));
+
                 if (HasSelectedText()) {
                     BackspaceText(text, *cursorPosition, startSelectionPosition);
                     Deselect();
@@ -430,15 +494,7 @@ void TextEdit::OnPointerMoved(const PointerPoint& pointerPoint)
         startPosX = *textStartPositionX;
     }
 
-    cursorPosition = 0;
-    // FIXME: UTF-8
-    for (int i = 1; i <= static_cast<int>(text.size()); i++) {
-        auto size = spriteFont->MeasureString(text.substr(0, i));
-        if (size.X > (pointInView.X + startPosX)) {
-            break;
-        }
-        cursorPosition = i;
-    }
+    cursorPosition = FindCaretPosition(pointInView.X + startPosX);
 
     if ((startSelectionPosition == std::nullopt) && (oldCursorPosition != cursorPosition)) {
         startSelectionPosition = oldCursorPosition;
@@ -484,15 +540,7 @@ void TextEdit::OnPointerPressed(const PointerPoint& pointerPoint)
         startPosX = *textStartPositionX;
     }
 
-    cursorPosition = 0;
-    // FIXME: UTF-8
-    for (int i = 1; i <= static_cast<int>(text.size()); i++) {
-        auto size = spriteFont->MeasureString(text.substr(0, i));
-        if (size.X > (pointInView.X + startPosX)) {
-            break;
-        }
-        cursorPosition = i;
-    }
+    cursorPosition = FindCaretPosition(pointInView.X + startPosX);
 
     if (latestKeys.IsKeyUp(Keys::LeftShift) && latestKeys.IsKeyUp(Keys::RightShift)) {
         Deselect();
@@ -513,11 +561,18 @@ void TextEdit::UpdateAnimation(const Duration& frameDuration)
         return;
     }
 
+    const bool wasCursorVisible = ((cursorBlinkInterval.count() / CursorBlinkInterval) <= 0.5);
+
     cursorBlinkInterval += frameDuration;
     if (cursorBlinkInterval.count() >= CursorBlinkInterval) {
         cursorBlinkInterval = Duration::zero();
     }
 
+    // NOTE: The cursor is drawn again only when it blinks.
+    if (wasCursorVisible != ((cursorBlinkInterval.count() / CursorBlinkInterval) <= 0.5)) {
+        MarkRenderDirty();
+    }
+
     cursorMoveInterval += frameDuration;
     if (cursorMoveInterval.count() >= CursorMoveInterval) {
         if (latestKeys.IsKeyDown(Keys::LeftArrow)) {
@@ -531,6 +586,7 @@ void TextEdit::UpdateAnimation(const Duration& frameDuration)
                 cursorMoveInterval);
 
             cursorBlinkInterval = Duration::zero();
+            MarkRenderDirty();
         }
         if (latestKeys.IsKeyDown(Keys::RightArrow)) {
             POMDOG_ASSERT(cursorPosition != std::nullopt);
@@ -543,14 +599,49 @@ void TextEdit::UpdateAnimation(const Duration& frameDuration)
                 cursorMoveInterval);
 
             cursorBlinkInterval = Duration::zero();
+            MarkRenderDirty();
         }
         cursorMoveInterval = Duration::zero();
     }
 }
 
+void TextEdit::InvalidateCaretOffsets(int position)
+{
+    validCaretOffsetCount = std::min(validCaretOffsetCount, static_cast<std::size_t>(std::max(position, 0) + 1));
+}
+
+float TextEdit::GetCaretOffset(int position)
+{
+    POMDOG_ASSERT(spriteFont != nullptr);
+    POMDOG_ASSERT(position >= 0);
+
+    if ((caretOffsets.size() != text.size() + 1) || (validCaretOffsetCount < caretOffsets.size())) {
+        // NOTE: Only the offsets after the edited position are measured again.
+        const auto startIndex = (validCaretOffsetCount > 0) ? validCaretOffsetCount - 1 : 0;
+        spriteFont->MeasureCaretOffsets(text, startIndex, caretOffsets);
+        validCaretOffsetCount = caretOffsets.size();
+    }
+
+    POMDOG_ASSERT(caretOffsets.size() == text.size() + 1);
+    return caretOffsets[std::min(static_cast<std::size_t>(position), text.size())];
+}
+
+int TextEdit::FindCaretPosition(float offsetX)
+{
+    // NOTE: Ensure that the caret offsets are up to date.
+    GetCaretOffset(0);
+
+    POMDOG_ASSERT(!caretOffsets.empty());
+    auto iter = std::upper_bound(std::next(std::begin(caretOffsets)), std::end(caretOffsets), offsetX);
+    return static_cast<int>(std::distance(std::begin(caretOffsets), iter)) - 1;
+}
+
 void TextEdit::Draw(DrawingContext& drawingContext)
 {
-    spriteFont = drawingContext.GetFont(fontWeight, fontSize);
+    if (auto font = drawingContext.GetFont(fontWeight, fontSize); font != spriteFont) {
+        spriteFont = std::move(font);
+        InvalidateCaretOffsets(0);
+    }
 
     const Color textNormalColor = Color{255, 255, 255, 255};
     const Color placeholderTextColor = Color{192, 189, 190, 255};
@@ -598,10 +689,8 @@ void TextEdit::Draw(DrawingContext& drawingContext)
         // FIXME: UTF-8
         POMDOG_ASSERT(positionInText >= 0);
         POMDOG_ASSERT(positionInText <= static_cast<int>(text.size()));
-        auto substring = text.substr(0, positionInText);
-        auto v = spriteFont->MeasureString(substring);
         constexpr float offset = 0.2f;
-        return marginLeftBottom.X + v.X + offset;
+        return marginLeftBottom.X + GetCaretOffset(positionInText) + offset;
     };
 
     Vector2 cursorDrawPosition = Vector2::Zero;
@@ -41,6 +41,11 @@ bool ToggleSwitch::IsOn() const
 
 void ToggleSwitch::SetOn(bool isOnIn)
 {
+    if (this->isOn == isOnIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isOn = isOnIn;
 }
 
@@ -51,6 +56,11 @@ bool ToggleSwitch::IsEnabled() const
 
 void ToggleSwitch::SetEnabled(bool isEnabledIn)
 {
+    if (this->isEnabled == isEnabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = isEnabledIn;
     if (isEnabled) {
         SetCursor(MouseCursor::PointingHand);
@@ -103,6 +113,8 @@ void ToggleSwitch::UpdateAnimation(const Duration& frameDuration)
         return;
     }
 
+    MarkRenderDirty();
+
     constexpr double animationSpeed = 7.0;
     animationDuration += static_cast<float>(frameDuration.count() * animationSpeed);
     if (animationDuration > 1.0f) {
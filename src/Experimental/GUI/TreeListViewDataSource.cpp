@@ -0,0 +1,163 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/GUI/TreeListViewDataSource.hpp"
+#include "Pomdog/Experimental/GUI/TreeViewItem.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include <iterator>
+
+namespace Pomdog::GUI {
+namespace {
+
+constexpr int indentation = 14;
+
+} // namespace
+
+TreeListViewDataSource::TreeListViewDataSource()
+    : needToUpdateItems(false)
+{
+}
+
+int TreeListViewDataSource::AddNode(std::optional<int> parent, const std::string& text)
+{
+    const auto node = static_cast<int>(nodes.size());
+
+    Node newNode;
+    newNode.text = text;
+    newNode.parent = parent;
+
+    if (parent != std::nullopt) {
+        POMDOG_ASSERT((*parent >= 0) && (*parent < node));
+        auto& parentNode = nodes[*parent];
+        newNode.depth = parentNode.depth + 1;
+        parentNode.children.push_back(node);
+    }
+    else {
+        rootNodes.push_back(node);
+    }
+
+    nodes.push_back(std::move(newNode));
+
+    needToUpdateItems = true;
+    ItemsChanged();
+    return node;
+}
+
+void TreeListViewDataSource::Clear()
+{
+    nodes.clear();
+    rootNodes.clear();
+    items.clear();
+    needToUpdateItems = false;
+    ItemsChanged();
+}
+
+int TreeListViewDataSource::GetNodeCount() const noexcept
+{
+    return static_cast<int>(nodes.size());
+}
+
+std::optional<int> TreeListViewDataSource::GetParent(int node) const
+{
+    POMDOG_ASSERT((node >= 0) && (node < static_cast<int>(nodes.size())));
+    return nodes[node].parent;
+}
+
+int TreeListViewDataSource::GetDepth(int node) const
+{
+    POMDOG_ASSERT((node >= 0) && (node < static_cast<int>(nodes.size())));
+    return nodes[node].depth;
+}
+
+bool TreeListViewDataSource::HasChildren(int node) const
+{
+    POMDOG_ASSERT((node >= 0) && (node < static_cast<int>(nodes.size())));
+    return !nodes[node].children.empty();
+}
+
+bool TreeListViewDataSource::IsExpanded(int node) const
+{
+    POMDOG_ASSERT((node >= 0) && (node < static_cast<int>(nodes.size())));
+    return nodes[node].expanded;
+}
+
+void TreeListViewDataSource::SetExpanded(int node, bool expanded)
+{
+    POMDOG_ASSERT((node >= 0) && (node < static_cast<int>(nodes.size())));
+    auto& target = nodes[node];
+    if (target.expanded == expanded) {
+        return;
+    }
+    target.expanded = expanded;
+
+    // NOTE: Expanding or collapsing a leaf node does not change the items.
+    if (!target.children.empty()) {
+        needToUpdateItems = true;
+        ItemsChanged();
+    }
+}
+
+int TreeListViewDataSource::GetNodeAt(int index)
+{
+    UpdateItems();
+    POMDOG_ASSERT((index >= 0) && (index < static_cast<int>(items.size())));
+    return items[index];
+}
+
+int TreeListViewDataSource::GetItemCount()
+{
+    UpdateItems();
+    return static_cast<int>(items.size());
+}
+
+std::shared_ptr<Widget>
+TreeListViewDataSource::CreateItemWidget(const std::shared_ptr<UIEventDispatcher>& dispatcher)
+{
+    auto item = std::make_shared<TreeViewItem>(dispatcher);
+
+    connections.push_back(item->Toggled.Connect([this, widget = item.get()](bool isExpanded) {
+        if (auto iter = boundNodes.find(widget); iter != std::end(boundNodes)) {
+            SetExpanded(iter->second, isExpanded);
+        }
+    }));
+    return item;
+}
+
+void TreeListViewDataSource::BindItemWidget(int index, const std::shared_ptr<Widget>& widget)
+{
+    POMDOG_ASSERT(std::dynamic_pointer_cast<TreeViewItem>(widget) != nullptr);
+    auto item = std::static_pointer_cast<TreeViewItem>(widget);
+
+    const auto node = GetNodeAt(index);
+    const auto& source = nodes[node];
+
+    item->SetText(source.text);
+    item->SetIndentation(source.depth * indentation);
+    item->SetExpandable(!source.children.empty());
+    item->SetExpanded(source.expanded);
+    boundNodes[item.get()] = node;
+}
+
+void TreeListViewDataSource::UpdateItems()
+{
+    if (!needToUpdateItems) {
+        return;
+    }
+    needToUpdateItems = false;
+
+    items.clear();
+
+    // NOTE: Depth-first traversal that skips the children of collapsed nodes.
+    std::vector<int> stack(std::rbegin(rootNodes), std::rend(rootNodes));
+    while (!stack.empty()) {
+        const auto node = stack.back();
+        stack.pop_back();
+        items.push_back(node);
+
+        const auto& source = nodes[node];
+        if (source.expanded) {
+            stack.insert(std::end(stack), std::rbegin(source.children), std::rend(source.children));
+        }
+    }
+}
+
+} // namespace Pomdog::GUI
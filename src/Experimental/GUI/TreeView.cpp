@@ -2,8 +2,6 @@
 
 #include "Pomdog/Experimental/GUI/TreeView.hpp"
 #include "Pomdog/Experimental/GUI/DrawingContext.hpp"
-#include "Pomdog/Experimental/GUI/FontSize.hpp"
-#include "Pomdog/Experimental/GUI/FontWeight.hpp"
 #include "Pomdog/Experimental/GUI/PointerPoint.hpp"
 #include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
 #include "Pomdog/Experimental/GUI/UIHelper.hpp"
@@ -20,31 +18,20 @@ TreeView::TreeView(const std::shared_ptr<UIEventDispatcher>& dispatcher)
 {
     SetSize(50, 12);
 
-    horizontalLayout = std::make_shared<HorizontalLayout>(dispatcher, 140, 10);
-    horizontalLayout->SetStackedLayout(true);
-    horizontalLayout->SetLayoutSpacing(5);
-
-    disclosureTriangleButton = std::make_shared<DisclosureTriangleButton>(dispatcher);
-    horizontalLayout->AddChild(disclosureTriangleButton);
-
-    textBlock = std::make_shared<TextBlock>(dispatcher);
-    textBlock->SetFontWeight(FontWeight::Bold);
-    textBlock->SetColor(Color{252, 251, 248, 255});
-    textBlock->SetBaselineHeight(2.0f);
-    horizontalLayout->AddChild(textBlock);
+    header = std::make_shared<TreeViewItem>(dispatcher);
 
     verticalLayout = std::make_shared<VerticalLayout>(dispatcher, 140, 10);
     verticalLayout->SetLayoutSpacing(8);
     verticalLayout->SetMargin(Thickness{2, 0, 4, 0});
 
-    connection = disclosureTriangleButton->Toggled.Connect([this](bool isOn) {
-        this->SetExpanded(isOn);
+    connection = header->Toggled.Connect([this](bool isExpanded) {
+        this->SetExpanded(isExpanded);
     });
 }
 
 void TreeView::SetText(const std::string& text)
 {
-    textBlock->SetText(text);
+    header->SetText(text);
 }
 
 void TreeView::SetExpanded(bool expandedIn)
@@ -52,8 +39,10 @@ void TreeView::SetExpanded(bool expandedIn)
     if (expanded == expandedIn) {
         return;
     }
+
+    MarkRenderDirty();
     expanded = expandedIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void TreeView::SetVerticalLayoutSpacing(int spacing)
@@ -64,7 +53,7 @@ void TreeView::SetVerticalLayoutSpacing(int spacing)
 
 void TreeView::OnEnter()
 {
-    std::array<std::shared_ptr<Widget>, 2> children = {{horizontalLayout, verticalLayout}};
+    std::array<std::shared_ptr<Widget>, 2> children = {{header, verticalLayout}};
 
     for (auto& child : children) {
         POMDOG_ASSERT(child != nullptr);
@@ -90,19 +79,20 @@ void TreeView::SetPosition(const Point2D& positionIn)
 {
     Widget::SetPosition(positionIn);
     verticalLayout->MarkParentTransformDirty();
-    horizontalLayout->MarkParentTransformDirty();
+    header->MarkParentTransformDirty();
 }
 
 void TreeView::MarkParentTransformDirty()
 {
     Widget::MarkParentTransformDirty();
     verticalLayout->MarkParentTransformDirty();
-    horizontalLayout->MarkParentTransformDirty();
+    header->MarkParentTransformDirty();
 }
 
 void TreeView::MarkContentLayoutDirty()
 {
     needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
 }
 
 void TreeView::AddChild(const std::shared_ptr<Widget>& widget)
@@ -113,13 +103,10 @@ void TreeView::AddChild(const std::shared_ptr<Widget>& widget)
 
 std::shared_ptr<Widget> TreeView::GetChildAt(const Point2D& position)
 {
-    std::array<std::shared_ptr<Widget>, 3> children = {{
-        horizontalLayout,
-        disclosureTriangleButton,
-        verticalLayout}};
+    std::array<std::shared_ptr<Widget>, 2> children = {{header, verticalLayout}};
 
     if (!expanded) {
-        children[2] = nullptr;
+        children[1] = nullptr;
     }
 
     for (auto& child : children) {
@@ -136,35 +123,26 @@ std::shared_ptr<Widget> TreeView::GetChildAt(const Point2D& position)
 
 void TreeView::UpdateAnimation(const Duration& frameDuration)
 {
-    std::array<std::shared_ptr<Widget>, 3> children = {{
-        horizontalLayout,
-        disclosureTriangleButton,
-        verticalLayout}};
-
-    for (auto& child : children) {
-        if (child == nullptr) {
-            continue;
-        }
-        child->UpdateAnimation(frameDuration);
-    }
+    header->UpdateAnimation(frameDuration);
+    verticalLayout->UpdateAnimation(frameDuration);
 }
 
 void TreeView::UpdateLayout()
 {
-    verticalLayout->DoLayout();
-    horizontalLayout->DoLayout();
+    verticalLayout->DoLayoutIfNeeded();
+    header->DoLayoutIfNeeded();
 
     if (!needToUpdateLayout) {
         return;
     }
 
-    disclosureTriangleButton->SetOn(expanded);
+    header->SetExpanded(expanded);
 
     const auto verticalLayoutHeight = verticalLayout->GetHeight();
-    const auto horizontalLayoutHeight = horizontalLayout->GetHeight();
+    const auto headerHeight = header->GetHeight();
 
     {
-        auto requiredHeight = horizontalLayoutHeight;
+        auto requiredHeight = headerHeight;
         if (expanded) {
             requiredHeight += layoutSpacing;
             requiredHeight += verticalLayoutHeight;
@@ -180,13 +158,15 @@ void TreeView::UpdateLayout()
     }
     {
         auto position = Point2D{0, 0};
-        switch (horizontalLayout->GetHorizontalAlignment()) {
+        switch (header->GetHorizontalAlignment()) {
         case HorizontalAlignment::Stretch:
-            horizontalLayout->SetSize(GetWidth(), horizontalLayout->GetHeight());
-            horizontalLayout->MarkContentLayoutDirty();
+            if (GetWidth() != header->GetWidth()) {
+                header->SetSize(GetWidth(), header->GetHeight());
+                header->MarkContentLayoutDirty();
+            }
             break;
         case HorizontalAlignment::Right:
-            position.X = GetWidth() - horizontalLayout->GetWidth();
+            position.X = GetWidth() - header->GetWidth();
             break;
         case HorizontalAlignment::Left:
             break;
@@ -195,7 +175,7 @@ void TreeView::UpdateLayout()
             position.Y += layoutSpacing;
             position.Y += verticalLayoutHeight;
         }
-        horizontalLayout->SetPosition(position);
+        header->SetPosition(position);
     }
     {
         POMDOG_ASSERT(indentation < GetWidth());
@@ -203,8 +183,10 @@ void TreeView::UpdateLayout()
         auto position = Point2D{indentation, 0};
         switch (verticalLayout->GetHorizontalAlignment()) {
         case HorizontalAlignment::Stretch:
-            verticalLayout->SetSize(GetWidth() - indentation, verticalLayout->GetHeight());
-            verticalLayout->MarkContentLayoutDirty();
+            if ((GetWidth() - indentation) != verticalLayout->GetWidth()) {
+                verticalLayout->SetSize(GetWidth() - indentation, verticalLayout->GetHeight());
+                verticalLayout->MarkContentLayoutDirty();
+            }
             break;
         case HorizontalAlignment::Right:
             position.X = GetWidth() - verticalLayout->GetWidth();
@@ -236,7 +218,7 @@ void TreeView::Draw(DrawingContext& drawingContext)
 
     drawingContext.PushTransform(globalPos);
 
-    horizontalLayout->Draw(drawingContext);
+    header->Draw(drawingContext);
 
     if (expanded) {
         verticalLayout->Draw(drawingContext);
@@ -0,0 +1,191 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/GUI/TreeViewItem.hpp"
+#include "Pomdog/Experimental/GUI/DisclosureTriangleButton.hpp"
+#include "Pomdog/Experimental/GUI/DrawingContext.hpp"
+#include "Pomdog/Experimental/GUI/FontWeight.hpp"
+#include "Pomdog/Experimental/GUI/TextBlock.hpp"
+#include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
+#include "Pomdog/Experimental/GUI/UIHelper.hpp"
+#include <algorithm>
+#include <array>
+
+namespace Pomdog::GUI {
+namespace {
+
+constexpr int textSpacing = 5;
+
+} // namespace
+
+TreeViewItem::TreeViewItem(const std::shared_ptr<UIEventDispatcher>& dispatcher)
+    : Widget(dispatcher)
+    , indentation(0)
+    , needToUpdateLayout(true)
+{
+    SetSize(140, 10);
+    SetInteractable(false);
+
+    disclosureTriangleButton = std::make_shared<DisclosureTriangleButton>(dispatcher);
+
+    textBlock = std::make_shared<TextBlock>(dispatcher);
+    textBlock->SetFontWeight(FontWeight::Bold);
+    textBlock->SetColor(Color{252, 251, 248, 255});
+    textBlock->SetBaselineHeight(2.0f);
+
+    connection = disclosureTriangleButton->Toggled.Connect([this](bool isOn) {
+        this->Toggled(isOn);
+    });
+}
+
+void TreeViewItem::SetText(const std::string& text)
+{
+    textBlock->SetText(text);
+}
+
+bool TreeViewItem::IsExpanded() const
+{
+    return disclosureTriangleButton->IsOn();
+}
+
+void TreeViewItem::SetExpanded(bool expanded)
+{
+    disclosureTriangleButton->SetOn(expanded);
+}
+
+void TreeViewItem::SetExpandable(bool expandable)
+{
+    if (disclosureTriangleButton->IsVisible() == expandable) {
+        return;
+    }
+
+    disclosureTriangleButton->SetVisible(expandable);
+    disclosureTriangleButton->SetEnabled(expandable);
+}
+
+void TreeViewItem::SetIndentation(int indentationIn)
+{
+    if (indentation == indentationIn) {
+        return;
+    }
+
+    MarkRenderDirty();
+    indentation = indentationIn;
+    MarkContentLayoutDirty();
+}
+
+HorizontalAlignment TreeViewItem::GetHorizontalAlignment() const noexcept
+{
+    return HorizontalAlignment::Stretch;
+}
+
+VerticalAlignment TreeViewItem::GetVerticalAlignment() const noexcept
+{
+    return VerticalAlignment::Top;
+}
+
+void TreeViewItem::OnEnter()
+{
+    std::array<std::shared_ptr<Widget>, 2> children = {{disclosureTriangleButton, textBlock}};
+
+    for (auto& child : children) {
+        POMDOG_ASSERT(child != nullptr);
+        child->MarkParentTransformDirty();
+
+        POMDOG_ASSERT(shared_from_this());
+        child->SetParent(shared_from_this());
+        child->OnEnter();
+    }
+}
+
+void TreeViewItem::SetPosition(const Point2D& positionIn)
+{
+    Widget::SetPosition(positionIn);
+    disclosureTriangleButton->MarkParentTransformDirty();
+    textBlock->MarkParentTransformDirty();
+}
+
+void TreeViewItem::MarkParentTransformDirty()
+{
+    Widget::MarkParentTransformDirty();
+    disclosureTriangleButton->MarkParentTransformDirty();
+    textBlock->MarkParentTransformDirty();
+}
+
+void TreeViewItem::MarkContentLayoutDirty()
+{
+    needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
+}
+
+std::shared_ptr<Widget> TreeViewItem::GetChildAt(const Point2D& position)
+{
+    if (!disclosureTriangleButton->IsVisible()) {
+        return nullptr;
+    }
+
+    // NOTE: Extends the hit area of the triangle to the full height of the row.
+    const auto bounds = disclosureTriangleButton->GetBounds();
+    if (Rectangle{bounds.X, 0, bounds.Width, GetHeight()}.Contains(position)) {
+        return disclosureTriangleButton;
+    }
+    return nullptr;
+}
+
+void TreeViewItem::UpdateAnimation(const Duration& frameDuration)
+{
+    disclosureTriangleButton->UpdateAnimation(frameDuration);
+    textBlock->UpdateAnimation(frameDuration);
+}
+
+void TreeViewItem::UpdateLayout()
+{
+    if (!needToUpdateLayout) {
+        return;
+    }
+
+    const auto requiredHeight = std::max(disclosureTriangleButton->GetHeight(), textBlock->GetHeight());
+    if (requiredHeight > GetHeight()) {
+        // NOTE: Resizing this panel
+        SetSize(GetWidth(), requiredHeight);
+        if (auto parent = GetParent()) {
+            parent->MarkContentLayoutDirty();
+        }
+    }
+
+    disclosureTriangleButton->SetPosition(Point2D{
+        indentation,
+        (GetHeight() - disclosureTriangleButton->GetHeight()) / 2});
+
+    const auto textX = indentation + disclosureTriangleButton->GetWidth() + textSpacing;
+    const auto textWidth = std::max(1, GetWidth() - textX);
+    if (textWidth != textBlock->GetWidth()) {
+        textBlock->SetSize(textWidth, textBlock->GetHeight());
+        textBlock->MarkContentLayoutDirty();
+    }
+    textBlock->SetPosition(Point2D{textX, (GetHeight() - textBlock->GetHeight()) / 2});
+
+    needToUpdateLayout = false;
+}
+
+void TreeViewItem::DoLayout()
+{
+    UpdateLayout();
+}
+
+void TreeViewItem::Draw(DrawingContext& drawingContext)
+{
+    UpdateLayout();
+
+    auto globalPos = UIHelper::ProjectToWorldSpace(GetPosition(), drawingContext.GetCurrentTransform());
+
+    drawingContext.PushTransform(globalPos);
+
+    if (disclosureTriangleButton->IsVisible()) {
+        disclosureTriangleButton->Draw(drawingContext);
+    }
+    textBlock->Draw(drawingContext);
+
+    drawingContext.PopTransform();
+}
+
+} // namespace Pomdog::GUI
@@ -25,14 +25,15 @@ bool Intersects(const Point2D& position, Widget& widget)
     return bounds.Contains(positionInChild);
 }
 
+// NOTE: The predicates are template parameters rather than std::function
+// because hit testing runs for every pointer event.
+template <typename Func>
 std::shared_ptr<Widget>
 FindTraversal(
     const Point2D& position,
     const std::shared_ptr<Widget>& widget,
-    const std::function<bool(const std::shared_ptr<Widget>&)>& func)
+    const Func& func)
 {
-    POMDOG_ASSERT(func != nullptr);
-
     auto positionInChild = UIHelper::ProjectToChildSpace(position, widget->GetGlobalPosition());
 
     auto child = widget->GetChildAt(positionInChild);
@@ -45,14 +46,13 @@ FindTraversal(
     return child;
 }
 
+template <typename Func>
 std::shared_ptr<Widget>
 Find(
     const Point2D& position,
     const std::vector<std::shared_ptr<Widget>>& widgets,
-    const std::function<bool(const std::shared_ptr<Widget>&)>& func)
+    const Func& func)
 {
-    POMDOG_ASSERT(func != nullptr);
-
     for (const auto& widget : widgets) {
         if ((widget == nullptr) || !widget->IsVisible()) {
             continue;
@@ -97,18 +97,21 @@ UIEventDispatcher::UIEventDispatcher(
     keyDownConn = keyboard->KeyDown.Connect([this](Keys key) {
         if (auto widget = focusedWidget.lock(); widget != nullptr) {
             widget->OnKeyDown(keyboard->GetState(), key);
+            MarkRenderDirty();
         }
     });
 
     keyUpConn = keyboard->KeyUp.Connect([this](Keys key) {
         if (auto widget = focusedWidget.lock(); widget != nullptr) {
             widget->OnKeyUp(keyboard->GetState(), key);
+            MarkRenderDirty();
         }
     });
 
     textInputConn = keyboard->TextInput.Connect([this](const std::string& text) {
         if (auto widget = focusedWidget.lock(); widget != nullptr) {
             widget->OnTextInput(keyboard->GetState(), text);
+            MarkRenderDirty();
         }
     });
 }
@@ -117,13 +120,19 @@ void UIEventDispatcher::SetFocusWidget(const std::shared_ptr<Widget>& widget)
 {
     POMDOG_ASSERT(widget != nullptr);
 
-    if (auto oldFocused = focusedWidget.lock(); oldFocused != nullptr) {
+    auto oldFocused = focusedWidget.lock();
+    if (oldFocused == widget) {
+        return;
+    }
+
+    if (oldFocused != nullptr) {
         oldFocused->OnFocusOut();
         focusedWidget.reset();
     }
 
     focusedWidget = widget;
     widget->OnFocusIn();
+    MarkRenderDirty();
 
     FocusChanged(widget);
 }
@@ -136,6 +145,7 @@ void UIEventDispatcher::ClearFocus(const std::shared_ptr<Widget>& widget)
         if (oldFocused == widget) {
             oldFocused->OnFocusOut();
             focusedWidget.reset();
+            MarkRenderDirty();
         }
     }
 }
@@ -230,6 +240,7 @@ void UIEventDispatcher::Touch(const MouseState& mouseState, std::vector<std::sha
             if (oldMouseWheelDelta != pointerState->pointerPoint.MouseWheelDelta) {
                 POMDOG_ASSERT(wheelFocusChild != nullptr);
                 wheelFocusChild->OnPointerWheelChanged(pointerState->pointerPoint);
+                MarkRenderDirty();
             }
         }
 
@@ -254,6 +265,7 @@ void UIEventDispatcher::PointerEntered(
     pointerState->PrevScrollWheel = mouseState.ScrollWheel;
 
     node->OnPointerEntered(pointerState->pointerPoint);
+    MarkRenderDirty();
     if (node->GetCurrentCursor()) {
         window->SetMouseCursor(*node->GetCurrentCursor());
     }
@@ -279,6 +291,7 @@ void UIEventDispatcher::PointerExited(const Point2D& position)
     auto widget = pointerState->focusedWidget.lock();
     widget->OnPointerExited(pointerState->pointerPoint);
     pointerState.reset();
+    MarkRenderDirty();
 
     window->SetMouseCursor(MouseCursor::Arrow);
 }
@@ -311,6 +324,7 @@ void UIEventDispatcher::PointerPressed(const Point2D& position)
 
     auto widget = pointerState->focusedWidget.lock();
     widget->OnPointerPressed(pointerState->pointerPoint);
+    MarkRenderDirty();
 
     if (auto oldFocused = focusedWidget.lock(); oldFocused != nullptr) {
         if (oldFocused != widget) {
@@ -336,6 +350,13 @@ void UIEventDispatcher::PointerMoved(const Point2D& position)
         return;
     }
 
+    // NOTE: PointerMoved is dispatched every frame while the button is held,
+    // but the widgets only need to be drawn again when the pointer has moved.
+    if ((pointerState->pointerPoint.Event != PointerEventType::Moved) ||
+        (pointerState->pointerPoint.Position != position)) {
+        MarkRenderDirty();
+    }
+
     pointerState->pointerPoint.Event = PointerEventType::Moved;
     pointerState->pointerPoint.Position = position;
 
@@ -357,6 +378,7 @@ void UIEventDispatcher::PointerReleased(const Point2D& position)
 
     auto widget = pointerState->focusedWidget.lock();
     widget->OnPointerReleased(pointerState->pointerPoint);
+    MarkRenderDirty();
 }
 
 void UIEventDispatcher::UpdateAnimation(const Duration& frameDuration)
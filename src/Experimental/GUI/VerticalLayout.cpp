@@ -5,6 +5,7 @@
 #include "Pomdog/Experimental/GUI/PointerPoint.hpp"
 #include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
 #include "Pomdog/Experimental/GUI/UIHelper.hpp"
+#include <algorithm>
 
 namespace Pomdog::GUI {
 
@@ -24,14 +25,24 @@ VerticalLayout::VerticalLayout(
 
 void VerticalLayout::SetMargin(const Thickness& marginIn)
 {
+    if (margin == marginIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     margin = marginIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void VerticalLayout::SetLayoutSpacing(int spacingIn)
 {
+    if (layoutSpacing == spacingIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     layoutSpacing = spacingIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void VerticalLayout::SetStackedLayout(bool isStackedLayoutIn)
@@ -40,8 +51,9 @@ void VerticalLayout::SetStackedLayout(bool isStackedLayoutIn)
         return;
     }
 
+    MarkRenderDirty();
     isStackedLayout = isStackedLayoutIn;
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void VerticalLayout::SetPosition(const Point2D& positionIn)
@@ -65,6 +77,7 @@ void VerticalLayout::MarkParentTransformDirty()
 void VerticalLayout::MarkContentLayoutDirty()
 {
     needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
 }
 
 bool VerticalLayout::GetSizeToFitContent() const noexcept
@@ -88,7 +101,7 @@ void VerticalLayout::AddChild(const std::shared_ptr<Widget>& widget)
     widget->SetParent(shared_from_this());
     widget->OnEnter();
 
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void VerticalLayout::RemoveChild(const std::shared_ptr<Widget>& widget)
@@ -101,7 +114,7 @@ void VerticalLayout::RemoveChild(const std::shared_ptr<Widget>& widget)
     }
     children.erase(iter);
 
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 void VerticalLayout::RemoveChild(int index)
@@ -115,17 +128,34 @@ void VerticalLayout::RemoveChild(int index)
     }
     children.erase(iter);
 
-    needToUpdateLayout = true;
+    MarkContentLayoutDirty();
 }
 
 std::shared_ptr<Widget> VerticalLayout::GetChildAt(const Point2D& position)
 {
-    for (auto& child : children) {
-        POMDOG_ASSERT(child != nullptr);
-        auto bounds = child->GetBounds();
-        if (bounds.Contains(position)) {
-            return child;
+    if (needToUpdateLayout || (layoutSpacing < 0)) {
+        for (auto& child : children) {
+            POMDOG_ASSERT(child != nullptr);
+            auto bounds = child->GetBounds();
+            if (bounds.Contains(position)) {
+                return child;
+            }
         }
+        return nullptr;
+    }
+
+    // NOTE: Once laid out, the children are placed from top to bottom without
+    // overlapping, so the child under the position is found by binary search.
+    // The first child whose bottom is not above the position is the topmost
+    // one that can contain it, which is the same child the linear search finds.
+    auto iter = std::partition_point(std::begin(children), std::end(children),
+        [&](const std::shared_ptr<Widget>& child) {
+            POMDOG_ASSERT(child != nullptr);
+            return child->GetY() > position.Y;
+        });
+
+    if ((iter != std::end(children)) && (*iter)->GetBounds().Contains(position)) {
+        return *iter;
     }
     return nullptr;
 }
@@ -152,7 +182,7 @@ void VerticalLayout::UpdateAnimation(const Duration& frameDuration)
 void VerticalLayout::UpdateLayout()
 {
     for (auto& child : children) {
-        child->DoLayout();
+        child->DoLayoutIfNeeded();
     }
 
     if (!needToUpdateLayout) {
@@ -197,8 +227,10 @@ void VerticalLayout::UpdateLayout()
         switch (child->GetHorizontalAlignment()) {
         case HorizontalAlignment::Stretch: {
             auto childWidth = GetWidth() - (margin.Left + margin.Right);
-            child->SetSize(childWidth, child->GetHeight());
-            child->MarkContentLayoutDirty();
+            if (childWidth != child->GetWidth()) {
+                child->SetSize(childWidth, child->GetHeight());
+                child->MarkContentLayoutDirty();
+            }
             break;
         }
         case HorizontalAlignment::Right: {
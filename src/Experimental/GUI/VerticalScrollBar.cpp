@@ -84,6 +84,8 @@ void VerticalScrollBar::SetValue(double valueIn)
     if (value == valueIn) {
         return;
     }
+
+    MarkRenderDirty();
     this->value = valueIn;
     ValueChanged(this->value);
 }
@@ -95,6 +97,11 @@ double VerticalScrollBar::GetMinimum() const noexcept
 
 void VerticalScrollBar::SetMinimum(double minimumIn) noexcept
 {
+    if (this->minimum == minimumIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->minimum = minimumIn;
 }
 
@@ -105,6 +112,11 @@ double VerticalScrollBar::GetMaximum() const noexcept
 
 void VerticalScrollBar::SetMaximum(double maximumIn) noexcept
 {
+    if (this->maximum == maximumIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->maximum = maximumIn;
 }
 
@@ -115,6 +127,11 @@ double VerticalScrollBar::GetPageStep() const noexcept
 
 void VerticalScrollBar::SetPageStep(double pageStepIn) noexcept
 {
+    if (this->pageStep == pageStepIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->pageStep = pageStepIn;
 }
 
@@ -125,6 +142,11 @@ bool VerticalScrollBar::IsEnabled() const
 
 void VerticalScrollBar::SetEnabled(bool isEnabledIn)
 {
+    if (this->isEnabled == isEnabledIn) {
+        return;
+    }
+
+    MarkRenderDirty();
     this->isEnabled = isEnabledIn;
 }
 
@@ -241,6 +263,8 @@ void VerticalScrollBar::UpdateAnimation(const Duration& frameDuration)
         return;
     }
 
+    MarkRenderDirty();
+
     colorAnimation->time += static_cast<float>(frameDuration.count());
     colorAnimation->time = std::min(colorAnimation->time, colorAnimation->duration);
 
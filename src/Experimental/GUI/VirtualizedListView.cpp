@@ -0,0 +1,378 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/GUI/VirtualizedListView.hpp"
+#include "Pomdog/Experimental/GUI/DrawingContext.hpp"
+#include "Pomdog/Experimental/GUI/ListViewDataSource.hpp"
+#include "Pomdog/Experimental/GUI/ListViewItem.hpp"
+#include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
+#include "Pomdog/Experimental/GUI/UIHelper.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include <algorithm>
+
+namespace Pomdog::GUI {
+
+VirtualizedListView::VirtualizedListView(
+    const std::shared_ptr<UIEventDispatcher>& dispatcher,
+    int widthIn,
+    int itemHeightIn)
+    : Widget(dispatcher)
+    , padding{4, 1, 4, 1}
+    , itemCount(0)
+    , itemHeight(itemHeightIn)
+    , firstRealizedIndex(0)
+    , needToUpdateLayout(true)
+    , needToRebind(false)
+{
+    POMDOG_ASSERT(itemHeight > 0);
+    SetSize(widthIn, padding.Top + padding.Bottom);
+    SetHierarchySortOrder(HierarchySortOrder::Front);
+}
+
+void VirtualizedListView::SetDataSource(const std::shared_ptr<ListViewDataSource>& dataSourceIn)
+{
+    // NOTE: The item widgets are created by the previous data source.
+    realizedItems.clear();
+    recycledItems.clear();
+
+    dataSource = dataSourceIn;
+    ReloadData();
+}
+
+void VirtualizedListView::ReloadData()
+{
+    MarkRenderDirty();
+    itemCount = (dataSource != nullptr) ? std::max(dataSource->GetItemCount(), 0) : 0;
+
+    if (currentIndex && (*currentIndex >= itemCount)) {
+        currentIndex = std::nullopt;
+        CurrentIndexChanged(currentIndex);
+    }
+
+    needToRebind = true;
+    MarkContentLayoutDirty();
+}
+
+int VirtualizedListView::GetItemHeight() const noexcept
+{
+    return itemHeight;
+}
+
+void VirtualizedListView::SetItemHeight(int itemHeightIn)
+{
+    POMDOG_ASSERT(itemHeightIn > 0);
+    if (itemHeight == itemHeightIn) {
+        return;
+    }
+
+    MarkRenderDirty();
+    itemHeight = itemHeightIn;
+    MarkContentLayoutDirty();
+}
+
+void VirtualizedListView::SetPadding(const Thickness& paddingIn)
+{
+    if (padding == paddingIn) {
+        return;
+    }
+
+    MarkRenderDirty();
+    padding = paddingIn;
+    MarkContentLayoutDirty();
+}
+
+int VirtualizedListView::GetItemCount() const noexcept
+{
+    return itemCount;
+}
+
+std::optional<int> VirtualizedListView::GetCurrentIndex() const noexcept
+{
+    return currentIndex;
+}
+
+void VirtualizedListView::SetCurrentIndex(int index)
+{
+    std::optional<int> newIndex;
+    if ((index >= 0) && (index < itemCount)) {
+        newIndex = index;
+    }
+
+    if (currentIndex == newIndex) {
+        return;
+    }
+
+    MarkRenderDirty();
+    currentIndex = newIndex;
+
+    // NOTE: Only the realized items have to be updated.
+    for (int i = 0; i < static_cast<int>(realizedItems.size()); i++) {
+        realizedItems[i]->SetSelected(currentIndex == (firstRealizedIndex + i));
+    }
+
+    // NOTE: An out-of-range index clears the selection and raises the signal
+    // with std::nullopt, as ReloadData() does.
+    CurrentIndexChanged(currentIndex);
+}
+
+void VirtualizedListView::SetPosition(const Point2D& positionIn)
+{
+    const auto isMoved = (GetPosition() != positionIn);
+    Widget::SetPosition(positionIn);
+
+    for (auto& item : realizedItems) {
+        item->MarkParentTransformDirty();
+        if (auto child = item->GetChild(); child != nullptr) {
+            child->MarkParentTransformDirty();
+        }
+    }
+
+    // NOTE: The visible items depend on the position relative to the parent.
+    if (isMoved) {
+        MarkContentLayoutDirty();
+    }
+}
+
+void VirtualizedListView::MarkParentTransformDirty()
+{
+    Widget::MarkParentTransformDirty();
+
+    for (auto& item : realizedItems) {
+        item->MarkParentTransformDirty();
+        if (auto child = item->GetChild(); child != nullptr) {
+            child->MarkParentTransformDirty();
+        }
+    }
+}
+
+void VirtualizedListView::MarkContentLayoutDirty()
+{
+    needToUpdateLayout = true;
+    Widget::MarkContentLayoutDirty();
+}
+
+bool VirtualizedListView::GetSizeToFitContent() const noexcept
+{
+    return false;
+}
+
+std::shared_ptr<Widget> VirtualizedListView::GetChildAt(const Point2D& position)
+{
+    if (realizedItems.empty()) {
+        return nullptr;
+    }
+
+    // NOTE: All items have the same height, so the index is computed directly.
+    const auto offset = (GetHeight() - padding.Top) - position.Y;
+    if (offset < 0) {
+        return nullptr;
+    }
+
+    const auto index = offset / itemHeight;
+    const auto realizedIndex = index - firstRealizedIndex;
+    if ((realizedIndex < 0) || (realizedIndex >= static_cast<int>(realizedItems.size()))) {
+        return nullptr;
+    }
+
+    auto& item = realizedItems[realizedIndex];
+    if (item->GetBounds().Contains(position)) {
+        return item;
+    }
+    return nullptr;
+}
+
+void VirtualizedListView::UpdateAnimation(const Duration& frameDuration)
+{
+    for (auto& item : realizedItems) {
+        item->UpdateAnimation(frameDuration);
+    }
+}
+
+int VirtualizedListView::GetItemY(int index) const noexcept
+{
+    return GetHeight() - padding.Top - (index + 1) * itemHeight;
+}
+
+std::shared_ptr<ListViewItem> VirtualizedListView::DequeueItem()
+{
+    if (!recycledItems.empty()) {
+        auto item = std::move(recycledItems.back());
+        recycledItems.pop_back();
+        item->SetVisible(true);
+        return item;
+    }
+
+    POMDOG_ASSERT(dataSource != nullptr);
+    auto dispatcher = GetDispatcher();
+    auto item = std::make_shared<ListViewItem>(dispatcher);
+    item->SetWidget(dataSource->CreateItemWidget(dispatcher));
+
+    POMDOG_ASSERT(shared_from_this());
+    item->SetParent(shared_from_this());
+    item->OnEnter();
+    return item;
+}
+
+void VirtualizedListView::RecycleItem(std::shared_ptr<ListViewItem>&& item)
+{
+    POMDOG_ASSERT(item != nullptr);
+    item->SetVisible(false);
+    recycledItems.push_back(std::move(item));
+}
+
+void VirtualizedListView::RealizeItems(int firstIndex, int lastIndex)
+{
+    POMDOG_ASSERT(firstIndex <= lastIndex);
+
+    if (needToRebind) {
+        while (!realizedItems.empty()) {
+            RecycleItem(std::move(realizedItems.back()));
+            realizedItems.pop_back();
+        }
+        needToRebind = false;
+    }
+
+    // NOTE: Recycle the items that scrolled out of the range.
+    while (!realizedItems.empty() && (firstRealizedIndex < firstIndex)) {
+        RecycleItem(std::move(realizedItems.front()));
+        realizedItems.pop_front();
+        ++firstRealizedIndex;
+    }
+    while (!realizedItems.empty() &&
+           (firstRealizedIndex + static_cast<int>(realizedItems.size()) > lastIndex)) {
+        RecycleItem(std::move(realizedItems.back()));
+        realizedItems.pop_back();
+    }
+
+    if (realizedItems.empty()) {
+        firstRealizedIndex = firstIndex;
+    }
+
+    auto bindItem = [&](int index) {
+        auto item = DequeueItem();
+        item->SetListViewIndex(index);
+        item->SetSelected(currentIndex == index);
+        dataSource->BindItemWidget(index, item->GetChild());
+        return item;
+    };
+
+    // NOTE: Realize the items that scrolled into the range.
+    while (firstRealizedIndex > firstIndex) {
+        --firstRealizedIndex;
+        realizedItems.push_front(bindItem(firstRealizedIndex));
+    }
+    while (firstRealizedIndex + static_cast<int>(realizedItems.size()) < lastIndex) {
+        realizedItems.push_back(bindItem(firstRealizedIndex + static_cast<int>(realizedItems.size())));
+    }
+
+    const auto itemWidth = GetWidth() - (padding.Left + padding.Right);
+    for (int i = 0; i < static_cast<int>(realizedItems.size()); i++) {
+        auto& item = realizedItems[i];
+        item->SetPosition(Point2D{padding.Left, GetItemY(firstRealizedIndex + i)});
+        item->SetSize(itemWidth, itemHeight);
+        item->MarkParentTransformDirty();
+        if (auto child = item->GetChild(); child != nullptr) {
+            child->MarkParentTransformDirty();
+        }
+        item->DoLayout();
+    }
+}
+
+void VirtualizedListView::UpdateLayout()
+{
+    for (auto& item : realizedItems) {
+        item->DoLayoutIfNeeded();
+    }
+
+    if (!needToUpdateLayout) {
+        return;
+    }
+    needToUpdateLayout = false;
+
+    const auto requiredHeight = padding.Top + itemCount * itemHeight + padding.Bottom;
+    if (requiredHeight != GetHeight()) {
+        // NOTE: Keeping the original position
+        const auto positionOffset = Point2D{0, GetHeight() - requiredHeight};
+        Widget::SetPosition(GetPosition() + positionOffset);
+
+        // NOTE: Resizing this panel
+        SetSize(GetWidth(), requiredHeight);
+
+        if (auto parent = GetParent(); parent != nullptr) {
+            parent->MarkContentLayoutDirty();
+        }
+    }
+
+    if (dataSource == nullptr) {
+        POMDOG_ASSERT(realizedItems.empty());
+        return;
+    }
+
+    // NOTE: The range of this widget that is visible through the parent,
+    // in the local coordinate system of this widget.
+    int visibleMin = 0;
+    int visibleMax = GetHeight();
+    if (auto parent = GetParent(); parent != nullptr) {
+        visibleMin = std::max(0, -GetY());
+        visibleMax = std::min(GetHeight(), parent->GetHeight() - GetY());
+    }
+
+    int firstIndex = 0;
+    int lastIndex = 0;
+    if (visibleMin < visibleMax) {
+        const auto top = GetHeight() - padding.Top;
+        firstIndex = std::max(0, (top - visibleMax) / itemHeight);
+        const auto bottomOffset = top - visibleMin;
+        lastIndex = (bottomOffset > 0) ? (bottomOffset + itemHeight - 1) / itemHeight : 0;
+        lastIndex = std::clamp(lastIndex, 0, itemCount);
+        firstIndex = std::min(firstIndex, lastIndex);
+    }
+
+    RealizeItems(firstIndex, lastIndex);
+}
+
+void VirtualizedListView::DoLayout()
+{
+    UpdateLayout();
+}
+
+void VirtualizedListView::Draw(DrawingContext& drawingContext)
+{
+    UpdateLayout();
+
+    const auto* colorScheme = drawingContext.GetColorScheme();
+    POMDOG_ASSERT(colorScheme != nullptr);
+
+    auto globalPos = UIHelper::ProjectToWorldSpace(GetPosition(), drawingContext.GetCurrentTransform());
+
+    auto primitiveBatch = drawingContext.GetPrimitiveBatch();
+
+    if (colorScheme->ListViewBackgroundColorOdd.A > 0) {
+        primitiveBatch->DrawRectangle(
+            Rectangle{globalPos.X, globalPos.Y, GetWidth(), GetHeight()},
+            colorScheme->ListViewBackgroundColorOdd);
+    }
+
+    if (colorScheme->ListViewBackgroundColorEven.A > 0) {
+        for (int i = 0; i < static_cast<int>(realizedItems.size()); i++) {
+            const auto index = firstRealizedIndex + i;
+            if (index % 2 == 0) {
+                continue;
+            }
+            primitiveBatch->DrawRectangle(
+                Rectangle{globalPos.X, globalPos.Y + GetItemY(index), GetWidth(), itemHeight},
+                colorScheme->ListViewBackgroundColorEven);
+        }
+    }
+
+    primitiveBatch->Flush();
+
+    drawingContext.PushTransform(globalPos);
+
+    for (auto& item : realizedItems) {
+        item->Draw(drawingContext);
+    }
+
+    drawingContext.PopTransform();
+}
+
+} // namespace Pomdog::GUI
@@ -2,6 +2,7 @@
 // Distributed under the MIT license. See LICENSE.md file for details.
 
 #include "Pomdog/Experimental/GUI/Widget.hpp"
+#include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 
 namespace Pomdog::GUI {
@@ -14,6 +15,7 @@ Widget::Widget(const std::shared_ptr<UIEventDispatcher>& dispatcherIn)
     , width(1)
     , hierarchySortOrder(HierarchySortOrder::Sortable)
     , isParentTransformDirty(true)
+    , isLayoutDirty(true)
     , isVisible(true)
     , isInteractable(true)
     , isWheelFocusEnabled(false)
@@ -29,6 +31,10 @@ void Widget::SetParent(const std::shared_ptr<Widget>& parentIn)
 {
     this->weakParent = parentIn;
     POMDOG_ASSERT(this->weakDispatcher.lock() == parentIn->GetDispatcher());
+
+    if (isLayoutDirty) {
+        MarkLayoutDirty();
+    }
 }
 
 std::shared_ptr<Widget const> Widget::GetParent() const
@@ -63,6 +69,10 @@ int Widget::GetHeight() const noexcept
 
 void Widget::SetSize(int widthIn, int heightIn)
 {
+    if ((this->width != widthIn) || (this->height != heightIn)) {
+        MarkLayoutDirty();
+        MarkRenderDirty();
+    }
     this->width = widthIn;
     this->height = heightIn;
 }
@@ -77,6 +87,13 @@ void Widget::MarkParentTransformDirty()
     this->isParentTransformDirty = true;
 }
 
+void Widget::MarkRenderDirty() noexcept
+{
+    if (auto dispatcher = weakDispatcher.lock(); dispatcher != nullptr) {
+        dispatcher->MarkRenderDirty();
+    }
+}
+
 Point2D Widget::GetGlobalPosition()
 {
     if (isParentTransformDirty) {
@@ -100,6 +117,9 @@ bool Widget::IsVisible() const noexcept
 
 void Widget::SetVisible(bool visible) noexcept
 {
+    if (this->isVisible != visible) {
+        MarkRenderDirty();
+    }
     this->isVisible = visible;
 }
 
@@ -110,6 +130,9 @@ bool Widget::IsInteractable() const noexcept
 
 void Widget::SetInteractable(bool interactable) noexcept
 {
+    if (this->isInteractable != interactable) {
+        MarkRenderDirty();
+    }
     this->isInteractable = interactable;
 }
 
@@ -140,17 +163,50 @@ Point2D Widget::GetPosition() const noexcept
 
 void Widget::SetPosition(const Point2D& positionIn)
 {
+    if (this->localPosition != positionIn) {
+        MarkRenderDirty();
+    }
     this->localPosition = positionIn;
 }
 
 void Widget::MarkContentLayoutDirty()
 {
+    MarkLayoutDirty();
+    MarkRenderDirty();
 }
 
 void Widget::DoLayout()
 {
 }
 
+bool Widget::IsLayoutDirty() const noexcept
+{
+    return isLayoutDirty;
+}
+
+void Widget::MarkLayoutDirty() noexcept
+{
+    // NOTE: The ancestors are always visited because a parent is cleared
+    // before it lays out its children, so a dirty widget does not imply
+    // that its ancestors are dirty.
+    isLayoutDirty = true;
+    for (auto widget = weakParent.lock(); widget != nullptr; widget = widget->weakParent.lock()) {
+        widget->isLayoutDirty = true;
+    }
+}
+
+void Widget::DoLayoutIfNeeded()
+{
+    if (!isLayoutDirty) {
+        return;
+    }
+
+    // NOTE: The flag is cleared before DoLayout() so that widgets marked
+    // during the layout are laid out again in the next pass.
+    isLayoutDirty = false;
+    DoLayout();
+}
+
 std::shared_ptr<Widget> Widget::GetChildAt([[maybe_unused]] const Point2D& positionIn)
 {
     return nullptr;
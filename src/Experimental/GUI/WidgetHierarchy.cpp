@@ -11,6 +11,8 @@ WidgetHierarchy::WidgetHierarchy(
     const std::shared_ptr<GameWindow>& window,
     const std::shared_ptr<Keyboard>& keyboard)
     : viewportHeight(window->GetClientBounds().Height)
+    , needToSort(true)
+    , isRetainedRenderingEnabled(false)
 {
     dispatcher = std::make_shared<UIEventDispatcher>(window, keyboard);
 
@@ -95,12 +97,17 @@ void WidgetHierarchy::Update()
             subscribeRequests.clear();
         }
         POMDOG_ASSERT(subscribeRequests.empty());
+        needToSort = true;
+        dispatcher->MarkRenderDirty();
     }
 
     auto f = [](const std::shared_ptr<Widget>& p) { return p == nullptr; };
-    children.erase(
-        std::remove_if(std::begin(children), std::end(children), f),
-        std::end(children));
+    if (auto iter = std::remove_if(std::begin(children), std::end(children), f); iter != std::end(children)) {
+        // NOTE: Removing widgets keeps the relative order of the others,
+        // so the children do not need to be sorted again.
+        children.erase(iter, std::end(children));
+        dispatcher->MarkRenderDirty();
+    }
 
     if (auto focusedWidget = dispatcher->GetFocusWidget(); focusedWidget != nullptr) {
         auto parent = focusedWidget;
@@ -110,7 +117,9 @@ void WidgetHierarchy::Update()
             next = parent->GetParent();
         }
 
-        if (parent != nullptr) {
+        // NOTE: The order only depends on the root of the focused widget, so
+        // sorting is skipped unless it or the set of children has changed.
+        if ((parent != nullptr) && (needToSort || (parent != sortedFocusRoot.lock()))) {
             std::stable_sort(std::begin(children), std::end(children),
                 [&](const std::shared_ptr<Widget>& a, const std::shared_ptr<Widget>& b) -> bool {
                     const auto x = a->GetHierarchySortOrder();
@@ -120,11 +129,38 @@ void WidgetHierarchy::Update()
                     }
                     return x < y;
                 });
+
+            sortedFocusRoot = parent;
+            needToSort = false;
+            dispatcher->MarkRenderDirty();
         }
     }
 
     POMDOG_ASSERT(std::end(children) == std::unique(std::begin(children), std::end(children),
         [](const std::shared_ptr<Widget>& a, const std::shared_ptr<Widget>& b) { return a == b; }));
+
+    UpdateLayout();
+}
+
+void WidgetHierarchy::UpdateLayout()
+{
+    // NOTE: Only the dirty subtrees are laid out. Each pass measures the dirty
+    // children and then arranges their parents, so a resize that propagates
+    // through nested layouts (e.g. dragging a HorizontalSplitter) settles
+    // within the frame instead of being spread across several frames.
+    constexpr int maxLayoutPasses = 8;
+
+    for (int pass = 0; pass < maxLayoutPasses; pass++) {
+        bool isLayoutDirty = false;
+        for (const auto& child : children) {
+            POMDOG_ASSERT(child != nullptr);
+            child->DoLayoutIfNeeded();
+            isLayoutDirty = isLayoutDirty || child->IsLayoutDirty();
+        }
+        if (!isLayoutDirty) {
+            break;
+        }
+    }
 }
 
 void WidgetHierarchy::UpdateAnimation(const Duration& frameDuration)
@@ -140,6 +176,29 @@ void WidgetHierarchy::UpdateAnimation(const Duration& frameDuration)
 }
 
 void WidgetHierarchy::Draw(DrawingContext& drawingContext)
+{
+    POMDOG_ASSERT(dispatcher);
+
+    if (!isRetainedRenderingEnabled) {
+        DrawChildren(drawingContext);
+        return;
+    }
+
+    if (!dispatcher->IsRenderDirty() && drawingContext.CanReplay(drawingCache)) {
+        drawingContext.Replay(drawingCache);
+        return;
+    }
+
+    // NOTE: The flag is cleared before drawing so that widgets that change
+    // while they are drawn are drawn again on the next frame.
+    dispatcher->ClearRenderDirty();
+
+    drawingContext.BeginRecording(drawingCache);
+    DrawChildren(drawingContext);
+    drawingContext.EndRecording();
+}
+
+void WidgetHierarchy::DrawChildren(DrawingContext& drawingContext)
 {
     drawingContext.PushTransform(Point2D{0, 0});
 
@@ -156,6 +215,7 @@ void WidgetHierarchy::RenderSizeChanged(int width, int height)
     const auto translationOffset = Point2D{0, height - viewportHeight};
 
     viewportHeight = height;
+    dispatcher->MarkRenderDirty();
 
     for (const auto& child : children) {
         POMDOG_ASSERT(child != nullptr);
@@ -171,4 +231,17 @@ void WidgetHierarchy::RenderSizeChanged(int width, int height)
     }
 }
 
+void WidgetHierarchy::SetRetainedRenderingEnabled(bool enabled) noexcept
+{
+    if (isRetainedRenderingEnabled != enabled) {
+        drawingCache.Clear();
+    }
+    isRetainedRenderingEnabled = enabled;
+}
+
+bool WidgetHierarchy::IsRetainedRenderingEnabled() const noexcept
+{
+    return isRetainedRenderingEnabled;
+}
+
 } // namespace Pomdog::GUI
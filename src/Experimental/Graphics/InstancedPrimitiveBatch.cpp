@@ -0,0 +1,409 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/Graphics/InstancedPrimitiveBatch.hpp"
+#include "Pomdog/Content/AssetBuilders/PipelineStateBuilder.hpp"
+#include "Pomdog/Content/AssetBuilders/ShaderBuilder.hpp"
+#include "Pomdog/Content/AssetManager.hpp"
+#include "Pomdog/Experimental/Graphics/PrimitiveInstanceBuilder.hpp"
+#include "Pomdog/Graphics/BlendDescription.hpp"
+#include "Pomdog/Graphics/BufferUsage.hpp"
+#include "Pomdog/Graphics/ConstantBuffer.hpp"
+#include "Pomdog/Graphics/DepthStencilDescription.hpp"
+#include "Pomdog/Graphics/GraphicsCommandList.hpp"
+#include "Pomdog/Graphics/GraphicsDevice.hpp"
+#include "Pomdog/Graphics/InputLayoutHelper.hpp"
+#include "Pomdog/Graphics/PipelineState.hpp"
+#include "Pomdog/Graphics/PresentationParameters.hpp"
+#include "Pomdog/Graphics/PrimitiveTopology.hpp"
+#include "Pomdog/Graphics/RasterizerDescription.hpp"
+#include "Pomdog/Graphics/Shader.hpp"
+#include "Pomdog/Graphics/VertexBuffer.hpp"
+#include "Pomdog/Math/Color.hpp"
+#include "Pomdog/Math/MathHelper.hpp"
+#include "Pomdog/Math/Matrix3x2.hpp"
+#include "Pomdog/Math/Matrix4x4.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
+#include "Pomdog/Math/Vector2.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace Pomdog {
+namespace {
+
+// Built-in shaders
+#include "Shaders/GLSL.Embedded/InstancedPrimitiveBatch_VS.inc.hpp"
+#include "Shaders/GLSL.Embedded/PrimitiveBatch_PS.inc.hpp"
+#include "Shaders/HLSL.Embedded/InstancedPrimitiveBatch.inc.hpp"
+#include "Shaders/Metal.Embedded/InstancedPrimitiveBatch.inc.hpp"
+
+struct UnitMeshRange final {
+    std::size_t StartVertexLocation;
+    std::size_t VertexCount;
+};
+
+} // unnamed namespace
+
+// MARK: - InstancedPrimitiveBatch::Impl
+
+class InstancedPrimitiveBatch::Impl {
+public:
+    static constexpr std::size_t DefaultMaxInstanceCount = 4096;
+    static constexpr int CircleSegments = 64;
+
+private:
+    std::shared_ptr<GraphicsDevice> graphicsDevice;
+    std::shared_ptr<GraphicsCommandList> commandList;
+    std::shared_ptr<VertexBuffer> unitMeshVertices;
+    std::vector<std::shared_ptr<VertexBuffer>> instanceBuffers;
+    std::shared_ptr<PipelineState> pipelineState;
+    std::shared_ptr<ConstantBuffer> constantBuffer;
+    std::array<UnitMeshRange, 3> unitMeshRanges;
+
+public:
+    PrimitiveInstanceBuilder instances;
+    std::size_t bufferIndex;
+    std::size_t startInstanceLocation;
+    int drawCallCount;
+
+public:
+    Impl(
+        const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+        std::optional<DepthStencilDescription>&& depthStencilDesc,
+        std::optional<RasterizerDescription>&& rasterizerDesc,
+        std::size_t maxInstanceCount,
+        AssetManager& assets);
+
+    void Begin(
+        const std::shared_ptr<GraphicsCommandList>& commandListIn,
+        const Matrix4x4& transformMatrix);
+
+    void End();
+
+    void Flush();
+
+private:
+    void CreateUnitMeshes();
+};
+
+InstancedPrimitiveBatch::Impl::Impl(
+    const std::shared_ptr<GraphicsDevice>& graphicsDeviceIn,
+    std::optional<DepthStencilDescription>&& depthStencilDesc,
+    std::optional<RasterizerDescription>&& rasterizerDesc,
+    std::size_t maxInstanceCount,
+    AssetManager& assets)
+    : graphicsDevice(graphicsDeviceIn)
+    , instances(maxInstanceCount, [this] { Flush(); })
+    , bufferIndex(0)
+    , startInstanceLocation(0)
+    , drawCallCount(0)
+{
+    if (!depthStencilDesc) {
+        depthStencilDesc = DepthStencilDescription::CreateNone();
+    }
+    if (!rasterizerDesc) {
+        // NOTE: The affine transform of an instance may flip the winding order
+        // of the unit mesh (e.g. triangles or negative scales), so culling is
+        // disabled by default.
+        rasterizerDesc = RasterizerDescription::CreateCullNone();
+    }
+
+    POMDOG_ASSERT(depthStencilDesc);
+    POMDOG_ASSERT(rasterizerDesc);
+
+    CreateUnitMeshes();
+    {
+        instanceBuffers.push_back(std::make_shared<VertexBuffer>(graphicsDevice,
+            instances.GetMaxInstanceCount(), sizeof(PrimitiveInstance), BufferUsage::Dynamic));
+    }
+    {
+        auto inputLayout = InputLayoutHelper{}
+            .AddInputSlot()
+            .Float2()
+            .AddInputSlot(InputClassification::InputPerInstance, 1)
+            .Float4().Float4().Float4();
+
+        auto vertexShader = assets.CreateBuilder<Shader>(ShaderPipelineStage::VertexShader)
+            .SetGLSL(Builtin_GLSL_InstancedPrimitiveBatch_VS, std::strlen(Builtin_GLSL_InstancedPrimitiveBatch_VS))
+            .SetHLSL(BuiltinHLSL_InstancedPrimitiveBatch, std::strlen(BuiltinHLSL_InstancedPrimitiveBatch), "InstancedPrimitiveBatchVS")
+            .SetMetal(Builtin_Metal_InstancedPrimitiveBatch, std::strlen(Builtin_Metal_InstancedPrimitiveBatch), "InstancedPrimitiveBatchVS");
+
+        auto pixelShader = assets.CreateBuilder<Shader>(ShaderPipelineStage::PixelShader)
+            .SetGLSL(Builtin_GLSL_PrimitiveBatch_PS, std::strlen(Builtin_GLSL_PrimitiveBatch_PS))
+            .SetHLSL(BuiltinHLSL_InstancedPrimitiveBatch, std::strlen(BuiltinHLSL_InstancedPrimitiveBatch), "InstancedPrimitiveBatchPS")
+            .SetMetal(Builtin_Metal_InstancedPrimitiveBatch, std::strlen(Builtin_Metal_InstancedPrimitiveBatch), "InstancedPrimitiveBatchPS");
+
+        auto presentationParameters = graphicsDevice->GetPresentationParameters();
+
+        auto builder = assets.CreateBuilder<PipelineState>();
+        pipelineState = builder
+            .SetRenderTargetViewFormat(presentationParameters.BackBufferFormat)
+            .SetDepthStencilViewFormat(presentationParameters.DepthStencilFormat)
+            .SetVertexShader(vertexShader.Build())
+            .SetPixelShader(pixelShader.Build())
+            .SetInputLayout(inputLayout.CreateInputLayout())
+            .SetPrimitiveTopology(PrimitiveTopology::TriangleList)
+            .SetBlendState(BlendDescription::CreateNonPremultiplied())
+            .SetDepthStencilState(*depthStencilDesc)
+            .SetRasterizerState(*rasterizerDesc)
+            .SetConstantBufferBindSlot("TransformMatrix", 0)
+            .Build();
+    }
+
+    constantBuffer = std::make_shared<ConstantBuffer>(
+        graphicsDevice, sizeof(Matrix4x4), BufferUsage::Dynamic);
+}
+
+void InstancedPrimitiveBatch::Impl::CreateUnitMeshes()
+{
+    std::vector<Vector2> vertices;
+    vertices.reserve(3 + 6 + CircleSegments * 3);
+
+    auto addRange = [&](PrimitiveInstanceShape shape, auto&& appendVertices) {
+        const auto start = vertices.size();
+        appendVertices();
+        auto& range = unitMeshRanges[static_cast<std::size_t>(shape)];
+        range.StartVertexLocation = start;
+        range.VertexCount = vertices.size() - start;
+    };
+
+    addRange(PrimitiveInstanceShape::Triangle, [&] {
+        vertices.push_back(Vector2{0.0f, 0.0f});
+        vertices.push_back(Vector2{1.0f, 0.0f});
+        vertices.push_back(Vector2{0.0f, 1.0f});
+    });
+
+    addRange(PrimitiveInstanceShape::Rectangle, [&] {
+        vertices.push_back(Vector2{0.0f, 0.0f});
+        vertices.push_back(Vector2{0.0f, 1.0f});
+        vertices.push_back(Vector2{1.0f, 1.0f});
+        vertices.push_back(Vector2{1.0f, 1.0f});
+        vertices.push_back(Vector2{1.0f, 0.0f});
+        vertices.push_back(Vector2{0.0f, 0.0f});
+    });
+
+    addRange(PrimitiveInstanceShape::Circle, [&] {
+        const auto delta = Math::TwoPi<float> / static_cast<float>(CircleSegments);
+        auto prevPoint = Vector2{1.0f, 0.0f};
+        for (int i = 1; i <= CircleSegments; ++i) {
+            const auto rad = delta * static_cast<float>(i);
+            const auto nextPoint = Vector2{std::cos(rad), std::sin(rad)};
+            vertices.push_back(nextPoint);
+            vertices.push_back(prevPoint);
+            vertices.push_back(Vector2::Zero);
+            prevPoint = nextPoint;
+        }
+    });
+
+    unitMeshVertices = std::make_shared<VertexBuffer>(
+        graphicsDevice,
+        vertices.data(),
+        vertices.size(),
+        sizeof(Vector2),
+        BufferUsage::Immutable);
+}
+
+void InstancedPrimitiveBatch::Impl::Begin(
+    const std::shared_ptr<GraphicsCommandList>& commandListIn,
+    const Matrix4x4& transformMatrix)
+{
+    POMDOG_ASSERT(commandListIn);
+    commandList = commandListIn;
+
+    alignas(16) Matrix4x4 transposedMatrix = Matrix4x4::Transpose(transformMatrix);
+    constantBuffer->SetValue(transposedMatrix);
+
+    bufferIndex = 0;
+    startInstanceLocation = 0;
+    drawCallCount = 0;
+}
+
+void InstancedPrimitiveBatch::Impl::End()
+{
+    Flush();
+    commandList.reset();
+}
+
+void InstancedPrimitiveBatch::Impl::Flush()
+{
+    if (instances.IsEmpty()) {
+        return;
+    }
+
+    POMDOG_ASSERT(commandList);
+    POMDOG_ASSERT(instances.GetInstanceCount() <= instances.GetMaxInstanceCount());
+
+    const auto maxInstanceCount = instances.GetMaxInstanceCount();
+
+    if ((startInstanceLocation + instances.GetInstanceCount()) > maxInstanceCount) {
+        // NOTE: The current instance buffer is referenced by draw calls that have
+        // already been recorded, so the remaining instances go to the next one.
+        ++bufferIndex;
+        startInstanceLocation = 0;
+    }
+
+    if (bufferIndex >= instanceBuffers.size()) {
+        instanceBuffers.push_back(std::make_shared<VertexBuffer>(graphicsDevice,
+            maxInstanceCount, sizeof(PrimitiveInstance), BufferUsage::Dynamic));
+    }
+
+    POMDOG_ASSERT(bufferIndex < instanceBuffers.size());
+    const auto& instanceBuffer = instanceBuffers[bufferIndex];
+    POMDOG_ASSERT((startInstanceLocation + instances.GetInstanceCount()) <= maxInstanceCount);
+
+    const auto instanceOffsetBytes = sizeof(PrimitiveInstance) * startInstanceLocation;
+    instanceBuffer->SetData(
+        instanceOffsetBytes,
+        instances.GetData(),
+        instances.GetInstanceCount(),
+        sizeof(PrimitiveInstance));
+
+    commandList->SetPipelineState(pipelineState);
+    commandList->SetConstantBuffer(0, constantBuffer);
+    commandList->SetVertexBuffer(0, unitMeshVertices);
+    commandList->SetVertexBuffer(1, instanceBuffer);
+
+    for (const auto& range : instances.GetRanges()) {
+        POMDOG_ASSERT(range.InstanceCount > 0);
+        const auto& mesh = unitMeshRanges[static_cast<std::size_t>(range.Shape)];
+
+        commandList->DrawInstanced(
+            mesh.VertexCount,
+            range.InstanceCount,
+            mesh.StartVertexLocation,
+            startInstanceLocation + range.StartInstanceLocation);
+
+        ++drawCallCount;
+    }
+
+    startInstanceLocation += instances.GetInstanceCount();
+    POMDOG_ASSERT(startInstanceLocation <= maxInstanceCount);
+
+    instances.Reset();
+}
+
+// MARK: - InstancedPrimitiveBatch
+
+InstancedPrimitiveBatch::InstancedPrimitiveBatch(
+    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    AssetManager& assets)
+    : InstancedPrimitiveBatch(
+        graphicsDevice,
+        std::nullopt,
+        std::nullopt,
+        Impl::DefaultMaxInstanceCount,
+        assets)
+{
+}
+
+InstancedPrimitiveBatch::InstancedPrimitiveBatch(
+    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    std::optional<DepthStencilDescription>&& depthStencilDesc,
+    std::optional<RasterizerDescription>&& rasterizerDesc,
+    std::size_t maxInstanceCount,
+    AssetManager& assets)
+    : impl(std::make_unique<Impl>(
+        graphicsDevice,
+        std::move(depthStencilDesc),
+        std::move(rasterizerDesc),
+        maxInstanceCount,
+        assets))
+{
+}
+
+InstancedPrimitiveBatch::~InstancedPrimitiveBatch() = default;
+
+void InstancedPrimitiveBatch::Begin(
+    const std::shared_ptr<GraphicsCommandList>& commandListIn,
+    const Matrix4x4& transformMatrixIn)
+{
+    POMDOG_ASSERT(impl);
+    impl->Begin(commandListIn, transformMatrixIn);
+}
+
+void InstancedPrimitiveBatch::DrawCircle(
+    const Vector2& position,
+    float radius,
+    const Color& color)
+{
+    POMDOG_ASSERT(impl);
+    impl->instances.DrawCircle(position, radius, color);
+}
+
+void InstancedPrimitiveBatch::DrawEllipse(
+    const Vector2& position,
+    float radiusX,
+    float radiusY,
+    const Color& color)
+{
+    POMDOG_ASSERT(impl);
+    impl->instances.DrawEllipse(position, radiusX, radiusY, color);
+}
+
+void InstancedPrimitiveBatch::DrawRectangle(
+    const Rectangle& sourceRect,
+    const Color& color)
+{
+    POMDOG_ASSERT(impl);
+    impl->instances.DrawRectangle(sourceRect, color);
+}
+
+void InstancedPrimitiveBatch::DrawRectangle(
+    const Matrix3x2& matrix,
+    const Vector2& position,
+    float width,
+    float height,
+    const Color& color)
+{
+    POMDOG_ASSERT(impl);
+    impl->instances.DrawRectangle(matrix, position, width, height, color);
+}
+
+void InstancedPrimitiveBatch::DrawRectangle(
+    const Vector2& position,
+    float width,
+    float height,
+    const Vector2& originPivot,
+    const Color& color)
+{
+    POMDOG_ASSERT(impl);
+    impl->instances.DrawRectangle(position, width, height, originPivot, color);
+}
+
+void InstancedPrimitiveBatch::DrawTriangle(
+    const Vector2& point1,
+    const Vector2& point2,
+    const Vector2& point3,
+    const Color& color)
+{
+    POMDOG_ASSERT(impl);
+    impl->instances.DrawTriangle(point1, point2, point3, color);
+}
+
+void InstancedPrimitiveBatch::Flush()
+{
+    POMDOG_ASSERT(impl);
+    impl->Flush();
+}
+
+void InstancedPrimitiveBatch::End()
+{
+    POMDOG_ASSERT(impl);
+    impl->End();
+}
+
+std::size_t InstancedPrimitiveBatch::GetMaxInstanceCount() const noexcept
+{
+    POMDOG_ASSERT(impl);
+    return impl->instances.GetMaxInstanceCount();
+}
+
+int InstancedPrimitiveBatch::GetDrawCallCount() const noexcept
+{
+    POMDOG_ASSERT(impl);
+    return impl->drawCallCount;
+}
+
+} // namespace Pomdog
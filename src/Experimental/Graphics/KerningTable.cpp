@@ -0,0 +1,124 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/Graphics/KerningTable.hpp"
+#include "Pomdog/Experimental/Graphics/FontGlyph.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include <utility>
+
+namespace Pomdog::Detail {
+namespace {
+
+constexpr std::uint64_t MakeKey(char32_t first, char32_t second) noexcept
+{
+    return (static_cast<std::uint64_t>(first) << 32) | static_cast<std::uint64_t>(second);
+}
+
+constexpr int MinCapacityBits = 4;
+
+} // unnamed namespace
+
+void KerningTable::Reset(const std::vector<FontKerning>& kernings)
+{
+    entries.clear();
+    count = 0;
+    mask = 0;
+    shift = 0;
+
+    if (kernings.empty()) {
+        return;
+    }
+
+    Rehash(kernings.size() * 2);
+    for (const auto& kerning : kernings) {
+        Insert(kerning.First, kerning.Second, kerning.Amount);
+    }
+}
+
+void KerningTable::Insert(char32_t first, char32_t second, std::int16_t amount)
+{
+    const auto key = MakeKey(first, second);
+    if (key == 0) {
+        return;
+    }
+
+    // NOTE: Keep the load factor at or below 0.5 so that probe sequences stay short.
+    if ((count + 1) * 2 > entries.size()) {
+        Rehash((count + 1) * 2);
+    }
+
+    auto& entry = entries[FindSlot(key)];
+    if (entry.Key == 0) {
+        entry.Key = key;
+        ++count;
+    }
+    entry.Amount = amount;
+}
+
+std::int16_t KerningTable::Find(char32_t first, char32_t second) const noexcept
+{
+    return TryFind(first, second).value_or(0);
+}
+
+std::optional<std::int16_t> KerningTable::TryFind(char32_t first, char32_t second) const noexcept
+{
+    if (entries.empty()) {
+        return std::nullopt;
+    }
+
+    const auto key = MakeKey(first, second);
+    if (key == 0) {
+        return std::nullopt;
+    }
+
+    const auto& entry = entries[FindSlot(key)];
+    if (entry.Key == 0) {
+        return std::nullopt;
+    }
+    return entry.Amount;
+}
+
+std::size_t KerningTable::GetCount() const noexcept
+{
+    return count;
+}
+
+bool KerningTable::IsEmpty() const noexcept
+{
+    return count == 0;
+}
+
+void KerningTable::Rehash(std::size_t capacity)
+{
+    int bits = MinCapacityBits;
+    while ((std::size_t{1} << bits) < capacity) {
+        ++bits;
+    }
+
+    auto oldEntries = std::move(entries);
+    entries.assign(std::size_t{1} << bits, Entry{0, 0});
+    mask = entries.size() - 1;
+    shift = 64 - bits;
+
+    for (const auto& entry : oldEntries) {
+        if (entry.Key != 0) {
+            entries[FindSlot(entry.Key)] = entry;
+        }
+    }
+}
+
+std::size_t KerningTable::FindSlot(std::uint64_t key) const noexcept
+{
+    POMDOG_ASSERT(!entries.empty());
+    POMDOG_ASSERT(key != 0);
+
+    // NOTE: Fibonacci hashing followed by linear probing. The table always
+    // has an empty slot, so the probing terminates.
+    auto index = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> shift);
+    POMDOG_ASSERT(index < entries.size());
+    while ((entries[index].Key != 0) && (entries[index].Key != key)) {
+        index = (index + 1) & mask;
+    }
+    return index;
+}
+
+} // namespace Pomdog::Detail
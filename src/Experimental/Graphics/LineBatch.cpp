@@ -58,6 +58,9 @@ public:
 
     std::vector<Vertex> vertices;
 
+    // NOTE: The vertices of DrawSphere(), kept to reuse their storage.
+    std::vector<Vector3> sphereVertices;
+
 private:
     std::shared_ptr<GraphicsCommandList> commandList;
     std::shared_ptr<VertexBuffer> vertexBuffer;
@@ -434,7 +437,8 @@ void LineBatch::DrawSphere(
     POMDOG_ASSERT(sectors > 0);
     POMDOG_ASSERT(rings > 0);
 
-    std::vector<Vector3> sphereVertices;
+    auto& sphereVertices = impl->sphereVertices;
+    sphereVertices.clear();
     sphereVertices.reserve(sectors * (rings - 1) + 2);
 
     const auto R = 1.0f / static_cast<float>(rings - 1);
@@ -1,7 +1,9 @@
 // Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
 
 #include "Pomdog/Experimental/Graphics/PolygonShapeBuilder.hpp"
+#include "TessellationCache.hpp"
 #include "Pomdog/Math/MathHelper.hpp"
+#include <algorithm>
 #include <array>
 #include <cmath>
 
@@ -14,7 +16,8 @@ constexpr std::size_t DefaultMinVertexCount = 256;
 } // unnamed namespace
 
 PolygonShapeBuilder::PolygonShapeBuilder()
-    : maxVertexCount(DefaultMaxVertexCount)
+    : tessellationCache(std::make_shared<Detail::TessellationCache>())
+    , maxVertexCount(DefaultMaxVertexCount)
     , minVertexCount(DefaultMinVertexCount)
 {
     POMDOG_ASSERT(minVertexCount <= maxVertexCount);
@@ -22,13 +25,27 @@ PolygonShapeBuilder::PolygonShapeBuilder()
 }
 
 PolygonShapeBuilder::PolygonShapeBuilder(std::size_t maxVertexCountIn)
-    : maxVertexCount(maxVertexCountIn)
+    : tessellationCache(std::make_shared<Detail::TessellationCache>())
+    , maxVertexCount(maxVertexCountIn)
     , minVertexCount(1)
 {
     POMDOG_ASSERT(3 <= maxVertexCount);
     POMDOG_ASSERT(minVertexCount <= maxVertexCount);
 }
 
+PolygonShapeBuilder::PolygonShapeBuilder(
+    std::size_t maxVertexCountIn,
+    std::function<void()>&& onFlushIn)
+    : tessellationCache(std::make_shared<Detail::TessellationCache>())
+    , maxVertexCount(maxVertexCountIn)
+    , minVertexCount(std::min(DefaultMinVertexCount, maxVertexCountIn))
+    , onFlush(std::move(onFlushIn))
+{
+    POMDOG_ASSERT(3 <= maxVertexCount);
+    POMDOG_ASSERT(minVertexCount <= maxVertexCount);
+    vertices.reserve(minVertexCount);
+}
+
 void PolygonShapeBuilder::Reset()
 {
     POMDOG_ASSERT(minVertexCount <= maxVertexCount);
@@ -215,16 +232,16 @@ void PolygonShapeBuilder::DrawCircle(
     POMDOG_ASSERT(radius > 0);
     POMDOG_ASSERT(segments >= 3);
 
-    Radian<float> centralAngle = Math::TwoPi<float> / segments;
-    auto prevPoint = position + Vector3{radius, 0, 0};
+    POMDOG_ASSERT(tessellationCache);
+    const auto& unitCircle = tessellationCache->GetUnitCircle(segments);
+    POMDOG_ASSERT(unitCircle.size() == static_cast<std::size_t>(segments + 1));
+
+    auto prevPoint = position + Vector3{radius * unitCircle.front(), 0};
 
     auto colorVector = color.ToVector4();
 
     for (int i = 0; i < segments; ++i) {
-        auto rad = centralAngle * static_cast<float>(i + 1);
-        auto cos = std::cos(rad.value);
-        auto sin = std::sin(rad.value);
-        auto nextPoint = position + Vector3{radius * Vector2{cos, sin}, 0};
+        auto nextPoint = position + Vector3{radius * unitCircle[i + 1], 0};
         DrawTriangle(nextPoint, prevPoint, position,
             colorVector, colorVector, colorVector);
         prevPoint = nextPoint;
@@ -446,41 +463,31 @@ void PolygonShapeBuilder::DrawSphere(
     const auto rings = std::max(static_cast<int>(segments), 4);
     const auto sectors = std::max(static_cast<int>(segments), 4);
 
-    std::vector<Vector3> sphereVertices;
-    sphereVertices.reserve(rings * sectors);
-
-    const auto R = 1.0f / static_cast<float>(rings - 1);
-    const auto S = 1.0f / static_cast<float>(sectors - 1);
-
-    for (int ring = 0; ring < rings; ++ring) {
-        const auto latitude = Math::Pi<float> * ring * R;
-        const auto y = std::cos(latitude);
-        const auto r = std::sin(latitude);
-        for (int s = 0; s < sectors; ++s) {
-            const auto longitude = Math::TwoPi<float> * s * S;
-            const auto x = r * std::cos(longitude);
-            const auto z = r * std::sin(longitude);
-            sphereVertices.push_back(Vector3{x, y, z} * radius + position);
-        }
-    }
+    POMDOG_ASSERT(tessellationCache);
+    const auto& unitSphere = tessellationCache->GetUnitSphere(segments);
+    POMDOG_ASSERT(unitSphere.size() == static_cast<std::size_t>(rings * sectors));
 
     const auto colorVector = color.ToVector4();
     const auto drawIndices = [&](std::size_t a, std::size_t b, std::size_t c, std::size_t d) {
-        POMDOG_ASSERT(a < sphereVertices.size());
-        POMDOG_ASSERT(b < sphereVertices.size());
-        POMDOG_ASSERT(c < sphereVertices.size());
-        POMDOG_ASSERT(d < sphereVertices.size());
+        POMDOG_ASSERT(a < unitSphere.size());
+        POMDOG_ASSERT(b < unitSphere.size());
+        POMDOG_ASSERT(c < unitSphere.size());
+        POMDOG_ASSERT(d < unitSphere.size());
+        const auto pointA = unitSphere[a] * radius + position;
+        const auto pointB = unitSphere[b] * radius + position;
+        const auto pointC = unitSphere[c] * radius + position;
+        const auto pointD = unitSphere[d] * radius + position;
         DrawTriangle(
-            sphereVertices[a],
-            sphereVertices[c],
-            sphereVertices[b],
+            pointA,
+            pointC,
+            pointB,
             colorVector,
             colorVector,
             colorVector);
         DrawTriangle(
-            sphereVertices[c],
-            sphereVertices[a],
-            sphereVertices[d],
+            pointC,
+            pointA,
+            pointD,
             colorVector,
             colorVector,
             colorVector);
@@ -0,0 +1,47 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/Graphics/PolygonShapeMesh.hpp"
+#include "Pomdog/Experimental/Graphics/PolygonShapeBuilder.hpp"
+#include "Pomdog/Graphics/BufferUsage.hpp"
+#include "Pomdog/Graphics/VertexBuffer.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+
+namespace Pomdog {
+
+PolygonShapeMesh::PolygonShapeMesh(
+    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    const PolygonShapeBuilder& builder)
+    : PolygonShapeMesh(graphicsDevice, builder.GetData(), builder.GetVertexCount())
+{
+}
+
+PolygonShapeMesh::PolygonShapeMesh(
+    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    const PrimitiveBatchVertex* vertices,
+    std::size_t vertexCountIn)
+    : vertexCount(vertexCountIn)
+{
+    POMDOG_ASSERT(graphicsDevice);
+    POMDOG_ASSERT(vertices != nullptr);
+    POMDOG_ASSERT(vertexCount > 0);
+    POMDOG_ASSERT((vertexCount % 3) == 0);
+
+    vertexBuffer = std::make_shared<VertexBuffer>(
+        graphicsDevice,
+        vertices,
+        vertexCount,
+        sizeof(PrimitiveBatchVertex),
+        BufferUsage::Immutable);
+}
+
+std::size_t PolygonShapeMesh::GetVertexCount() const noexcept
+{
+    return vertexCount;
+}
+
+const std::shared_ptr<VertexBuffer>& PolygonShapeMesh::GetVertexBuffer() const noexcept
+{
+    return vertexBuffer;
+}
+
+} // namespace Pomdog
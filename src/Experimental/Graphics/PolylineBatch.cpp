@@ -12,6 +12,7 @@
 #include "Pomdog/Graphics/GraphicsCommandList.hpp"
 #include "Pomdog/Graphics/GraphicsDevice.hpp"
 #include "Pomdog/Graphics/IndexBuffer.hpp"
+#include "Pomdog/Graphics/IndexElementSize.hpp"
 #include "Pomdog/Graphics/InputLayoutHelper.hpp"
 #include "Pomdog/Graphics/PipelineState.hpp"
 #include "Pomdog/Graphics/PresentationParameters.hpp"
@@ -28,8 +29,10 @@
 #include "Pomdog/Math/Vector3.hpp"
 #include "Pomdog/Math/Vector4.hpp"
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
+#include <limits>
 
 #include "Pomdog/Graphics/RasterizerDescription.hpp"
 
@@ -93,64 +96,121 @@ PolylineVertex MakeVertex(
 
 class PolylineBatch::Impl {
 public:
-    static constexpr std::size_t MaxVertexCount = 8192;
+    static constexpr std::size_t DefaultMaxVertexCount = 8192;
     static constexpr std::size_t MinVertexCount = 256;
     static constexpr std::size_t MinIndexCount = (MinVertexCount - 2) * 6;
-    static constexpr std::size_t MaxIndexCount = (MaxVertexCount - 2) * 6;
+
+    // NOTE: A path point emits up to 4 vertices at a sharp corner,
+    // and each segment between two points emits 6 indices.
+    static constexpr std::size_t MaxVerticesPerPoint = 4;
+    static constexpr std::size_t IndicesPerSegment = 6;
+
+    // NOTE: The vertices of DrawSphere(), kept to reuse their storage.
+    std::vector<Vector3> sphereVertices;
 
 private:
+    struct BufferPage final {
+        std::shared_ptr<Pomdog::VertexBuffer> VertexBuffer;
+        std::shared_ptr<Pomdog::IndexBuffer> IndexBuffer;
+    };
+
+    std::shared_ptr<GraphicsDevice> graphicsDevice;
     std::shared_ptr<GraphicsCommandList> commandList;
-    std::shared_ptr<VertexBuffer> vertexBuffer;
+    std::vector<BufferPage> bufferPages;
 #ifdef POMDOG_POLYLINE_DEBUG
     std::shared_ptr<VertexBuffer> debugVertexBuffer;
 #endif
-    std::shared_ptr<IndexBuffer> indexBuffer;
     std::shared_ptr<PipelineState> pipelineState;
     std::shared_ptr<ConstantBuffer> constantBuffer;
 
     std::vector<PolylineVertex> vertices;
-    std::vector<std::uint16_t> indices;
-    std::size_t startIndexLocation = 0;
+    std::vector<std::uint16_t> indices16;
+    std::vector<std::uint32_t> indices32;
+    std::vector<PolylineBatchVertex> pathBuilder;
+    std::size_t pageIndex = 0;
+    std::size_t maxVertexCount = 0;
+    std::size_t maxIndexCount = 0;
+    IndexElementSize indexElementSize = IndexElementSize::SixteenBits;
 
 public:
     Impl(
         const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+        std::size_t maxVertexCount,
+        IndexElementSize indexElementSize,
         AssetManager& assets);
 
     void Begin(
         const std::shared_ptr<GraphicsCommandList>& commandListIn,
         const Matrix4x4& transformMatrix);
 
-    void DrawPath(std::vector<PolylineBatchVertex>&& path, bool closed, float thickness);
+    void DrawPath(const PolylineBatchVertex* path, std::size_t pointCount, bool closed, float thickness);
+
+    void BeginPath();
+
+    void AddPathPoint(const Vector3& position, const Color& color);
+
+    void EndPath(bool closed, float thickness);
 
     void End();
 
     void Flush();
+
+private:
+    void EmitPathPoint(
+        const PolylineBatchVertex* path,
+        std::size_t pointCount,
+        std::size_t index,
+        bool closed,
+        bool connectNext,
+        float thickness);
+
+    bool HasRoomForPathPoint() const noexcept;
+
+    BufferPage CreateBufferPage() const;
+
+    std::size_t GetIndexCount() const noexcept;
+
+    void PushSegmentIndices(std::size_t from, std::size_t to);
+
+    void PopSegmentIndices();
+
+    void ClearIndices();
 };
 
 PolylineBatch::Impl::Impl(
-    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    const std::shared_ptr<GraphicsDevice>& graphicsDeviceIn,
+    std::size_t maxVertexCountIn,
+    IndexElementSize indexElementSizeIn,
     AssetManager& assets)
+    : graphicsDevice(graphicsDeviceIn)
+    , maxVertexCount(maxVertexCountIn)
+    , indexElementSize(indexElementSizeIn)
 {
+    POMDOG_ASSERT(maxVertexCount >= MaxVerticesPerPoint * 4);
+    POMDOG_ASSERT((indexElementSize == IndexElementSize::ThirtyTwoBits)
+        || (maxVertexCount <= std::numeric_limits<std::uint16_t>::max()));
+
+    maxIndexCount = (maxVertexCount - 2) * IndicesPerSegment;
+
     {
-        vertices.reserve(MinVertexCount);
+        vertices.reserve(std::min(MinVertexCount, maxVertexCount));
+
+        switch (indexElementSize) {
+        case IndexElementSize::SixteenBits:
+            indices16.reserve(std::min(MinIndexCount, maxIndexCount));
+            break;
+        case IndexElementSize::ThirtyTwoBits:
+            indices32.reserve(std::min(MinIndexCount, maxIndexCount));
+            break;
+        }
 
-        constexpr auto maxVertexCount = MaxVertexCount;
-        vertexBuffer = std::make_shared<VertexBuffer>(graphicsDevice,
-            maxVertexCount, sizeof(PolylineVertex), BufferUsage::Dynamic);
+        bufferPages.push_back(CreateBufferPage());
 
 #ifdef POMDOG_POLYLINE_DEBUG
         debugVertexBuffer = std::make_shared<VertexBuffer>(graphicsDevice,
             maxVertexCount, sizeof(PolylineVertex), BufferUsage::Dynamic);
 #endif
     }
-    {
-        indices.reserve(MinIndexCount);
-
-        constexpr auto maxIndexCount = MaxIndexCount;
-        indexBuffer = std::make_shared<IndexBuffer>(graphicsDevice,
-            IndexElementSize::SixteenBits, maxIndexCount, BufferUsage::Dynamic);
-    }
     {
         auto inputLayout = InputLayoutHelper{}
             .Float4().Float4().Float4().Float4();
@@ -194,37 +254,52 @@ void PolylineBatch::Impl::Begin(
 
     alignas(16) Matrix4x4 transposedMatrix = Matrix4x4::Transpose(transformMatrix);
     constantBuffer->SetValue(transposedMatrix);
+
+    vertices.clear();
+    ClearIndices();
+    pageIndex = 0;
 }
 
 void PolylineBatch::Impl::End()
 {
-    if (vertices.empty()) {
-        return;
-    }
-
     Flush();
     commandList.reset();
-    vertices.clear();
-    indices.clear();
-    startIndexLocation = 0;
+    pageIndex = 0;
 }
 
 void PolylineBatch::Impl::Flush()
 {
-#if 1
-    if (vertices.size() >= 2) {
-        vertices[vertices.size() - 1].Color.W *= 0.1f;
-        vertices[vertices.size() - 2].Color.W *= 0.1f;
+    const auto indexCount = GetIndexCount();
+
+    if (indexCount == 0) {
+        vertices.clear();
+        return;
     }
-#endif
 
+    POMDOG_ASSERT(commandList);
     POMDOG_ASSERT(!vertices.empty());
-    POMDOG_ASSERT(vertices.size() <= MaxVertexCount);
-    vertexBuffer->SetData(vertices.data(), vertices.size());
+    POMDOG_ASSERT(vertices.size() <= maxVertexCount);
+    POMDOG_ASSERT(indexCount <= maxIndexCount);
+
+    // NOTE: Each flush within a frame writes to its own buffer page because
+    // buffers that are already referenced by recorded draw calls cannot be
+    // overwritten until the command list has been executed.
+    if (pageIndex >= bufferPages.size()) {
+        bufferPages.push_back(CreateBufferPage());
+    }
 
-    POMDOG_ASSERT(!indices.empty());
-    POMDOG_ASSERT(indices.size() <= MaxIndexCount);
-    indexBuffer->SetData(indices.data(), indices.size());
+    POMDOG_ASSERT(pageIndex < bufferPages.size());
+    auto& page = bufferPages[pageIndex];
+
+    page.VertexBuffer->SetData(vertices.data(), vertices.size());
+    switch (indexElementSize) {
+    case IndexElementSize::SixteenBits:
+        page.IndexBuffer->SetData(indices16.data(), indices16.size());
+        break;
+    case IndexElementSize::ThirtyTwoBits:
+        page.IndexBuffer->SetData(indices32.data(), indices32.size());
+        break;
+    }
 
 #ifdef POMDOG_POLYLINE_DEBUG
     auto vert = vertices;
@@ -234,91 +309,147 @@ void PolylineBatch::Impl::Flush()
     debugVertexBuffer->SetData(vert.data(), vert.size());
 #endif
 
-    commandList->SetVertexBuffer(0, vertexBuffer);
+    commandList->SetVertexBuffer(0, page.VertexBuffer);
     commandList->SetPipelineState(pipelineState);
     commandList->SetConstantBuffer(0, constantBuffer);
-    commandList->DrawIndexed(indexBuffer, indices.size(), startIndexLocation);
+    commandList->DrawIndexed(page.IndexBuffer, indexCount, 0);
 
 #ifdef POMDOG_POLYLINE_DEBUG
     commandList->SetVertexBuffer(debugVertexBuffer);
     commandList->SetPrimitiveTopology(PrimitiveTopology::LineStrip);
-    commandList->DrawIndexed(indexBuffer, indices.size(), startIndexLocation);
+    commandList->DrawIndexed(page.IndexBuffer, indexCount, 0);
 #endif
 
-    startIndexLocation = indices.size();
+    ++pageIndex;
+    vertices.clear();
+    ClearIndices();
 }
 
-void PolylineBatch::Impl::DrawPath(std::vector<PolylineBatchVertex>&& path, bool closed, float thickness)
+PolylineBatch::Impl::BufferPage PolylineBatch::Impl::CreateBufferPage() const
 {
-    const auto n = static_cast<int>(path.size());
+    BufferPage page;
+    page.VertexBuffer = std::make_shared<VertexBuffer>(graphicsDevice,
+        maxVertexCount, sizeof(PolylineVertex), BufferUsage::Dynamic);
+    page.IndexBuffer = std::make_shared<IndexBuffer>(graphicsDevice,
+        indexElementSize, maxIndexCount, BufferUsage::Dynamic);
+    return page;
+}
 
-    if ((vertices.size() + path.size() * 2) > MaxVertexCount) {
-        Flush();
-        return;
+std::size_t PolylineBatch::Impl::GetIndexCount() const noexcept
+{
+    switch (indexElementSize) {
+    case IndexElementSize::SixteenBits:
+        return indices16.size();
+    case IndexElementSize::ThirtyTwoBits:
+        return indices32.size();
     }
+    return 0;
+}
 
-    if (n < 2) {
-        return;
+void PolylineBatch::Impl::PushSegmentIndices(std::size_t from, std::size_t to)
+{
+    POMDOG_ASSERT((to + 1) < maxVertexCount);
+
+    switch (indexElementSize) {
+    case IndexElementSize::SixteenBits: {
+        const auto a = static_cast<std::uint16_t>(from);
+        const auto b = static_cast<std::uint16_t>(to);
+        indices16.push_back(a);
+        indices16.push_back(b);
+        indices16.push_back(b + 1);
+        indices16.push_back(b + 1);
+        indices16.push_back(a + 1);
+        indices16.push_back(a);
+        break;
+    }
+    case IndexElementSize::ThirtyTwoBits: {
+        const auto a = static_cast<std::uint32_t>(from);
+        const auto b = static_cast<std::uint32_t>(to);
+        indices32.push_back(a);
+        indices32.push_back(b);
+        indices32.push_back(b + 1);
+        indices32.push_back(b + 1);
+        indices32.push_back(a + 1);
+        indices32.push_back(a);
+        break;
     }
+    }
+}
 
-    for (int i = 0; i < n; i++) {
-        POMDOG_ASSERT(n >= 2);
-        const auto& v = path[i];
-        auto color = v.Color.ToVector4();
+void PolylineBatch::Impl::PopSegmentIndices()
+{
+    POMDOG_ASSERT(GetIndexCount() >= IndicesPerSegment);
+
+    switch (indexElementSize) {
+    case IndexElementSize::SixteenBits:
+        indices16.resize(indices16.size() - IndicesPerSegment);
+        break;
+    case IndexElementSize::ThirtyTwoBits:
+        indices32.resize(indices32.size() - IndicesPerSegment);
+        break;
+    }
+}
 
-        Vector3 prevPoint;
-        Vector3 nextPoint;
+void PolylineBatch::Impl::ClearIndices()
+{
+    indices16.clear();
+    indices32.clear();
+}
 
-        if (i == (n - 1)) {
-            POMDOG_ASSERT(i >= 1);
-            POMDOG_ASSERT(i < static_cast<int>(path.size()));
-            if (closed) {
-                POMDOG_ASSERT(path.size() >= 3);
-                const auto& start = path[i - 1].Position;
-                const auto& end = path.front().Position;
-                prevPoint = start;
-                nextPoint = end;
-
-                if (Vector3::DistanceSquared(v.Position, nextPoint) < 0.0001f) {
-                    auto dir = v.Position - start;
-                    nextPoint = v.Position + dir;
-                }
-            }
-            else {
-                const auto& start = path[i - 1].Position;
-                const auto& end = path[i].Position;
-                auto dir = end - start;
-                prevPoint = start;
-                nextPoint = end + dir;
-            }
-        }
-        else if (i == 0) {
-            POMDOG_ASSERT(i >= 0);
-            POMDOG_ASSERT((i + 1) < static_cast<int>(path.size()));
-            if (closed) {
-                POMDOG_ASSERT(path.size() >= 3);
-                const auto& start = path.back().Position;
-                const auto& end = path[i + 1].Position;
-                prevPoint = start;
-                nextPoint = end;
-
-                if (Vector3::DistanceSquared(v.Position, nextPoint) < 0.0001f) {
-                    auto dir = v.Position - start;
-                    nextPoint = v.Position + dir;
-                }
-            }
-            else {
-                const auto& start = path[i].Position;
-                const auto& end = path[i + 1].Position;
-                auto dir = end - start;
-                prevPoint = start - dir;
-                nextPoint = end;
+bool PolylineBatch::Impl::HasRoomForPathPoint() const noexcept
+{
+    // NOTE: Reserves room for the current point, the first vertices of the
+    // next point, and the first point re-emitted to close a split path.
+    return ((vertices.size() + MaxVerticesPerPoint * 3) <= maxVertexCount)
+        && ((GetIndexCount() + IndicesPerSegment * 3) <= maxIndexCount);
+}
+
+void PolylineBatch::Impl::EmitPathPoint(
+    const PolylineBatchVertex* path,
+    std::size_t pointCount,
+    std::size_t index,
+    bool closed,
+    bool connectNext,
+    float thickness)
+{
+    const auto n = static_cast<int>(pointCount);
+    const auto i = static_cast<int>(index);
+
+    POMDOG_ASSERT(n >= 2);
+    POMDOG_ASSERT(i < n);
+    const auto& v = path[i];
+    auto color = v.Color.ToVector4();
+
+    Vector3 prevPoint;
+    Vector3 nextPoint;
+
+    if (i == (n - 1)) {
+        POMDOG_ASSERT(i >= 1);
+        if (closed) {
+            POMDOG_ASSERT(n >= 3);
+            const auto& start = path[i - 1].Position;
+            const auto& end = path[0].Position;
+            prevPoint = start;
+            nextPoint = end;
+
+            if (Vector3::DistanceSquared(v.Position, nextPoint) < 0.0001f) {
+                auto dir = v.Position - start;
+                nextPoint = v.Position + dir;
             }
         }
         else {
-            POMDOG_ASSERT(i >= 1);
-            POMDOG_ASSERT((i + 1) < static_cast<int>(path.size()));
             const auto& start = path[i - 1].Position;
+            const auto& end = path[i].Position;
+            auto dir = end - start;
+            prevPoint = start;
+            nextPoint = end + dir;
+        }
+    }
+    else if (i == 0) {
+        POMDOG_ASSERT((i + 1) < n);
+        if (closed) {
+            POMDOG_ASSERT(n >= 3);
+            const auto& start = path[n - 1].Position;
             const auto& end = path[i + 1].Position;
             prevPoint = start;
             nextPoint = end;
@@ -328,63 +459,130 @@ void PolylineBatch::Impl::DrawPath(std::vector<PolylineBatchVertex>&& path, bool
                 nextPoint = v.Position + dir;
             }
         }
+        else {
+            const auto& start = path[i].Position;
+            const auto& end = path[i + 1].Position;
+            auto dir = end - start;
+            prevPoint = start - dir;
+            nextPoint = end;
+        }
+    }
+    else {
+        POMDOG_ASSERT(i >= 1);
+        POMDOG_ASSERT((i + 1) < n);
+        const auto& start = path[i - 1].Position;
+        const auto& end = path[i + 1].Position;
+        prevPoint = start;
+        nextPoint = end;
+
+        if (Vector3::DistanceSquared(v.Position, nextPoint) < 0.0001f) {
+            auto dir = v.Position - start;
+            nextPoint = v.Position + dir;
+        }
+    }
+
+    if (i < (n - 1) || closed) {
+        // NOTE: shape corner
+        constexpr float cutoff = -0.90f;
+        const auto v1 = Vector3::Normalize(v.Position - prevPoint);
+        const auto v2 = Vector3::Normalize(nextPoint - v.Position);
+        if (Vector3::Dot(v2, v1) < cutoff) {
+            const auto next = v.Position + v1;
+            vertices.push_back(MakeVertex(v.Position, next, prevPoint, color, -1.0f, thickness));
+            vertices.push_back(MakeVertex(v.Position, next, prevPoint, color, 1.0f, thickness));
+
+            const auto indexOffset = vertices.size();
 
-        if (i < (n - 1) || closed) {
-            // NOTE: shape corner
-            constexpr float cutoff = -0.90f;
-            const auto v1 = Vector3::Normalize(v.Position - prevPoint);
-            const auto v2 = Vector3::Normalize(nextPoint - v.Position);
-            if (Vector3::Dot(v2, v1) < cutoff) {
-                const auto next = v.Position + v1;
-                vertices.push_back(MakeVertex(v.Position, next, prevPoint, color, -1.0f, thickness));
-                vertices.push_back(MakeVertex(v.Position, next, prevPoint, color, 1.0f, thickness));
-
-                const auto indexOffset = static_cast<std::uint16_t>(vertices.size());
-
-                const auto prev = v.Position - v2;
-                vertices.push_back(MakeVertex(v.Position, nextPoint, prev, color, -1.0f, thickness));
-                vertices.push_back(MakeVertex(v.Position, nextPoint, prev, color, 1.0f, thickness));
-
-                if (i < (n - 1)) {
-                    indices.push_back(indexOffset + 0);
-                    indices.push_back(indexOffset + 2);
-                    indices.push_back(indexOffset + 3);
-                    indices.push_back(indexOffset + 3);
-                    indices.push_back(indexOffset + 1);
-                    indices.push_back(indexOffset + 0);
-                }
-                continue;
+            const auto prev = v.Position - v2;
+            vertices.push_back(MakeVertex(v.Position, nextPoint, prev, color, -1.0f, thickness));
+            vertices.push_back(MakeVertex(v.Position, nextPoint, prev, color, 1.0f, thickness));
+
+            if (connectNext) {
+                PushSegmentIndices(indexOffset, indexOffset + 2);
             }
+            return;
         }
+    }
 
-        const auto indexOffset = static_cast<std::uint16_t>(vertices.size());
-        vertices.push_back(MakeVertex(v.Position, nextPoint, prevPoint, color, -1.0f, thickness));
-        vertices.push_back(MakeVertex(v.Position, nextPoint, prevPoint, color, 1.0f, thickness));
-
-        POMDOG_ASSERT(n >= 2);
-        if (i < (n - 1)) {
-            indices.push_back(indexOffset + 0);
-            indices.push_back(indexOffset + 2);
-            indices.push_back(indexOffset + 3);
-            indices.push_back(indexOffset + 3);
-            indices.push_back(indexOffset + 1);
-            indices.push_back(indexOffset + 0);
+    const auto indexOffset = vertices.size();
+    vertices.push_back(MakeVertex(v.Position, nextPoint, prevPoint, color, -1.0f, thickness));
+    vertices.push_back(MakeVertex(v.Position, nextPoint, prevPoint, color, 1.0f, thickness));
+
+    if (connectNext) {
+        PushSegmentIndices(indexOffset, indexOffset + 2);
+    }
+}
+
+void PolylineBatch::Impl::DrawPath(
+    const PolylineBatchVertex* path,
+    std::size_t pointCount,
+    bool closed,
+    float thickness)
+{
+    if (pointCount < 2) {
+        return;
+    }
+
+    POMDOG_ASSERT(path != nullptr);
+
+    if (pointCount <= 2) {
+        closed = false;
+    }
+
+    if (!HasRoomForPathPoint()) {
+        Flush();
+    }
+
+    auto pathStart = vertices.size();
+    bool split = false;
+
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        if (!HasRoomForPathPoint()) {
+            // NOTE: The path is split across buffer pages. The previous point
+            // already emitted indices that refer to this point, so they are
+            // removed and the previous point is emitted again after flushing.
+            POMDOG_ASSERT(i >= 1);
+            PopSegmentIndices();
+            Flush();
+            split = true;
+            EmitPathPoint(path, pointCount, i - 1, closed, true, thickness);
         }
+
+        const bool connectNext = (i + 1) < pointCount;
+        EmitPathPoint(path, pointCount, i, closed, connectNext, thickness);
     }
 
     if (closed) {
-        POMDOG_ASSERT(path.size() >= 3);
-        const auto indexOffset = static_cast<std::uint16_t>(vertices.size() - 2);
-        indices.push_back(indexOffset + 0);
-        indices.push_back(0);
-        indices.push_back(1);
-        indices.push_back(1);
-        indices.push_back(indexOffset + 1);
-        indices.push_back(indexOffset + 0);
+        const auto indexOffset = vertices.size() - 2;
+
+        if (split) {
+            // NOTE: The first point is on a previous page, so it is emitted
+            // again on the current page to close the path.
+            pathStart = vertices.size();
+            EmitPathPoint(path, pointCount, 0, closed, false, thickness);
+        }
+
+        PushSegmentIndices(indexOffset, pathStart);
     }
 
-    POMDOG_ASSERT(vertices.size() <= MaxVertexCount);
-    POMDOG_ASSERT(indices.size() <= MaxIndexCount);
+    POMDOG_ASSERT(vertices.size() <= maxVertexCount);
+    POMDOG_ASSERT(GetIndexCount() <= maxIndexCount);
+}
+
+void PolylineBatch::Impl::BeginPath()
+{
+    pathBuilder.clear();
+}
+
+void PolylineBatch::Impl::AddPathPoint(const Vector3& position, const Color& color)
+{
+    pathBuilder.push_back(PolylineBatchVertex{position, color});
+}
+
+void PolylineBatch::Impl::EndPath(bool closed, float thickness)
+{
+    DrawPath(pathBuilder.data(), pathBuilder.size(), closed, thickness);
+    pathBuilder.clear();
 }
 
 // MARK: - PolylineBatch
@@ -392,7 +590,16 @@ void PolylineBatch::Impl::DrawPath(std::vector<PolylineBatchVertex>&& path, bool
 PolylineBatch::PolylineBatch(
     const std::shared_ptr<GraphicsDevice>& graphicsDevice,
     AssetManager& assets)
-    : impl(std::make_unique<Impl>(graphicsDevice, assets))
+    : PolylineBatch(graphicsDevice, Impl::DefaultMaxVertexCount, IndexElementSize::SixteenBits, assets)
+{
+}
+
+PolylineBatch::PolylineBatch(
+    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    std::size_t maxVertexCount,
+    IndexElementSize indexElementSize,
+    AssetManager& assets)
+    : impl(std::make_unique<Impl>(graphicsDevice, maxVertexCount, indexElementSize, assets))
 {
 }
 
@@ -413,16 +620,30 @@ void PolylineBatch::End()
 }
 
 void PolylineBatch::DrawPath(const std::vector<Vector2>& path, bool closed, const Color& color, float thickness)
+{
+    this->DrawPath(path.data(), path.size(), closed, color, thickness);
+}
+
+void PolylineBatch::DrawPath(const Vector2* path, std::size_t pointCount, bool closed, const Color& color, float thickness)
 {
     POMDOG_ASSERT(impl);
-    std::vector<PolylineBatchVertex> vertices;
-    for (const auto& v : path) {
-        vertices.push_back(PolylineBatchVertex{Vector3{v, 0.0f}, color});
+    POMDOG_ASSERT((path != nullptr) || (pointCount == 0));
+    impl->BeginPath();
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        impl->AddPathPoint(Vector3{path[i], 0.0f}, color);
     }
-    if (vertices.size() <= 2) {
-        closed = false;
+    impl->EndPath(closed, thickness);
+}
+
+void PolylineBatch::DrawPath(const Vector3* path, std::size_t pointCount, bool closed, const Color& color, float thickness)
+{
+    POMDOG_ASSERT(impl);
+    POMDOG_ASSERT((path != nullptr) || (pointCount == 0));
+    impl->BeginPath();
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        impl->AddPathPoint(path[i], color);
     }
-    impl->DrawPath(std::move(vertices), closed, thickness);
+    impl->EndPath(closed, thickness);
 }
 
 void PolylineBatch::DrawBox(const BoundingBox& box, const Color& color, float thickness)
@@ -495,52 +716,56 @@ void PolylineBatch::DrawCircle(const Vector2& position, float radius, const Colo
 
     POMDOG_ASSERT(segments >= 3);
     Radian<float> centralAngle = Math::TwoPi<float> / segments;
-    Vector2 prevPoint = position + Vector2{radius, 0};
 
+    impl->BeginPath();
     for (int i = 0; i < segments; ++i) {
-        auto rad = centralAngle * static_cast<float>(i + 1);
+        auto rad = centralAngle * static_cast<float>(i);
         auto cos = std::cos(rad.value);
         auto sin = std::sin(rad.value);
-        auto nextPoint = position + (radius * Vector2{cos, sin});
-        this->DrawLine(nextPoint, prevPoint, color, color, thickness);
-        prevPoint = nextPoint;
+        auto point = position + (radius * Vector2{cos, sin});
+        impl->AddPathPoint(Vector3{point, 0.0f}, color);
     }
+    impl->EndPath(true, thickness);
 }
 
 void PolylineBatch::DrawLine(const Vector2& start, const Vector2& end, const Color& color, float thickness)
 {
     POMDOG_ASSERT(impl);
-    impl->DrawPath(std::vector<PolylineBatchVertex>{
+    const std::array<PolylineBatchVertex, 2> path = {{
         PolylineBatchVertex{Vector3{start, 0.0f}, color},
         PolylineBatchVertex{Vector3{end, 0.0f}, color},
-    }, false, thickness);
+    }};
+    impl->DrawPath(path.data(), path.size(), false, thickness);
 }
 
 void PolylineBatch::DrawLine(const Vector2& start, const Vector2& end, const Color& startColor, const Color& endColor, float thickness)
 {
     POMDOG_ASSERT(impl);
-    impl->DrawPath(std::vector<PolylineBatchVertex>{
+    const std::array<PolylineBatchVertex, 2> path = {{
         PolylineBatchVertex{Vector3{start, 0.0f}, startColor},
         PolylineBatchVertex{Vector3{end, 0.0f}, endColor},
-    }, false, thickness);
+    }};
+    impl->DrawPath(path.data(), path.size(), false, thickness);
 }
 
 void PolylineBatch::DrawLine(const Vector3& start, const Vector3& end, const Color& color, float thickness)
 {
     POMDOG_ASSERT(impl);
-    impl->DrawPath(std::vector<PolylineBatchVertex>{
+    const std::array<PolylineBatchVertex, 2> path = {{
         PolylineBatchVertex{start, color},
         PolylineBatchVertex{end, color},
-    }, false, thickness);
+    }};
+    impl->DrawPath(path.data(), path.size(), false, thickness);
 }
 
 void PolylineBatch::DrawLine(const Vector3& start, const Vector3& end, const Color& startColor, const Color& endColor, float thickness)
 {
     POMDOG_ASSERT(impl);
-    impl->DrawPath(std::vector<PolylineBatchVertex>{
+    const std::array<PolylineBatchVertex, 2> path = {{
         PolylineBatchVertex{start, startColor},
         PolylineBatchVertex{end, endColor},
-    }, false, thickness);
+    }};
+    impl->DrawPath(path.data(), path.size(), false, thickness);
 }
 
 void PolylineBatch::DrawRectangle(const Rectangle& sourceRect, const Color& color, float thickness)
@@ -618,7 +843,8 @@ void PolylineBatch::DrawSphere(
     POMDOG_ASSERT(sectors > 0);
     POMDOG_ASSERT(rings > 0);
 
-    std::vector<Vector3> sphereVertices;
+    auto& sphereVertices = impl->sphereVertices;
+    sphereVertices.clear();
     sphereVertices.reserve(sectors * (rings - 1) + 2);
 
     const auto R = 1.0f / static_cast<float>(rings - 1);
@@ -658,20 +884,21 @@ void PolylineBatch::DrawSphere(
 
     int count = 1;
     for (int s = 2; s < sectors; ++s) {
-        std::vector<PolylineBatchVertex> path1;
+        // NOTE: drawIndices() does not use the path builder, so the path can be
+        // built while those lines are submitted.
+        impl->BeginPath();
 
         for (int ring = 1; ring < rings; ++ring) {
             POMDOG_ASSERT(count < static_cast<int>(sphereVertices.size()));
-            path1.push_back(PolylineBatchVertex{sphereVertices[count], color});
+            impl->AddPathPoint(sphereVertices[count], color);
 
             drawIndices(count, count + sectors);
             ++count;
         }
 
         POMDOG_ASSERT(count < static_cast<int>(sphereVertices.size()));
-        path1.push_back(PolylineBatchVertex{sphereVertices[count], color});
-
-        impl->DrawPath(std::move(path1), false, thickness);
+        impl->AddPathPoint(sphereVertices[count], color);
+        impl->EndPath(false, thickness);
 
         POMDOG_ASSERT(count + 1 >= sectors);
         drawIndices(count, (count + 1) - sectors);
@@ -693,15 +920,15 @@ void PolylineBatch::DrawSphere(
 void PolylineBatch::DrawTriangle(const Vector2& point1, const Vector2& point2, const Vector2& point3, const Color& color, float thickness)
 {
     POMDOG_ASSERT(impl);
-
-    impl->DrawPath(std::vector<PolylineBatchVertex>{
+    const std::array<PolylineBatchVertex, 6> path = {{
         PolylineBatchVertex{Vector3{point1, 0.0f}, color},
         PolylineBatchVertex{Vector3{point2, 0.0f}, color},
         PolylineBatchVertex{Vector3{point2, 0.0f}, color},
         PolylineBatchVertex{Vector3{point3, 0.0f}, color},
         PolylineBatchVertex{Vector3{point3, 0.0f}, color},
         PolylineBatchVertex{Vector3{point1, 0.0f}, color},
-    }, false, thickness);
+    }};
+    impl->DrawPath(path.data(), path.size(), false, thickness);
 }
 
 void PolylineBatch::DrawTriangle(
@@ -710,14 +937,15 @@ void PolylineBatch::DrawTriangle(
     float thickness)
 {
     POMDOG_ASSERT(impl);
-    impl->DrawPath(std::vector<PolylineBatchVertex>{
+    const std::array<PolylineBatchVertex, 6> path = {{
         PolylineBatchVertex{Vector3{point1, 0.0f}, color1},
         PolylineBatchVertex{Vector3{point2, 0.0f}, color2},
         PolylineBatchVertex{Vector3{point2, 0.0f}, color2},
         PolylineBatchVertex{Vector3{point3, 0.0f}, color3},
         PolylineBatchVertex{Vector3{point3, 0.0f}, color3},
         PolylineBatchVertex{Vector3{point1, 0.0f}, color1},
-    }, false, thickness);
+    }};
+    impl->DrawPath(path.data(), path.size(), false, thickness);
 }
 
 } // namespace Pomdog
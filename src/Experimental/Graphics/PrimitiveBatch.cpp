@@ -5,6 +5,7 @@
 #include "Pomdog/Content/AssetBuilders/ShaderBuilder.hpp"
 #include "Pomdog/Content/AssetManager.hpp"
 #include "Pomdog/Experimental/Graphics/PolygonShapeBuilder.hpp"
+#include "Pomdog/Experimental/Graphics/PolygonShapeMesh.hpp"
 #include "Pomdog/Graphics/BlendDescription.hpp"
 #include "Pomdog/Graphics/BufferUsage.hpp"
 #include "Pomdog/Graphics/ConstantBuffer.hpp"
@@ -27,8 +28,10 @@
 #include "Pomdog/Math/Vector2.hpp"
 #include "Pomdog/Math/Vector3.hpp"
 #include "Pomdog/Math/Vector4.hpp"
+#include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <utility>
 
 namespace Pomdog {
 namespace {
@@ -48,14 +51,22 @@ class PrimitiveBatch::Impl {
 public:
     typedef PrimitiveBatchVertex Vertex;
 
+    static constexpr std::size_t DefaultMaxVertexCount = 4096 * 8;
+
 private:
+    std::shared_ptr<GraphicsDevice> graphicsDevice;
     std::shared_ptr<GraphicsCommandList> commandList;
-    std::shared_ptr<VertexBuffer> vertexBuffer;
+    std::vector<std::shared_ptr<VertexBuffer>> vertexBuffers;
     std::shared_ptr<PipelineState> pipelineState;
     std::shared_ptr<ConstantBuffer> constantBuffer;
+    std::vector<std::shared_ptr<ConstantBuffer>> meshConstantBuffers;
+    Matrix4x4 viewProjection;
+    std::size_t meshDrawCount;
 
 public:
+    std::function<void(const Vertex* vertices, std::size_t vertexCount)> onFlush;
     PolygonShapeBuilder polygonShapes;
+    std::size_t bufferIndex;
     std::size_t startVertexLocation;
     int drawCallCount;
 
@@ -64,6 +75,7 @@ public:
         const std::shared_ptr<GraphicsDevice>& graphicsDevice,
         std::optional<DepthStencilDescription>&& depthStencilDesc,
         std::optional<RasterizerDescription>&& rasterizerDesc,
+        std::size_t maxVertexCount,
         AssetManager& assets);
 
     void Begin(
@@ -74,17 +86,30 @@ public:
         const Vector2& point1, const Vector2& point2, const Vector2& point3,
         const Vector4& color1, const Vector4& color2, const Vector4& color3);
 
+    void DrawMesh(const PolygonShapeMesh& mesh, const Matrix4x4& worldMatrix);
+
+    void DrawVertices(const Vertex* vertices, std::size_t vertexCount);
+
     void End();
 
     void Flush();
+
+private:
+    void SubmitVertices(const Vertex* vertices, std::size_t vertexCount);
 };
 
 PrimitiveBatch::Impl::Impl(
-    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    const std::shared_ptr<GraphicsDevice>& graphicsDeviceIn,
     std::optional<DepthStencilDescription>&& depthStencilDesc,
     std::optional<RasterizerDescription>&& rasterizerDesc,
+    std::size_t maxVertexCount,
     AssetManager& assets)
-    : startVertexLocation(0)
+    : graphicsDevice(graphicsDeviceIn)
+    , viewProjection(Matrix4x4::Identity)
+    , meshDrawCount(0)
+    , polygonShapes(maxVertexCount, [this] { Flush(); })
+    , bufferIndex(0)
+    , startVertexLocation(0)
     , drawCallCount(0)
 {
     if (!depthStencilDesc) {
@@ -98,9 +123,8 @@ PrimitiveBatch::Impl::Impl(
     POMDOG_ASSERT(rasterizerDesc);
 
     {
-        auto maxVertexCount = polygonShapes.GetMaxVertexCount();
-        vertexBuffer = std::make_shared<VertexBuffer>(graphicsDevice,
-            maxVertexCount, sizeof(Vertex), BufferUsage::Dynamic);
+        vertexBuffers.push_back(std::make_shared<VertexBuffer>(graphicsDevice,
+            polygonShapes.GetMaxVertexCount(), sizeof(Vertex), BufferUsage::Dynamic));
     }
     {
         auto inputLayout = InputLayoutHelper{}
@@ -147,6 +171,9 @@ void PrimitiveBatch::Impl::Begin(
     alignas(16) Matrix4x4 transposedMatrix = Matrix4x4::Transpose(transformMatrix);
     constantBuffer->SetValue(transposedMatrix);
 
+    viewProjection = transformMatrix;
+    meshDrawCount = 0;
+    bufferIndex = 0;
     startVertexLocation = 0;
     drawCallCount = 0;
 }
@@ -163,26 +190,105 @@ void PrimitiveBatch::Impl::Flush()
         return;
     }
 
-    POMDOG_ASSERT(commandList);
     POMDOG_ASSERT(!polygonShapes.IsEmpty());
-    POMDOG_ASSERT((startVertexLocation + polygonShapes.GetVertexCount()) <= polygonShapes.GetMaxVertexCount());
+    POMDOG_ASSERT(polygonShapes.GetVertexCount() <= polygonShapes.GetMaxVertexCount());
+
+    SubmitVertices(polygonShapes.GetData(), polygonShapes.GetVertexCount());
+
+    polygonShapes.Reset();
+}
+
+void PrimitiveBatch::Impl::DrawVertices(const Vertex* vertices, std::size_t vertexCount)
+{
+    POMDOG_ASSERT((vertices != nullptr) || (vertexCount == 0));
+    POMDOG_ASSERT((vertexCount % 3) == 0);
+
+    Flush();
+
+    // NOTE: Splits the vertices into draw calls that fit in a vertex buffer
+    // without breaking a triangle.
+    const auto maxVertexCount = polygonShapes.GetMaxVertexCount() - (polygonShapes.GetMaxVertexCount() % 3);
+    POMDOG_ASSERT(maxVertexCount > 0);
+
+    while (vertexCount > 0) {
+        const auto count = std::min(vertexCount, maxVertexCount);
+        SubmitVertices(vertices, count);
+        vertices += count;
+        vertexCount -= count;
+    }
+}
+
+void PrimitiveBatch::Impl::SubmitVertices(const Vertex* vertices, std::size_t vertexCount)
+{
+    POMDOG_ASSERT(commandList);
+    POMDOG_ASSERT(vertices != nullptr);
+    POMDOG_ASSERT(vertexCount > 0);
+    POMDOG_ASSERT(vertexCount <= polygonShapes.GetMaxVertexCount());
+
+    if ((startVertexLocation + vertexCount) > polygonShapes.GetMaxVertexCount()) {
+        // NOTE: The current vertex buffer is referenced by draw calls that have
+        // already been recorded, so the remaining vertices go to the next one.
+        ++bufferIndex;
+        startVertexLocation = 0;
+    }
+
+    if (bufferIndex >= vertexBuffers.size()) {
+        vertexBuffers.push_back(std::make_shared<VertexBuffer>(graphicsDevice,
+            polygonShapes.GetMaxVertexCount(), sizeof(Vertex), BufferUsage::Dynamic));
+    }
+
+    POMDOG_ASSERT(bufferIndex < vertexBuffers.size());
+    const auto& vertexBuffer = vertexBuffers[bufferIndex];
+    POMDOG_ASSERT((startVertexLocation + vertexCount) <= polygonShapes.GetMaxVertexCount());
 
     const auto vertexOffsetBytes = sizeof(Vertex) * startVertexLocation;
     vertexBuffer->SetData(
         vertexOffsetBytes,
-        polygonShapes.GetData(),
-        polygonShapes.GetVertexCount(),
+        vertices,
+        vertexCount,
         sizeof(Vertex));
 
     commandList->SetVertexBuffer(0, vertexBuffer);
     commandList->SetPipelineState(pipelineState);
     commandList->SetConstantBuffer(0, constantBuffer);
-    commandList->Draw(polygonShapes.GetVertexCount(), startVertexLocation);
+    commandList->Draw(vertexCount, startVertexLocation);
 
-    startVertexLocation += polygonShapes.GetVertexCount();
+    startVertexLocation += vertexCount;
     ++drawCallCount;
 
-    polygonShapes.Reset();
+    if (onFlush) {
+        onFlush(vertices, vertexCount);
+    }
+}
+
+void PrimitiveBatch::Impl::DrawMesh(const PolygonShapeMesh& mesh, const Matrix4x4& worldMatrix)
+{
+    POMDOG_ASSERT(commandList);
+    POMDOG_ASSERT(mesh.GetVertexBuffer());
+
+    // NOTE: Keep the draw order of the shapes submitted before this mesh.
+    Flush();
+
+    // NOTE: Each mesh draw call within a frame needs its own constant buffer,
+    // because the draw calls recorded so far still refer to the previous ones.
+    if (meshDrawCount >= meshConstantBuffers.size()) {
+        meshConstantBuffers.push_back(std::make_shared<ConstantBuffer>(
+            graphicsDevice, sizeof(Matrix4x4), BufferUsage::Dynamic));
+    }
+
+    POMDOG_ASSERT(meshDrawCount < meshConstantBuffers.size());
+    const auto& meshConstantBuffer = meshConstantBuffers[meshDrawCount];
+    ++meshDrawCount;
+
+    alignas(16) Matrix4x4 transposedMatrix = Matrix4x4::Transpose(worldMatrix * viewProjection);
+    meshConstantBuffer->SetValue(transposedMatrix);
+
+    commandList->SetVertexBuffer(0, mesh.GetVertexBuffer());
+    commandList->SetPipelineState(pipelineState);
+    commandList->SetConstantBuffer(0, meshConstantBuffer);
+    commandList->Draw(mesh.GetVertexCount(), 0);
+
+    ++drawCallCount;
 }
 
 // MARK: - PrimitiveBatch
@@ -199,10 +305,26 @@ PrimitiveBatch::PrimitiveBatch(
     std::optional<DepthStencilDescription>&& depthStencilDesc,
     std::optional<RasterizerDescription>&& rasterizerDesc,
     AssetManager& assets)
+    : PrimitiveBatch(
+        graphicsDevice,
+        std::move(depthStencilDesc),
+        std::move(rasterizerDesc),
+        Impl::DefaultMaxVertexCount,
+        assets)
+{
+}
+
+PrimitiveBatch::PrimitiveBatch(
+    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    std::optional<DepthStencilDescription>&& depthStencilDesc,
+    std::optional<RasterizerDescription>&& rasterizerDesc,
+    std::size_t maxVertexCount,
+    AssetManager& assets)
     : impl(std::make_unique<Impl>(
         graphicsDevice,
         std::move(depthStencilDesc),
         std::move(rasterizerDesc),
+        maxVertexCount,
         assets))
 {
 }
@@ -444,6 +566,29 @@ void PrimitiveBatch::DrawTriangle(
         point1, point2, point3, color1, color2, color3);
 }
 
+void PrimitiveBatch::DrawMesh(
+    const PolygonShapeMesh& mesh,
+    const Matrix4x4& worldMatrix)
+{
+    POMDOG_ASSERT(impl);
+    impl->DrawMesh(mesh, worldMatrix);
+}
+
+void PrimitiveBatch::DrawVertices(
+    const PrimitiveBatchVertex* vertices,
+    std::size_t vertexCount)
+{
+    POMDOG_ASSERT(impl);
+    impl->DrawVertices(vertices, vertexCount);
+}
+
+void PrimitiveBatch::SetFlushCallback(
+    std::function<void(const PrimitiveBatchVertex* vertices, std::size_t vertexCount)>&& callback)
+{
+    POMDOG_ASSERT(impl);
+    impl->onFlush = std::move(callback);
+}
+
 void PrimitiveBatch::Flush()
 {
     POMDOG_ASSERT(impl);
@@ -0,0 +1,221 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/Graphics/PrimitiveInstanceBuilder.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace Pomdog {
+namespace {
+
+constexpr std::size_t DefaultMaxInstanceCount = 4096;
+constexpr std::size_t DefaultMinInstanceCount = 256;
+
+PrimitiveInstance CreateInstance(
+    float m11, float m12,
+    float m21, float m22,
+    float x, float y,
+    const Color& color)
+{
+    PrimitiveInstance instance;
+    instance.Transform = Vector4{m11, m12, m21, m22};
+    instance.Translation = Vector4{x, y, 0.0f, 0.0f};
+    instance.Color = color.ToVector4();
+    return instance;
+}
+
+} // unnamed namespace
+
+PrimitiveInstanceBuilder::PrimitiveInstanceBuilder()
+    : maxInstanceCount(DefaultMaxInstanceCount)
+{
+    instances.reserve(DefaultMinInstanceCount);
+}
+
+PrimitiveInstanceBuilder::PrimitiveInstanceBuilder(std::size_t maxInstanceCountIn)
+    : maxInstanceCount(maxInstanceCountIn)
+{
+    POMDOG_ASSERT(maxInstanceCount > 0);
+}
+
+PrimitiveInstanceBuilder::PrimitiveInstanceBuilder(
+    std::size_t maxInstanceCountIn,
+    std::function<void()>&& onFlushIn)
+    : maxInstanceCount(maxInstanceCountIn)
+    , onFlush(std::move(onFlushIn))
+{
+    POMDOG_ASSERT(maxInstanceCount > 0);
+    instances.reserve(std::min(DefaultMinInstanceCount, maxInstanceCount));
+}
+
+void PrimitiveInstanceBuilder::Reset()
+{
+    instances.clear();
+    ranges.clear();
+}
+
+const PrimitiveInstance* PrimitiveInstanceBuilder::GetData() const noexcept
+{
+    return instances.data();
+}
+
+std::size_t PrimitiveInstanceBuilder::GetInstanceCount() const noexcept
+{
+    return instances.size();
+}
+
+const std::vector<PrimitiveInstanceRange>& PrimitiveInstanceBuilder::GetRanges() const noexcept
+{
+    return ranges;
+}
+
+bool PrimitiveInstanceBuilder::IsEmpty() const noexcept
+{
+    return instances.empty();
+}
+
+std::size_t PrimitiveInstanceBuilder::GetMaxInstanceCount() const noexcept
+{
+    return maxInstanceCount;
+}
+
+void PrimitiveInstanceBuilder::DrawCircle(
+    const Vector2& position,
+    float radius,
+    const Color& color)
+{
+    DrawEllipse(position, radius, radius, color);
+}
+
+void PrimitiveInstanceBuilder::DrawEllipse(
+    const Vector2& position,
+    float radiusX,
+    float radiusY,
+    const Color& color)
+{
+    if (radiusX <= 0 || radiusY <= 0) {
+        return;
+    }
+
+    AddInstance(PrimitiveInstanceShape::Circle, CreateInstance(
+        radiusX, 0.0f,
+        0.0f, radiusY,
+        position.X, position.Y,
+        color));
+}
+
+void PrimitiveInstanceBuilder::DrawRectangle(
+    const Rectangle& sourceRect,
+    const Color& color)
+{
+    if (sourceRect.Width <= 0 || sourceRect.Height <= 0) {
+        return;
+    }
+
+    AddInstance(PrimitiveInstanceShape::Rectangle, CreateInstance(
+        static_cast<float>(sourceRect.Width), 0.0f,
+        0.0f, static_cast<float>(sourceRect.Height),
+        static_cast<float>(sourceRect.X), static_cast<float>(sourceRect.Y),
+        color));
+}
+
+void PrimitiveInstanceBuilder::DrawRectangle(
+    const Matrix3x2& matrix,
+    const Vector2& position,
+    float width,
+    float height,
+    const Color& color)
+{
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    // NOTE: Concatenates scale(width, height) * translate(position) * matrix.
+    const auto& m = matrix.m;
+    const auto translation = Vector2::Transform(position, matrix);
+
+    AddInstance(PrimitiveInstanceShape::Rectangle, CreateInstance(
+        width * m[0][0], width * m[0][1],
+        height * m[1][0], height * m[1][1],
+        translation.X, translation.Y,
+        color));
+}
+
+void PrimitiveInstanceBuilder::DrawRectangle(
+    const Vector2& position,
+    float width,
+    float height,
+    const Vector2& originPivot,
+    const Color& color)
+{
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    const auto anchorOffset = Vector2{width, height} * originPivot;
+
+    AddInstance(PrimitiveInstanceShape::Rectangle, CreateInstance(
+        width, 0.0f,
+        0.0f, height,
+        position.X - anchorOffset.X, position.Y - anchorOffset.Y,
+        color));
+}
+
+void PrimitiveInstanceBuilder::DrawTriangle(
+    const Vector2& point1,
+    const Vector2& point2,
+    const Vector2& point3,
+    const Color& color)
+{
+    // NOTE: Maps (0, 0), (1, 0) and (0, 1) onto point1, point2 and point3.
+    const auto u = point2 - point1;
+    const auto v = point3 - point1;
+
+    AddInstance(PrimitiveInstanceShape::Triangle, CreateInstance(
+        u.X, u.Y,
+        v.X, v.Y,
+        point1.X, point1.Y,
+        color));
+}
+
+void PrimitiveInstanceBuilder::DrawShape(
+    PrimitiveInstanceShape shape,
+    const Matrix3x2& matrix,
+    const Color& color)
+{
+    const auto& m = matrix.m;
+
+    AddInstance(shape, CreateInstance(
+        m[0][0], m[0][1],
+        m[1][0], m[1][1],
+        m[2][0], m[2][1],
+        color));
+}
+
+void PrimitiveInstanceBuilder::AddInstance(
+    PrimitiveInstanceShape shape,
+    const PrimitiveInstance& instance)
+{
+    if (instances.size() >= maxInstanceCount) {
+        if (onFlush) {
+            onFlush();
+        }
+        POMDOG_ASSERT(instances.size() < maxInstanceCount);
+    }
+
+    if (ranges.empty() || ranges.back().Shape != shape) {
+        PrimitiveInstanceRange range;
+        range.StartInstanceLocation = instances.size();
+        range.InstanceCount = 0;
+        range.Shape = shape;
+        ranges.push_back(std::move(range));
+    }
+
+    POMDOG_ASSERT(!ranges.empty());
+    POMDOG_ASSERT(ranges.back().Shape == shape);
+    ++ranges.back().InstanceCount;
+
+    instances.push_back(instance);
+}
+
+} // namespace Pomdog
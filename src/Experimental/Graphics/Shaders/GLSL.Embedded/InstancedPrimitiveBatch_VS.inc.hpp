@@ -0,0 +1,17 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+constexpr auto Builtin_GLSL_InstancedPrimitiveBatch_VS = R"(
+#version 330
+layout(location=0)in vec2 Position;
+layout(location=1)in vec4 Transform;
+layout(location=2)in vec4 Translation;
+layout(location=3)in vec4 Color;
+out VertexData{
+vec4 DestinationColor;}Out;
+uniform TransformMatrix{
+mat4 ViewProjection;};
+void main(){
+vec2 position=Position.x*Transform.xy+Position.y*Transform.zw+Translation.xy;
+gl_Position=vec4(position.xy,Translation.z,1.0)*ViewProjection;
+Out.DestinationColor=Color;}
+)";
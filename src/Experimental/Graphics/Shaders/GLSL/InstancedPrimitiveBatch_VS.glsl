@@ -0,0 +1,32 @@
+#version 330
+
+// {xy__} = position.xy
+layout(location = 0) in vec2 Position;
+
+// per Instance
+// {xy__} = first row of the affine transform
+// {__zw} = second row of the affine transform
+layout(location = 1) in vec4 Transform;
+// {xy__} = translation.xy
+// {__z_} = depth
+// {___w} = unused
+layout(location = 2) in vec4 Translation;
+// {xyzw} = color.rgba
+layout(location = 3) in vec4 Color;
+
+out VertexData {
+    vec4 DestinationColor;
+} Out;
+
+uniform TransformMatrix {
+    mat4 ViewProjection;
+};
+
+void main()
+{
+    vec2 position = Position.x * Transform.xy + Position.y * Transform.zw + Translation.xy;
+
+    // NOTE: 'ViewProjection' has already been transposed.
+    gl_Position = vec4(position.xy, Translation.z, 1.0) * ViewProjection;
+    Out.DestinationColor = Color;
+}
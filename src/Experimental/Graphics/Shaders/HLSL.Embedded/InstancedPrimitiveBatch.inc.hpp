@@ -0,0 +1,22 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+constexpr auto BuiltinHLSL_InstancedPrimitiveBatch = R"(
+struct VS_INPUT{
+float2 Position:SV_Position;
+float4 Transform:TEXCOORD0;
+float4 Translation:TEXCOORD1;
+float4 Color:COLOR;};
+struct VS_OUTPUT{
+float4 Position:SV_Position;
+float4 DestinationColor:COLOR0;};
+cbuffer TransformMatrix:register(b0){
+matrix<float,4,4>ViewProjection;};
+VS_OUTPUT InstancedPrimitiveBatchVS(VS_INPUT input){
+float2 position=input.Position.x*input.Transform.xy+input.Position.y*input.Transform.zw+input.Translation.xy;
+VS_OUTPUT output=(VS_OUTPUT)0;
+output.Position=mul(float4(position.xy,input.Translation.z,1),ViewProjection);
+output.DestinationColor=input.Color;
+return output;}
+float4 InstancedPrimitiveBatchPS(VS_OUTPUT input):SV_Target{
+return input.DestinationColor;}
+)";
@@ -0,0 +1,41 @@
+struct VS_INPUT {
+    // {xy__} = position.xy
+    float2 Position: SV_Position;
+
+    // per Instance
+    // {xy__} = first row of the affine transform
+    // {__zw} = second row of the affine transform
+    float4 Transform: TEXCOORD0;
+
+    // {xy__} = translation.xy
+    // {__z_} = depth
+    // {___w} = unused
+    float4 Translation: TEXCOORD1;
+
+    // {xyzw} = color.rgba
+    float4 Color: COLOR;
+};
+
+struct VS_OUTPUT {
+    float4 Position         : SV_Position;
+    float4 DestinationColor : COLOR0;
+};
+
+cbuffer TransformMatrix: register(b0) {
+    matrix<float, 4, 4> ViewProjection;
+};
+
+VS_OUTPUT InstancedPrimitiveBatchVS(VS_INPUT input)
+{
+    float2 position = input.Position.x * input.Transform.xy + input.Position.y * input.Transform.zw + input.Translation.xy;
+
+    VS_OUTPUT output = (VS_OUTPUT)0;
+    output.Position = mul(float4(position.xy, input.Translation.z, 1), ViewProjection);
+    output.DestinationColor = input.Color;
+    return output;
+}
+
+float4 InstancedPrimitiveBatchPS(VS_OUTPUT input) : SV_Target
+{
+    return input.DestinationColor;
+}
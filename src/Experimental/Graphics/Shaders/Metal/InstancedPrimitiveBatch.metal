@@ -0,0 +1,48 @@
+#include <metal_stdlib>
+#include <simd/simd.h>
+
+using namespace metal;
+
+struct __attribute__((__aligned__(256))) TransformMatrix {
+    matrix_float4x4 ViewProjection;
+};
+
+struct VS_INPUT {
+    // {xy__} = position.xy
+    float2 Position [[attribute(0)]];
+
+    // per Instance
+    // {xy__} = first row of the affine transform
+    // {__zw} = second row of the affine transform
+    float4 Transform [[attribute(1)]];
+
+    // {xy__} = translation.xy
+    // {__z_} = depth
+    // {___w} = unused
+    float4 Translation [[attribute(2)]];
+
+    // {xyzw} = color.rgba
+    float4 Color [[attribute(3)]];
+};
+
+struct VS_OUTPUT {
+    float4 Position [[position]];
+    float4 DestinationColor;
+};
+
+vertex VS_OUTPUT InstancedPrimitiveBatchVS(
+    VS_INPUT input [[stage_in]],
+    constant TransformMatrix& uniforms [[buffer(0)]])
+{
+    float2 position = input.Position.x * input.Transform.xy + input.Position.y * input.Transform.zw + input.Translation.xy;
+
+    VS_OUTPUT out;
+    out.Position = float4(position.xy, input.Translation.z, 1.0) * uniforms.ViewProjection;
+    out.DestinationColor = input.Color;
+    return out;
+}
+
+fragment float4 InstancedPrimitiveBatchPS(VS_OUTPUT input [[stage_in]])
+{
+    return input.DestinationColor;
+}
@@ -37,10 +37,20 @@
 #include "Pomdog/Math/Vector3.hpp"
 #include "Pomdog/Math/Vector4.hpp"
 #include <algorithm>
+#include <cstddef>
 #include <cstring>
+#include <iterator>
 #include <tuple>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define POMDOG_SPRITEBATCH_USE_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define POMDOG_SPRITEBATCH_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
 using Pomdog::Detail::AlignedNew;
 
 namespace Pomdog {
@@ -80,6 +90,53 @@ Vector2 ComputeSpriteOffset(const TextureRegion& region, const Vector2& originPi
     return offset;
 }
 
+bool IsDrawable(const SpriteDesc& sprite) noexcept
+{
+    return (sprite.SourceRect.Width > 0)
+        && (sprite.SourceRect.Height > 0)
+        && (sprite.Scale.X != 0.0f)
+        && (sprite.Scale.Y != 0.0f);
+}
+
+float ToColorModeFlags(SurfaceFormat format) noexcept
+{
+    bool sourceRGBEnabled = true;
+    bool sourceAlphaEnabled = true;
+    bool compensationRGB = false;
+    bool compensationAlpha = false;
+
+    switch (format) {
+    case SurfaceFormat::R8_UNorm:
+    case SurfaceFormat::R8G8_UNorm:
+    case SurfaceFormat::R16G16_Float:
+    case SurfaceFormat::R11G11B10_Float:
+    case SurfaceFormat::R32_Float:
+        sourceAlphaEnabled = false;
+        compensationAlpha = true;
+        break;
+    case SurfaceFormat::A8_UNorm:
+        sourceRGBEnabled = false;
+        compensationRGB = true;
+        break;
+    case SurfaceFormat::R8G8B8A8_UNorm:
+    case SurfaceFormat::R10G10B10A2_UNorm:
+    case SurfaceFormat::B8G8R8A8_UNorm:
+    case SurfaceFormat::R16G16B16A16_Float:
+    case SurfaceFormat::R32G32B32A32_Float:
+    case SurfaceFormat::BlockComp1_UNorm:
+    case SurfaceFormat::BlockComp2_UNorm:
+    case SurfaceFormat::BlockComp3_UNorm:
+        break;
+    }
+
+    const int colorModeFlags = (sourceRGBEnabled ? 1 : 0)
+        | (sourceAlphaEnabled ? 2 : 0)
+        | (compensationRGB ? 4 : 0)
+        | (compensationAlpha ? 8 : 0);
+
+    return static_cast<float>(colorModeFlags);
+}
+
 struct alignas(16) SpriteBatchConstantBuffer final {
     Matrix4x4 ViewProjection;
 
@@ -125,24 +182,38 @@ private:
         Vector4 InverseTextureSize;
     };
 
+    static_assert(offsetof(SpriteDesc, Scale) == offsetof(SpriteDesc, Position) + sizeof(Vector2),
+        "SpriteDesc::Position and SpriteDesc::Scale must be contiguous.");
+    static_assert(offsetof(SpriteDesc, Rotation) == offsetof(SpriteDesc, OriginPivot) + sizeof(Vector2),
+        "SpriteDesc::OriginPivot and SpriteDesc::Rotation must be contiguous.");
+    static_assert(offsetof(SpriteDesc, LayerDepth) == offsetof(SpriteDesc, Rotation) + sizeof(float),
+        "SpriteDesc::Rotation and SpriteDesc::LayerDepth must be contiguous.");
+
 private:
     std::vector<SpriteInfo> spriteQueue;
 
+    // NOTE: The sprites in `spriteQueue`, kept only while `onFlush` is set.
+    std::vector<SpriteDesc> recordedSprites;
+
+    std::shared_ptr<GraphicsDevice> graphicsDevice;
     std::shared_ptr<GraphicsCommandList> commandList;
     Texture2DView currentTexture;
 
     std::shared_ptr<VertexBuffer> planeVertices;
     std::shared_ptr<IndexBuffer> planeIndices;
-    std::shared_ptr<VertexBuffer> instanceVertices;
+    std::vector<std::shared_ptr<VertexBuffer>> instanceBuffers;
 
     std::shared_ptr<PipelineState> pipelineState;
     std::shared_ptr<ConstantBuffer> constantBuffer;
     std::shared_ptr<SamplerState> sampler;
 
     Vector2 inverseTextureSize;
+    float colorModeFlags;
+    std::size_t bufferIndex;
     std::size_t startInstanceLocation;
 
 public:
+    std::function<void(const Texture2DView& texture, const SpriteDesc* sprites, std::size_t spriteCount)> onFlush;
     int drawCallCount;
 
 public:
@@ -171,6 +242,11 @@ public:
         const Vector2& scale,
         float layerDepth);
 
+    void DrawBatch(
+        const Texture2DView& texture,
+        const SpriteDesc* sprites,
+        std::size_t spriteCount);
+
     void FlushBatch();
 
     void End();
@@ -181,10 +257,17 @@ private:
         const std::vector<SpriteInfo>& sprites);
 
     void CompareTexture(const Texture2DView& texture);
+
+    void FlushIfFull();
+
+    std::size_t PackSprites(
+        const SpriteDesc* sprites,
+        std::size_t spriteCount,
+        SpriteInfo* output) const noexcept;
 };
 
 SpriteBatch::Impl::Impl(
-    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    const std::shared_ptr<GraphicsDevice>& graphicsDeviceIn,
     std::optional<BlendDescription>&& blendDesc,
     std::optional<RasterizerDescription>&& rasterizerDesc,
     std::optional<SamplerDescription>&& samplerDesc,
@@ -192,7 +275,10 @@ SpriteBatch::Impl::Impl(
     std::optional<DepthFormat>&& depthStencilViewFormat,
     SpriteBatchPixelShaderMode pixelShaderMode,
     AssetManager& assets)
-    : startInstanceLocation(0)
+    : graphicsDevice(graphicsDeviceIn)
+    , colorModeFlags(0.0f)
+    , bufferIndex(0)
+    , startInstanceLocation(0)
     , drawCallCount(0)
 {
     auto presentationParameters = graphicsDevice->GetPresentationParameters();
@@ -251,11 +337,11 @@ SpriteBatch::Impl::Impl(
     }
     {
         const auto maxBatchSize = MaxBatchSize;
-        instanceVertices = std::make_shared<VertexBuffer>(
+        instanceBuffers.push_back(std::make_shared<VertexBuffer>(
             graphicsDevice,
             maxBatchSize,
             sizeof(SpriteInfo),
-            BufferUsage::Dynamic);
+            BufferUsage::Dynamic));
     }
     {
         constantBuffer = std::make_shared<ConstantBuffer>(
@@ -335,6 +421,7 @@ void SpriteBatch::Impl::Begin(
 
     constantBuffer->SetValue(constants);
 
+    bufferIndex = 0;
     startInstanceLocation = 0;
     drawCallCount = 0;
 }
@@ -361,8 +448,13 @@ void SpriteBatch::Impl::FlushBatch()
 
     RenderBatch(currentTexture, spriteQueue);
 
+    if (onFlush) {
+        onFlush(currentTexture, recordedSprites.data(), recordedSprites.size());
+    }
+
     currentTexture = nullptr;
     spriteQueue.clear();
+    recordedSprites.clear();
 }
 
 void SpriteBatch::Impl::RenderBatch(
@@ -377,6 +469,9 @@ void SpriteBatch::Impl::RenderBatch(
     POMDOG_ASSERT(drawCallCount >= 0);
 
     POMDOG_ASSERT(sprites.size() <= MaxBatchSize);
+    POMDOG_ASSERT(bufferIndex < instanceBuffers.size());
+    const auto& instanceVertices = instanceBuffers[bufferIndex];
+
     const auto instanceOffsetBytes = sizeof(SpriteInfo) * startInstanceLocation;
     instanceVertices->SetData(
         instanceOffsetBytes,
@@ -431,9 +526,38 @@ void SpriteBatch::Impl::CompareTexture(const Texture2DView& texture)
 
         inverseTextureSize.X = (w > 0.0f) ? (1.0f / w) : 0.0f;
         inverseTextureSize.Y = (h > 0.0f) ? (1.0f / h) : 0.0f;
+
+        // NOTE: The color mode depends only on the texture format,
+        // so it is computed once per texture instead of once per sprite.
+        colorModeFlags = ToColorModeFlags(texture->GetFormat());
     }
 }
 
+void SpriteBatch::Impl::FlushIfFull()
+{
+    if ((startInstanceLocation + spriteQueue.size()) < MaxBatchSize) {
+        return;
+    }
+
+    FlushBatch();
+    POMDOG_ASSERT(spriteQueue.empty());
+    POMDOG_ASSERT(startInstanceLocation == MaxBatchSize);
+
+    // NOTE: The current instance buffer is referenced by draw calls that have
+    // already been recorded, so the remaining sprites go to the next one.
+    ++bufferIndex;
+    startInstanceLocation = 0;
+
+    if (bufferIndex >= instanceBuffers.size()) {
+        instanceBuffers.push_back(std::make_shared<VertexBuffer>(
+            graphicsDevice,
+            MaxBatchSize,
+            sizeof(SpriteInfo),
+            BufferUsage::Dynamic));
+    }
+    POMDOG_ASSERT(bufferIndex < instanceBuffers.size());
+}
+
 void SpriteBatch::Impl::Draw(
     const Texture2DView& texture,
     const Vector2& position,
@@ -458,48 +582,7 @@ void SpriteBatch::Impl::Draw(
         return;
     }
 
-    if ((startInstanceLocation + spriteQueue.size()) >= MaxBatchSize) {
-        FlushBatch();
-        POMDOG_ASSERT(spriteQueue.empty());
-
-        // TODO: Not implemented
-        // GrowSpriteQueue();
-        return;
-    }
-
-    bool sourceRGBEnabled = true;
-    bool sourceAlphaEnabled = true;
-    bool compensationRGB = false;
-    bool compensationAlpha = false;
-
-    switch (texture->GetFormat()) {
-    case SurfaceFormat::R8_UNorm:
-    case SurfaceFormat::R8G8_UNorm:
-    case SurfaceFormat::R16G16_Float:
-    case SurfaceFormat::R11G11B10_Float:
-    case SurfaceFormat::R32_Float:
-        sourceAlphaEnabled = false;
-        compensationAlpha = true;
-        break;
-    case SurfaceFormat::A8_UNorm:
-        sourceRGBEnabled = false;
-        compensationRGB = true;
-        break;
-    case SurfaceFormat::R8G8B8A8_UNorm:
-    case SurfaceFormat::R10G10B10A2_UNorm:
-    case SurfaceFormat::B8G8R8A8_UNorm:
-    case SurfaceFormat::R16G16B16A16_Float:
-    case SurfaceFormat::R32G32B32A32_Float:
-    case SurfaceFormat::BlockComp1_UNorm:
-    case SurfaceFormat::BlockComp2_UNorm:
-    case SurfaceFormat::BlockComp3_UNorm:
-        break;
-    }
-
-    const int colorModeFlags = (sourceRGBEnabled ? 1 : 0)
-        | (sourceAlphaEnabled ? 2 : 0)
-        | (compensationRGB ? 4 : 0)
-        | (compensationAlpha ? 8 : 0);
+    FlushIfFull();
 
     POMDOG_ASSERT((startInstanceLocation + spriteQueue.size()) < MaxBatchSize);
     POMDOG_ASSERT(sourceRect.Width > 0);
@@ -530,12 +613,175 @@ void SpriteBatch::Impl::Draw(
     info.InverseTextureSize = Vector4{
         inverseTextureSize.X,
         inverseTextureSize.Y,
-        static_cast<float>(colorModeFlags),
+        colorModeFlags,
         0.0f,
     };
 
     spriteQueue.push_back(std::move(info));
     POMDOG_ASSERT((startInstanceLocation + spriteQueue.size()) <= MaxBatchSize);
+
+    if (onFlush) {
+        SpriteDesc sprite;
+        sprite.Position = position;
+        sprite.Scale = scale;
+        sprite.SourceRect = sourceRect;
+        sprite.OriginPivot = originPivot;
+        sprite.Rotation = rotation;
+        sprite.LayerDepth = layerDepth;
+        sprite.Color = color;
+        recordedSprites.push_back(std::move(sprite));
+    }
+}
+
+void SpriteBatch::Impl::DrawBatch(
+    const Texture2DView& texture,
+    const SpriteDesc* sprites,
+    std::size_t spriteCount)
+{
+    POMDOG_ASSERT(texture);
+    POMDOG_ASSERT(texture->GetWidth() > 0);
+    POMDOG_ASSERT(texture->GetHeight() > 0);
+    POMDOG_ASSERT((sprites != nullptr) || (spriteCount == 0));
+
+    if (spriteCount == 0) {
+        return;
+    }
+
+    // NOTE: The sprites are packed into the queue as far as the instance
+    // buffer has room, and the rest go to the next batch.
+    while (spriteCount > 0) {
+        FlushIfFull();
+        CompareTexture(texture);
+
+        const auto capacity = MaxBatchSize - (startInstanceLocation + spriteQueue.size());
+        POMDOG_ASSERT(capacity > 0);
+        const auto count = std::min(spriteCount, capacity);
+
+        const auto oldSize = spriteQueue.size();
+        spriteQueue.resize(oldSize + count);
+
+        const auto packedCount = PackSprites(sprites, count, spriteQueue.data() + oldSize);
+        POMDOG_ASSERT(packedCount <= count);
+
+        spriteQueue.resize(oldSize + packedCount);
+        POMDOG_ASSERT((startInstanceLocation + spriteQueue.size()) <= MaxBatchSize);
+
+        if (onFlush) {
+            // NOTE: Only the sprites that were packed into the queue are
+            // recorded, so that the recorded sprites match the draw call.
+            if (packedCount == count) {
+                recordedSprites.insert(std::end(recordedSprites), sprites, sprites + count);
+            }
+            else {
+                std::copy_if(sprites, sprites + count, std::back_inserter(recordedSprites), IsDrawable);
+            }
+        }
+
+        sprites += count;
+        spriteCount -= count;
+    }
+}
+
+std::size_t SpriteBatch::Impl::PackSprites(
+    const SpriteDesc* sprites,
+    std::size_t spriteCount,
+    SpriteInfo* output) const noexcept
+{
+    POMDOG_ASSERT(sprites != nullptr);
+    POMDOG_ASSERT(output != nullptr);
+
+    std::size_t packedCount = 0;
+
+#if defined(POMDOG_SPRITEBATCH_USE_SSE2)
+    const auto inverseTextureSizeAndFlags = _mm_setr_ps(
+        inverseTextureSize.X, inverseTextureSize.Y, colorModeFlags, 0.0f);
+    const auto inverseColorMax = _mm_set1_ps(1.0f / 255.0f);
+    const auto zero = _mm_setzero_si128();
+#elif defined(POMDOG_SPRITEBATCH_USE_NEON)
+    const float inverseTextureSizeAndFlagsArray[4] = {
+        inverseTextureSize.X, inverseTextureSize.Y, colorModeFlags, 0.0f};
+    const auto inverseTextureSizeAndFlags = vld1q_f32(inverseTextureSizeAndFlagsArray);
+    const auto inverseColorMax = vdupq_n_f32(1.0f / 255.0f);
+#endif
+
+    for (std::size_t i = 0; i < spriteCount; ++i) {
+        const auto& sprite = sprites[i];
+
+        POMDOG_ASSERT(sprite.SourceRect.Width >= 0);
+        POMDOG_ASSERT(sprite.SourceRect.Height >= 0);
+
+        if (!IsDrawable(sprite)) {
+            continue;
+        }
+
+        auto& info = output[packedCount];
+        ++packedCount;
+
+#if defined(POMDOG_SPRITEBATCH_USE_SSE2)
+        // NOTE: {position.xy, scale.xy}
+        const auto translation = _mm_loadu_ps(&sprite.Position.X);
+        const auto sourceRect = _mm_cvtepi32_ps(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(&sprite.SourceRect)));
+        // NOTE: {originPivot.xy, rotation, layerDepth}
+        const auto originRotationLayerDepth = _mm_loadu_ps(&sprite.OriginPivot.X);
+
+        std::int32_t packedColor = 0;
+        std::memcpy(&packedColor, &sprite.Color, sizeof(packedColor));
+        auto color = _mm_cvtsi32_si128(packedColor);
+        color = _mm_unpacklo_epi8(color, zero);
+        color = _mm_unpacklo_epi16(color, zero);
+
+        _mm_storeu_ps(&info.Translation.X, translation);
+        _mm_storeu_ps(&info.SourceRect.X, sourceRect);
+        _mm_storeu_ps(&info.OriginRotationLayerDepth.X, originRotationLayerDepth);
+        _mm_storeu_ps(&info.Color.X, _mm_mul_ps(_mm_cvtepi32_ps(color), inverseColorMax));
+        _mm_storeu_ps(&info.InverseTextureSize.X, inverseTextureSizeAndFlags);
+#elif defined(POMDOG_SPRITEBATCH_USE_NEON)
+        // NOTE: {position.xy, scale.xy}
+        const auto translation = vld1q_f32(&sprite.Position.X);
+        const auto sourceRect = vcvtq_f32_s32(vld1q_s32(&sprite.SourceRect.X));
+        // NOTE: {originPivot.xy, rotation, layerDepth}
+        const auto originRotationLayerDepth = vld1q_f32(&sprite.OriginPivot.X);
+
+        std::uint32_t packedColor = 0;
+        std::memcpy(&packedColor, &sprite.Color, sizeof(packedColor));
+        const auto color8 = vreinterpret_u8_u32(vdup_n_u32(packedColor));
+        const auto color32 = vmovl_u16(vget_low_u16(vmovl_u8(color8)));
+
+        vst1q_f32(&info.Translation.X, translation);
+        vst1q_f32(&info.SourceRect.X, sourceRect);
+        vst1q_f32(&info.OriginRotationLayerDepth.X, originRotationLayerDepth);
+        vst1q_f32(&info.Color.X, vmulq_f32(vcvtq_f32_u32(color32), inverseColorMax));
+        vst1q_f32(&info.InverseTextureSize.X, inverseTextureSizeAndFlags);
+#else
+        info.Translation = Vector4{
+            sprite.Position.X,
+            sprite.Position.Y,
+            sprite.Scale.X,
+            sprite.Scale.Y
+        };
+        info.SourceRect = Vector4{
+            static_cast<float>(sprite.SourceRect.X),
+            static_cast<float>(sprite.SourceRect.Y),
+            static_cast<float>(sprite.SourceRect.Width),
+            static_cast<float>(sprite.SourceRect.Height)
+        };
+        info.OriginRotationLayerDepth = Vector4{
+            sprite.OriginPivot.X,
+            sprite.OriginPivot.Y,
+            sprite.Rotation.value,
+            sprite.LayerDepth
+        };
+        info.Color = sprite.Color.ToVector4();
+        info.InverseTextureSize = Vector4{
+            inverseTextureSize.X,
+            inverseTextureSize.Y,
+            colorModeFlags,
+            0.0f,
+        };
+#endif
+    }
+    return packedCount;
 }
 
 // MARK: - SpriteBatch
@@ -595,6 +841,13 @@ void SpriteBatch::Begin(
     impl->Begin(commandList, transformMatrixIn, distanceFieldParameters);
 }
 
+void SpriteBatch::SetFlushCallback(
+    std::function<void(const Texture2DView& texture, const SpriteDesc* sprites, std::size_t spriteCount)>&& callback)
+{
+    POMDOG_ASSERT(impl);
+    impl->onFlush = std::move(callback);
+}
+
 void SpriteBatch::Flush()
 {
     POMDOG_ASSERT(impl);
@@ -787,6 +1040,24 @@ void SpriteBatch::Draw(
     impl->Draw(texture, position, textureRegion.Subrect, color, rotation, offset, scale, layerDepth);
 }
 
+void SpriteBatch::DrawBatch(
+    const std::shared_ptr<Texture2D>& texture,
+    const SpriteDesc* sprites,
+    std::size_t spriteCount)
+{
+    POMDOG_ASSERT(impl);
+    impl->DrawBatch(texture, sprites, spriteCount);
+}
+
+void SpriteBatch::DrawBatch(
+    const std::shared_ptr<RenderTarget2D>& texture,
+    const SpriteDesc* sprites,
+    std::size_t spriteCount)
+{
+    POMDOG_ASSERT(impl);
+    impl->DrawBatch(texture, sprites, spriteCount);
+}
+
 int SpriteBatch::GetDrawCallCount() const noexcept
 {
     POMDOG_ASSERT(impl);
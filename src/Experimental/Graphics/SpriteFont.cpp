@@ -2,7 +2,9 @@
 
 #include "Pomdog/Experimental/Graphics/SpriteFont.hpp"
 #include "Pomdog/Experimental/Graphics/FontGlyph.hpp"
+#include "Pomdog/Experimental/Graphics/KerningTable.hpp"
 #include "Pomdog/Experimental/Graphics/SpriteBatch.hpp"
+#include "Pomdog/Experimental/Graphics/TextLayout.hpp"
 #include "Pomdog/Experimental/Graphics/TrueTypeFont.hpp"
 #include "Pomdog/Graphics/Texture2D.hpp"
 #include "Pomdog/Math/Color.hpp"
@@ -10,12 +12,21 @@
 #include "Pomdog/Math/Matrix4x4.hpp"
 #include "Pomdog/Math/Point2D.hpp"
 #include "Pomdog/Math/Radian.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
 #include "Pomdog/Math/Vector2.hpp"
 #include "Pomdog/Math/Vector3.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 #include <utfcpp/source/utf8.h>
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Pomdog {
 namespace {
@@ -25,6 +36,23 @@ bool isSpace(char32_t c) noexcept
     return (c == U' ') || (c == U'\t');
 }
 
+std::optional<FontGlyph> RasterizeGlyph(
+    const TrueTypeFont& font,
+    SpriteFontRasterization rasterization,
+    char32_t codePoint,
+    float fontSize,
+    std::vector<std::uint8_t>& pixels)
+{
+    if (rasterization == SpriteFontRasterization::DistanceField) {
+        // NOTE: The padding determines how far the distance field reaches
+        // outside the outline, which limits the width of outlines and the
+        // amount of downscaling that still renders smoothly.
+        const auto padding = std::max(2, static_cast<int>(fontSize / 8.0f));
+        return font.RasterizeGlyphSDF(codePoint, fontSize, padding, pixels);
+    }
+    return font.RasterizeGlyph(codePoint, fontSize, pixels);
+}
+
 } // unnamed namespace
 
 // MARK: - SpriteFont::Impl
@@ -33,17 +61,23 @@ class SpriteFont::Impl final {
 public:
     static constexpr int TextureWidth = 2048;
     static constexpr int TextureHeight = 2048;
+    static constexpr std::size_t LayoutCacheCapacity = 512;
+    static constexpr unsigned int MaxRasterizerThreadCount = 4;
+    static constexpr char32_t MaxCodePoint = 0x10FFFF;
 
     std::unordered_map<char32_t, FontGlyph> spriteFontMap;
+    Detail::KerningTable kerningTable;
 
     char32_t defaultCharacter;
     float lineSpacing;
     float spacing;
     float fontSize;
+    SpriteFontRasterization rasterization;
 
     Impl(
         std::vector<std::shared_ptr<Texture2D>>&& textures,
         const std::vector<FontGlyph>& glyphs,
+        const std::vector<FontKerning>& kernings,
         float spacing,
         float lineSpacing);
 
@@ -51,16 +85,29 @@ public:
         const std::shared_ptr<GraphicsDevice>& graphicsDevice,
         const std::shared_ptr<TrueTypeFont>& font,
         float fontSize,
-        float lineSpacing);
+        float lineSpacing,
+        SpriteFontRasterization rasterization);
+
+    ~Impl();
 
     template <typename Func>
     void ForEach(const std::string& text, Func func);
 
-    Vector2 MeasureString(const std::string& text);
+    TextLayout CreateTextLayout(const std::string& text);
+
+    /// Returns the layout of `text` from the LRU cache, creating it on a miss.
+    const TextLayout& GetTextLayout(const std::string& text);
+
+    void ClearLayoutCache();
+
+    void MeasureCaretOffsets(
+        const std::string& text,
+        std::size_t startIndex,
+        std::vector<float>& offsets);
 
     void Draw(
         SpriteBatch& spriteBatch,
-        const std::string& text,
+        const TextLayout& layout,
         const Vector2& position,
         const Color& color,
         const Radian<float>& rotation,
@@ -69,61 +116,174 @@ public:
 
     void PrepareFonts(const std::string& text);
 
+    /// Queues the glyphs of `text` that are not in the atlas yet for
+    /// rasterization on the worker threads.
+    void RequestGlyphs(const std::string& text);
+
+    void RequestGlyphRanges(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges);
+
+    /// Packs the glyphs rasterized by the worker threads into the atlas.
+    /// This must be called on the thread that owns the graphics device.
+    void FlushRasterizedGlyphs();
+
+    bool HasPendingGlyphs();
+
+    /// Returns the kerning of the pair of characters. For TrueType fonts, the
+    /// pair is looked up in the font on first use and cached.
+    std::int16_t GetKerning(char32_t first, char32_t second);
+
+    bool HasKerning() const;
+
 private:
+    struct RasterizedGlyph final {
+        FontGlyph Glyph;
+        std::vector<std::uint8_t> Pixels;
+    };
+
+    /// Returns the glyph of the default character, rasterizing it immediately if needed.
+    std::unordered_map<char32_t, FontGlyph>::iterator FindDefaultGlyph();
+
+    void AddGlyph(FontGlyph glyph, const std::vector<std::uint8_t>& pixels);
+
+    void AddTexturePage();
+
+    /// Uploads the pixels of the dirty region of the last page, if any.
+    void UploadDirtyRegion();
+
+    struct LayoutCacheEntry final {
+        std::string Text;
+        TextLayout Layout;
+    };
+
+    std::list<LayoutCacheEntry> layoutCache;
+    std::unordered_map<std::string_view, std::list<LayoutCacheEntry>::iterator> layoutCacheMap;
+
     std::vector<std::shared_ptr<Texture2D>> textures;
     std::shared_ptr<GraphicsDevice> graphicsDevice;
     std::shared_ptr<TrueTypeFont> font;
     std::vector<std::uint8_t> pixelData;
+    std::vector<std::uint8_t> uploadBuffer;
+    Rectangle dirtyRegion;
     Point2D currentPoint;
     int bottomY;
+
+    // NOTE: The following members are shared with the worker threads and
+    // are guarded by `rasterizerMutex`.
+    std::mutex rasterizerMutex;
+    std::condition_variable rasterizerCondition;
+    std::deque<char32_t> pendingCodePoints;
+    std::unordered_set<char32_t> requestedCodePoints;
+    std::vector<RasterizedGlyph> rasterizedGlyphs;
+    std::vector<std::thread> rasterizerThreads;
+    int activeRasterizerCount = 0;
+    bool rasterizerStopped = false;
 };
 
 constexpr int SpriteFont::Impl::TextureWidth;
 constexpr int SpriteFont::Impl::TextureHeight;
+constexpr std::size_t SpriteFont::Impl::LayoutCacheCapacity;
+constexpr unsigned int SpriteFont::Impl::MaxRasterizerThreadCount;
+constexpr char32_t SpriteFont::Impl::MaxCodePoint;
 
 SpriteFont::Impl::Impl(
     std::vector<std::shared_ptr<Texture2D>>&& texturesIn,
     const std::vector<FontGlyph>& glyphsIn,
+    const std::vector<FontKerning>& kerningsIn,
     float spacingIn,
     float lineSpacingIn)
     : defaultCharacter(U' ')
     , lineSpacing(lineSpacingIn)
     , spacing(spacingIn)
     , fontSize(0)
+    , rasterization(SpriteFontRasterization::Coverage)
     , textures(std::move(texturesIn))
 {
     for (auto& glyph : glyphsIn) {
         spriteFontMap.emplace(glyph.Character, glyph);
     }
+    kerningTable.Reset(kerningsIn);
 }
 
 SpriteFont::Impl::Impl(
     const std::shared_ptr<GraphicsDevice>& graphicsDeviceIn,
     const std::shared_ptr<TrueTypeFont>& fontIn,
     float fontSizeIn,
-    float lineSpacingIn)
+    float lineSpacingIn,
+    SpriteFontRasterization rasterizationIn)
     : defaultCharacter(U' ')
     , lineSpacing(lineSpacingIn)
     , spacing(0)
     , fontSize(fontSizeIn)
+    , rasterization(rasterizationIn)
     , graphicsDevice(graphicsDeviceIn)
     , font(fontIn)
 {
     POMDOG_ASSERT(font);
 
     pixelData.resize(TextureWidth * TextureHeight, 0);
+    AddTexturePage();
+}
+
+SpriteFont::Impl::~Impl()
+{
+    {
+        std::lock_guard<std::mutex> lock{rasterizerMutex};
+        rasterizerStopped = true;
+        pendingCodePoints.clear();
+    }
+    rasterizerCondition.notify_all();
+
+    for (auto& thread : rasterizerThreads) {
+        POMDOG_ASSERT(thread.joinable());
+        thread.join();
+    }
+}
+
+void SpriteFont::Impl::AddTexturePage()
+{
+    std::fill(std::begin(pixelData), std::end(pixelData), static_cast<std::uint8_t>(0));
     currentPoint = {1, 1};
     bottomY = 1;
+    dirtyRegion = Rectangle{0, 0, 0, 0};
 
     auto texture = std::make_shared<Texture2D>(graphicsDevice,
         TextureWidth, TextureHeight, false, SurfaceFormat::A8_UNorm);
-    textures.push_back(texture);
+
+    // NOTE: Clear the whole page once, so that the padding between glyphs is
+    // initialized before only dirty regions are uploaded.
+    texture->SetData(pixelData.data());
+    textures.push_back(std::move(texture));
+}
+
+void SpriteFont::Impl::UploadDirtyRegion()
+{
+    if ((dirtyRegion.Width <= 0) || (dirtyRegion.Height <= 0)) {
+        return;
+    }
+
+    POMDOG_ASSERT(!textures.empty());
+    POMDOG_ASSERT(dirtyRegion.X >= 0);
+    POMDOG_ASSERT(dirtyRegion.Y >= 0);
+    POMDOG_ASSERT(dirtyRegion.GetRight() <= TextureWidth);
+    POMDOG_ASSERT(dirtyRegion.GetBottom() <= TextureHeight);
+
+    const auto rowBytes = static_cast<std::size_t>(dirtyRegion.Width);
+    uploadBuffer.resize(rowBytes * static_cast<std::size_t>(dirtyRegion.Height));
+
+    for (int y = 0; y < dirtyRegion.Height; ++y) {
+        const auto src = pixelData.data() + (dirtyRegion.Y + y) * TextureWidth + dirtyRegion.X;
+        std::copy_n(src, rowBytes, uploadBuffer.data() + y * rowBytes);
+    }
+
+    textures.back()->SetData(dirtyRegion, 0, uploadBuffer.data());
+    dirtyRegion = Rectangle{0, 0, 0, 0};
 }
 
 template <typename Func>
 void SpriteFont::Impl::ForEach(const std::string& text, Func func)
 {
     Vector2 position = Vector2::Zero;
+    char32_t prevCharacter = 0;
 
     auto textIter = std::begin(text);
     const auto textEnd = std::end(text);
@@ -140,6 +300,7 @@ void SpriteFont::Impl::ForEach(const std::string& text, Func func)
             glyph.Subrect = Rectangle{0, 0, 0, 0};
             glyph.XAdvance = 0;
             func(glyph, position);
+            prevCharacter = 0;
             break;
         }
         case U'\r': {
@@ -152,13 +313,10 @@ void SpriteFont::Impl::ForEach(const std::string& text, Func func)
 
             auto iter = spriteFontMap.find(character);
             if (iter == std::end(spriteFontMap)) {
-                // NOTE: Rasterize glyphs immediately
-                PrepareFonts(text);
-
-                iter = spriteFontMap.find(character);
-                if (iter == std::end(spriteFontMap)) {
-                    iter = spriteFontMap.find(defaultCharacter);
-                }
+                // NOTE: The missing glyphs are requested by the caller and
+                // rasterized on the worker threads. The default character is
+                // drawn until they are ready.
+                iter = FindDefaultGlyph();
             }
 
             POMDOG_ASSERT(iter != std::end(spriteFontMap));
@@ -167,6 +325,11 @@ void SpriteFont::Impl::ForEach(const std::string& text, Func func)
             }
 
             const auto& glyph = iter->second;
+            if (prevCharacter != 0) {
+                position.X += static_cast<float>(GetKerning(prevCharacter, glyph.Character));
+            }
+            prevCharacter = glyph.Character;
+
             position.X += static_cast<float>(glyph.XOffset);
 
             func(glyph, position);
@@ -187,15 +350,9 @@ void SpriteFont::Impl::PrepareFonts(const std::string& text)
         return;
     }
 
-    bool needToFetchPixelData = false;
+    FlushRasterizedGlyphs();
 
-    auto fetchTextureData = [&] {
-        if (needToFetchPixelData) {
-            auto texture = textures.back();
-            texture->SetData(pixelData.data());
-            needToFetchPixelData = false;
-        }
-    };
+    std::vector<std::uint8_t> glyphPixels;
 
     auto textIter = std::begin(text);
     auto textIterEnd = std::end(text);
@@ -207,84 +364,439 @@ void SpriteFont::Impl::PrepareFonts(const std::string& text)
             continue;
         }
 
-        auto glyph = font->RasterizeGlyph(character, fontSize, TextureWidth,
-            [&](int glyphWidth, int glyphHeight, Point2D& pointOut, std::uint8_t*& output) {
-                if (currentPoint.X + glyphWidth + 1 >= TextureWidth) {
-                    // advance to next row
-                    currentPoint.Y = bottomY;
-                    currentPoint.X = 1;
+        auto glyph = RasterizeGlyph(*font, rasterization, character, fontSize, glyphPixels);
+        if (!glyph) {
+            continue;
+        }
+
+        AddGlyph(std::move(*glyph), glyphPixels);
+    }
+
+    UploadDirtyRegion();
+}
+
+void SpriteFont::Impl::RequestGlyphs(const std::string& text)
+{
+    POMDOG_ASSERT(!text.empty());
+
+    if (!graphicsDevice || !font) {
+        return;
+    }
+
+    std::vector<std::pair<char32_t, char32_t>> codePoints;
+
+    auto textIter = std::begin(text);
+    auto textIterEnd = std::end(text);
+
+    while (textIter != textIterEnd) {
+        const auto character = utf8::next(textIter, textIterEnd);
+        if (spriteFontMap.find(character) == std::end(spriteFontMap)) {
+            codePoints.emplace_back(character, character);
+        }
+    }
+
+    if (!codePoints.empty()) {
+        RequestGlyphRanges(codePoints);
+    }
+}
+
+void SpriteFont::Impl::RequestGlyphRanges(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges)
+{
+    if (!graphicsDevice || !font) {
+        return;
+    }
+
+    bool requested = false;
+    {
+        std::lock_guard<std::mutex> lock{rasterizerMutex};
+
+        for (const auto& [first, last] : codePointRanges) {
+            POMDOG_ASSERT(first <= last);
+            POMDOG_ASSERT(last <= MaxCodePoint);
+            const auto end = std::min(last, MaxCodePoint);
+            for (auto codePoint = first; codePoint <= end; ++codePoint) {
+                if ((codePoint == U'\n') || (codePoint == U'\r')) {
+                    continue;
                 }
-                if (currentPoint.Y + glyphHeight + 1 >= TextureHeight) {
-                    fetchTextureData();
-                    std::fill(std::begin(pixelData), std::end(pixelData), static_cast<std::uint8_t>(0));
-
-                    auto textureNew = std::make_shared<Texture2D>(graphicsDevice,
-                        TextureWidth, TextureHeight, false, SurfaceFormat::A8_UNorm);
-                    textures.push_back(textureNew);
-                    currentPoint = {1, 1};
-                    bottomY = 1;
+                if (spriteFontMap.find(codePoint) != std::end(spriteFontMap)) {
+                    continue;
                 }
 
-                POMDOG_ASSERT(currentPoint.X + glyphWidth < TextureWidth);
-                POMDOG_ASSERT(currentPoint.Y + glyphHeight < TextureHeight);
+                // NOTE: Each code point is requested only once, so that
+                // characters which are not in the font are not retried every frame.
+                if (!requestedCodePoints.emplace(codePoint).second) {
+                    continue;
+                }
+                pendingCodePoints.push_back(codePoint);
+                requested = true;
+            }
+        }
 
-                pointOut = currentPoint;
-                output = pixelData.data();
-            });
+        if (requested && rasterizerThreads.empty()) {
+            const auto concurrency = std::max(std::thread::hardware_concurrency(), 2u);
+            const auto threadCount = std::min(concurrency - 1, MaxRasterizerThreadCount);
+
+            for (unsigned int i = 0; i < threadCount; ++i) {
+                rasterizerThreads.emplace_back([this, font = font, fontSize = fontSize, rasterization = rasterization] {
+                    std::vector<std::uint8_t> glyphPixels;
+
+                    std::unique_lock<std::mutex> lock{rasterizerMutex};
+                    for (;;) {
+                        rasterizerCondition.wait(lock, [this] {
+                            return rasterizerStopped || !pendingCodePoints.empty();
+                        });
+                        if (rasterizerStopped) {
+                            break;
+                        }
+
+                        const auto codePoint = pendingCodePoints.front();
+                        pendingCodePoints.pop_front();
+                        ++activeRasterizerCount;
+
+                        lock.unlock();
+                        auto glyph = RasterizeGlyph(*font, rasterization, codePoint, fontSize, glyphPixels);
+                        lock.lock();
+
+                        --activeRasterizerCount;
+                        POMDOG_ASSERT(activeRasterizerCount >= 0);
+
+                        if (glyph) {
+                            rasterizedGlyphs.push_back(RasterizedGlyph{std::move(*glyph), glyphPixels});
+                        }
+                    }
+                });
+            }
+        }
+    }
 
-        if (!glyph) {
+    if (requested) {
+        rasterizerCondition.notify_all();
+    }
+}
+
+void SpriteFont::Impl::FlushRasterizedGlyphs()
+{
+    std::vector<RasterizedGlyph> glyphs;
+    {
+        std::lock_guard<std::mutex> lock{rasterizerMutex};
+        if (rasterizedGlyphs.empty()) {
+            return;
+        }
+        std::swap(glyphs, rasterizedGlyphs);
+    }
+
+    bool atlasChanged = false;
+    for (auto& rasterized : glyphs) {
+        if (spriteFontMap.find(rasterized.Glyph.Character) != std::end(spriteFontMap)) {
+            // NOTE: The glyph has already been rasterized by PrepareFonts().
             continue;
         }
+        AddGlyph(std::move(rasterized.Glyph), rasterized.Pixels);
+        atlasChanged = true;
+    }
 
-        currentPoint.X = currentPoint.X + glyph->Subrect.Width + 1;
-        bottomY = std::max(bottomY, currentPoint.Y + glyph->Subrect.Height + 1);
+    UploadDirtyRegion();
 
-        POMDOG_ASSERT(!textures.empty() && textures.size() > 0);
-        glyph->TexturePage = static_cast<std::int16_t>(textures.size()) - 1;
+    if (atlasChanged) {
+        // NOTE: Cached layouts may contain the default character in place of
+        // the glyphs that have just been added.
+        ClearLayoutCache();
+    }
+}
+
+std::int16_t SpriteFont::Impl::GetKerning(char32_t first, char32_t second)
+{
+    if (font == nullptr) {
+        return kerningTable.Find(first, second);
+    }
+    if (!font->HasKerning()) {
+        return 0;
+    }
 
-        spriteFontMap.emplace(glyph->Character, *glyph);
-        needToFetchPixelData = true;
+    if (auto amount = kerningTable.TryFind(first, second); amount) {
+        return *amount;
     }
 
-    fetchTextureData();
+    // NOTE: Pairs without kerning are cached as zero so that the font is
+    // looked up only once per pair.
+    const auto amount = font->GetKerning(first, second, fontSize);
+    kerningTable.Insert(first, second, amount);
+    return amount;
+}
+
+bool SpriteFont::Impl::HasKerning() const
+{
+    if (font != nullptr) {
+        return font->HasKerning();
+    }
+    return !kerningTable.IsEmpty();
+}
+
+bool SpriteFont::Impl::HasPendingGlyphs()
+{
+    std::lock_guard<std::mutex> lock{rasterizerMutex};
+    return !pendingCodePoints.empty()
+        || !rasterizedGlyphs.empty()
+        || (activeRasterizerCount > 0);
+}
+
+std::unordered_map<char32_t, FontGlyph>::iterator SpriteFont::Impl::FindDefaultGlyph()
+{
+    auto iter = spriteFontMap.find(defaultCharacter);
+    if ((iter == std::end(spriteFontMap)) && graphicsDevice && font) {
+        std::vector<std::uint8_t> glyphPixels;
+        if (auto glyph = RasterizeGlyph(*font, rasterization, defaultCharacter, fontSize, glyphPixels); glyph) {
+            AddGlyph(std::move(*glyph), glyphPixels);
+            UploadDirtyRegion();
+            iter = spriteFontMap.find(defaultCharacter);
+        }
+    }
+    return iter;
 }
 
-Vector2 SpriteFont::Impl::MeasureString(const std::string& text)
+void SpriteFont::Impl::AddGlyph(FontGlyph glyph, const std::vector<std::uint8_t>& pixels)
+{
+    const int glyphWidth = glyph.Subrect.Width;
+    const int glyphHeight = glyph.Subrect.Height;
+
+    POMDOG_ASSERT(glyphWidth >= 0);
+    POMDOG_ASSERT(glyphHeight >= 0);
+
+    if (currentPoint.X + glyphWidth + 1 >= TextureWidth) {
+        // advance to next row
+        currentPoint.Y = bottomY;
+        currentPoint.X = 1;
+    }
+    if (currentPoint.Y + glyphHeight + 1 >= TextureHeight) {
+        UploadDirtyRegion();
+        AddTexturePage();
+    }
+
+    POMDOG_ASSERT(currentPoint.X + glyphWidth < TextureWidth);
+    POMDOG_ASSERT(currentPoint.Y + glyphHeight < TextureHeight);
+
+    glyph.Subrect.X = currentPoint.X;
+    glyph.Subrect.Y = currentPoint.Y;
+
+    if (!pixels.empty()) {
+        POMDOG_ASSERT(pixels.size() == static_cast<std::size_t>(glyphWidth * glyphHeight));
+        for (int y = 0; y < glyphHeight; ++y) {
+            std::copy_n(
+                pixels.data() + y * glyphWidth,
+                glyphWidth,
+                pixelData.data() + (currentPoint.Y + y) * TextureWidth + currentPoint.X);
+        }
+    }
+
+    currentPoint.X = currentPoint.X + glyphWidth + 1;
+    bottomY = std::max(bottomY, currentPoint.Y + glyphHeight + 1);
+
+    POMDOG_ASSERT(!textures.empty() && textures.size() > 0);
+    glyph.TexturePage = static_cast<std::int16_t>(textures.size()) - 1;
+
+    if (!pixels.empty()) {
+        // NOTE: Coalesce the glyphs added before the next upload into a single region.
+        if ((dirtyRegion.Width <= 0) || (dirtyRegion.Height <= 0)) {
+            dirtyRegion = glyph.Subrect;
+        }
+        else {
+            const auto left = std::min(dirtyRegion.X, glyph.Subrect.X);
+            const auto top = std::min(dirtyRegion.Y, glyph.Subrect.Y);
+            const auto right = std::max(dirtyRegion.GetRight(), glyph.Subrect.GetRight());
+            const auto bottom = std::max(dirtyRegion.GetBottom(), glyph.Subrect.GetBottom());
+            dirtyRegion = Rectangle{left, top, right - left, bottom - top};
+        }
+    }
+
+    const auto character = glyph.Character;
+    spriteFontMap.emplace(character, std::move(glyph));
+}
+
+TextLayout SpriteFont::Impl::CreateTextLayout(const std::string& text)
 {
     POMDOG_ASSERT(!text.empty());
 
-    Vector2 result = Vector2::Zero;
+    TextLayout layout;
+    layout.LineSpacing = lineSpacing;
 
     ForEach(text, [&](const FontGlyph& glyph, const Vector2& postion) {
         if (glyph.Character == U'\n') {
-            result = Vector2::Max(result, postion + Vector2{0.0f, lineSpacing});
+            layout.Size = Vector2::Max(layout.Size, postion + Vector2{0.0f, lineSpacing});
+            layout.LineBreaks.push_back(layout.Glyphs.size());
             return;
         }
         float w = static_cast<float>(glyph.Subrect.Width);
         float h = static_cast<float>(glyph.Subrect.Height);
-        h = std::max(h, lineSpacing);
 
         if (glyph.Character == U' ') {
             const auto advance = glyph.XAdvance - glyph.XOffset;
             w += (static_cast<float>(advance) - static_cast<float>(spacing));
         }
 
-        result = Vector2::Max(result, postion + Vector2{w, h});
+        layout.Size = Vector2::Max(layout.Size, postion + Vector2{w, std::max(h, lineSpacing)});
+
+        if (isSpace(glyph.Character)) {
+            // NOTE: Skip rendering
+            return;
+        }
+        if ((glyph.Subrect.Width <= 0) || (glyph.Subrect.Height <= 0)) {
+            // NOTE: Skip rendering
+            return;
+        }
+
+        POMDOG_ASSERT(glyph.TexturePage >= 0);
+        POMDOG_ASSERT(glyph.TexturePage < static_cast<int>(textures.size()));
+
+        TextLayoutGlyph layoutGlyph;
+        layoutGlyph.Subrect = glyph.Subrect;
+        layoutGlyph.Position = Vector2{
+            postion.X,
+            -postion.Y - (static_cast<float>(glyph.YOffset) + h)};
+        layoutGlyph.Character = glyph.Character;
+        layoutGlyph.TexturePage = glyph.TexturePage;
+        layout.Glyphs.push_back(std::move(layoutGlyph));
     });
 
-    return result;
+    return layout;
+}
+
+const TextLayout& SpriteFont::Impl::GetTextLayout(const std::string& text)
+{
+    POMDOG_ASSERT(!text.empty());
+
+    FlushRasterizedGlyphs();
+
+    POMDOG_ASSERT(layoutCache.size() == layoutCacheMap.size());
+
+    if (auto iter = layoutCacheMap.find(text); iter != std::end(layoutCacheMap)) {
+        // NOTE: Move the entry to the front as the most recently used one.
+        layoutCache.splice(std::begin(layoutCache), layoutCache, iter->second);
+        return iter->second->Layout;
+    }
+
+    // NOTE: Request all missing glyphs of the text at once before laying it out.
+    RequestGlyphs(text);
+
+    if (layoutCache.size() >= LayoutCacheCapacity) {
+        // NOTE: Reuse the least recently used entry.
+        POMDOG_ASSERT(!layoutCache.empty());
+        layoutCacheMap.erase(layoutCache.back().Text);
+        layoutCache.splice(std::begin(layoutCache), layoutCache, std::prev(std::end(layoutCache)));
+        layoutCache.front().Text = text;
+    }
+    else {
+        layoutCache.push_front(LayoutCacheEntry{text, TextLayout{}});
+    }
+
+    auto& entry = layoutCache.front();
+    entry.Layout = CreateTextLayout(entry.Text);
+    layoutCacheMap.emplace(entry.Text, std::begin(layoutCache));
+
+    return entry.Layout;
+}
+
+void SpriteFont::Impl::ClearLayoutCache()
+{
+    layoutCacheMap.clear();
+    layoutCache.clear();
+}
+
+void SpriteFont::Impl::MeasureCaretOffsets(
+    const std::string& text,
+    std::size_t startIndex,
+    std::vector<float>& offsets)
+{
+    startIndex = std::min(startIndex, text.size());
+
+    // NOTE: Move back to the first byte of a UTF-8 sequence.
+    while ((startIndex > 0) && (startIndex < text.size()) &&
+        ((static_cast<std::uint8_t>(text[startIndex]) & 0xC0) == 0x80)) {
+        --startIndex;
+    }
+
+    offsets.resize(text.size() + 1, 0.0f);
+    if (startIndex == 0) {
+        offsets.front() = 0.0f;
+    }
+
+    if (startIndex >= text.size()) {
+        return;
+    }
+
+    // NOTE: Caret offsets are cached by the caller, so rasterize the missing
+    // glyphs immediately instead of measuring the default character.
+    PrepareFonts(text.substr(startIndex));
+
+    const auto textBegin = std::begin(text);
+    const auto textEnd = std::end(text);
+    auto textIter = textBegin + static_cast<std::ptrdiff_t>(startIndex);
+
+    float position = offsets[startIndex];
+    auto index = startIndex;
+
+    char32_t prevCharacter = 0;
+    if ((startIndex > 0) && HasKerning()) {
+        // NOTE: The kerning with the character in front of `startIndex` is
+        // applied to the first character that is measured again.
+        auto prevIter = textIter;
+        prevCharacter = utf8::prior(prevIter, textBegin);
+        if (auto glyph = spriteFontMap.find(prevCharacter); glyph != std::end(spriteFontMap)) {
+            prevCharacter = glyph->second.Character;
+        }
+        else if (auto defaultGlyph = FindDefaultGlyph(); defaultGlyph != std::end(spriteFontMap)) {
+            prevCharacter = defaultGlyph->second.Character;
+        }
+        if ((prevCharacter == U'\n') || (prevCharacter == U'\r')) {
+            prevCharacter = 0;
+        }
+    }
+
+    while (textIter != textEnd) {
+        const auto character = utf8::next(textIter, textEnd);
+
+        switch (character) {
+        case U'\n':
+            position = 0.0f;
+            prevCharacter = 0;
+            break;
+        case U'\r':
+            break;
+        default: {
+            auto iter = spriteFontMap.find(character);
+            if (iter == std::end(spriteFontMap)) {
+                iter = FindDefaultGlyph();
+            }
+            if (iter != std::end(spriteFontMap)) {
+                if (prevCharacter != 0) {
+                    position += static_cast<float>(GetKerning(prevCharacter, iter->second.Character));
+                }
+                prevCharacter = iter->second.Character;
+                position += (static_cast<float>(iter->second.XAdvance) - spacing);
+            }
+            break;
+        }
+        }
+
+        // NOTE: The offsets inside a UTF-8 sequence are the same as the
+        // offset before the sequence.
+        const auto nextIndex = static_cast<std::size_t>(std::distance(textBegin, textIter));
+        POMDOG_ASSERT(nextIndex > index);
+        std::fill(std::next(std::begin(offsets), index + 1), std::next(std::begin(offsets), nextIndex), offsets[index]);
+        offsets[nextIndex] = position;
+        index = nextIndex;
+    }
 }
 
 void SpriteFont::Impl::Draw(
     SpriteBatch& spriteBatch,
-    const std::string& text,
+    const TextLayout& layout,
     const Vector2& position,
     const Color& color,
     const Radian<float>& rotation,
     const Vector2& originPivot,
     const Vector2& scale)
 {
-    if (text.empty()) {
+    if (layout.Glyphs.empty()) {
         return;
     }
 
@@ -296,38 +808,24 @@ void SpriteFont::Impl::Draw(
         return;
     }
 
-    // FIXME: Need to optimize layout calculation here.
-    const auto labelSize = MeasureString(text);
+    const auto& labelSize = layout.Size;
 
     if ((labelSize.X < 1.0f) || (labelSize.Y < 1.0f)) {
         return;
     }
-    const auto baseOffset = labelSize * originPivot - Vector2{0.0f, labelSize.Y - lineSpacing};
+    const auto baseOffset = labelSize * originPivot - Vector2{0.0f, labelSize.Y - layout.LineSpacing};
 
-    ForEach(text, [&](const FontGlyph& glyph, const Vector2& pos) {
-        if (isSpace(glyph.Character)) {
-            // NOTE: Skip rendering
-            return;
-        }
-        if ((glyph.Subrect.Width <= 0) || (glyph.Subrect.Height <= 0)) {
-            // NOTE: Skip rendering
-            return;
-        }
-
-        POMDOG_ASSERT(glyph.Character != U'\n');
+    for (const auto& glyph : layout.Glyphs) {
         POMDOG_ASSERT(glyph.TexturePage >= 0);
         POMDOG_ASSERT(glyph.TexturePage < static_cast<int>(textures.size()));
 
         auto w = static_cast<float>(glyph.Subrect.Width);
         auto h = static_cast<float>(glyph.Subrect.Height);
 
-        auto offset = Vector2{
-            pos.X,
-            -pos.Y - (static_cast<float>(glyph.YOffset) + h)};
-        offset = (baseOffset - offset) / Vector2{w, h};
+        const auto offset = (baseOffset - glyph.Position) / Vector2{w, h};
 
         spriteBatch.Draw(textures[glyph.TexturePage], position, glyph.Subrect, color, rotation, offset, scale);
-    });
+    }
 }
 
 // MARK: - SpriteFont
@@ -337,7 +835,17 @@ SpriteFont::SpriteFont(
     const std::vector<FontGlyph>& glyphs,
     float spacing,
     float lineSpacing)
-    : impl(std::make_unique<Impl>(std::move(textures), glyphs, spacing, lineSpacing))
+    : impl(std::make_unique<Impl>(std::move(textures), glyphs, std::vector<FontKerning>{}, spacing, lineSpacing))
+{
+}
+
+SpriteFont::SpriteFont(
+    std::vector<std::shared_ptr<Texture2D>>&& textures,
+    const std::vector<FontGlyph>& glyphs,
+    const std::vector<FontKerning>& kernings,
+    float spacing,
+    float lineSpacing)
+    : impl(std::make_unique<Impl>(std::move(textures), glyphs, kernings, spacing, lineSpacing))
 {
 }
 
@@ -346,7 +854,17 @@ SpriteFont::SpriteFont(
     const std::shared_ptr<TrueTypeFont>& font,
     float fontSize,
     float lineSpacing)
-    : impl(std::make_unique<Impl>(graphicsDevice, font, fontSize, lineSpacing))
+    : SpriteFont(graphicsDevice, font, fontSize, lineSpacing, SpriteFontRasterization::Coverage)
+{
+}
+
+SpriteFont::SpriteFont(
+    const std::shared_ptr<GraphicsDevice>& graphicsDevice,
+    const std::shared_ptr<TrueTypeFont>& font,
+    float fontSize,
+    float lineSpacing,
+    SpriteFontRasterization rasterization)
+    : impl(std::make_unique<Impl>(graphicsDevice, font, fontSize, lineSpacing, rasterization))
 {
 }
 
@@ -358,13 +876,29 @@ void SpriteFont::PrepareFonts(const std::string& utf8String)
     return impl->PrepareFonts(utf8String);
 }
 
+void SpriteFont::PrewarmGlyphs(const std::vector<std::pair<char32_t, char32_t>>& codePointRanges)
+{
+    POMDOG_ASSERT(impl);
+    impl->RequestGlyphRanges(codePointRanges);
+}
+
 Vector2 SpriteFont::MeasureString(const std::string& utf8String) const
 {
     POMDOG_ASSERT(impl);
     if (utf8String.empty()) {
         return Vector2::Zero;
     }
-    return impl->MeasureString(utf8String);
+    return impl->GetTextLayout(utf8String).Size;
+}
+
+TextLayout SpriteFont::CreateTextLayout(const std::string& utf8String) const
+{
+    POMDOG_ASSERT(impl);
+    if (utf8String.empty()) {
+        return TextLayout{};
+    }
+    impl->PrepareFonts(utf8String);
+    return impl->CreateTextLayout(utf8String);
 }
 
 char32_t SpriteFont::GetDefaultCharacter() const
@@ -377,6 +911,9 @@ void SpriteFont::SetDefaultCharacter(char32_t character)
 {
     POMDOG_ASSERT(impl);
     POMDOG_ASSERT(ContainsCharacter(character));
+    if (impl->defaultCharacter != character) {
+        impl->ClearLayoutCache();
+    }
     impl->defaultCharacter = character;
 }
 
@@ -389,9 +926,27 @@ float SpriteFont::GetLineSpacing() const
 void SpriteFont::SetLineSpacing(float lineSpacingIn)
 {
     POMDOG_ASSERT(impl);
+    if (impl->lineSpacing != lineSpacingIn) {
+        impl->ClearLayoutCache();
+    }
     impl->lineSpacing = lineSpacingIn;
 }
 
+void SpriteFont::MeasureCaretOffsets(
+    const std::string& utf8String,
+    std::size_t startIndex,
+    std::vector<float>& offsets) const
+{
+    POMDOG_ASSERT(impl);
+    impl->MeasureCaretOffsets(utf8String, startIndex, offsets);
+}
+
+bool SpriteFont::HasPendingGlyphs() const
+{
+    POMDOG_ASSERT(impl);
+    return impl->HasPendingGlyphs();
+}
+
 bool SpriteFont::ContainsCharacter(char32_t character) const
 {
     POMDOG_ASSERT(impl);
@@ -408,8 +963,9 @@ void SpriteFont::Draw(
         return;
     }
 
-    impl->PrepareFonts(text);
-    impl->Draw(spriteBatch, text, position, color, 0.0f, Vector2{0.0f, 0.0f}, Vector2{1.0f, 1.0f});
+    POMDOG_ASSERT(impl);
+    const auto& layout = impl->GetTextLayout(text);
+    impl->Draw(spriteBatch, layout, position, color, 0.0f, Vector2{0.0f, 0.0f}, Vector2{1.0f, 1.0f});
 }
 
 void SpriteFont::Draw(
@@ -437,8 +993,32 @@ void SpriteFont::Draw(
         return;
     }
 
-    impl->PrepareFonts(text);
-    impl->Draw(spriteBatch, text, position, color, rotation, originPivot, scale);
+    POMDOG_ASSERT(impl);
+    const auto& layout = impl->GetTextLayout(text);
+    impl->Draw(spriteBatch, layout, position, color, rotation, originPivot, scale);
+}
+
+void SpriteFont::Draw(
+    SpriteBatch& spriteBatch,
+    const TextLayout& layout,
+    const Vector2& position,
+    const Color& color)
+{
+    POMDOG_ASSERT(impl);
+    impl->Draw(spriteBatch, layout, position, color, 0.0f, Vector2{0.0f, 0.0f}, Vector2{1.0f, 1.0f});
+}
+
+void SpriteFont::Draw(
+    SpriteBatch& spriteBatch,
+    const TextLayout& layout,
+    const Vector2& position,
+    const Color& color,
+    const Radian<float>& rotation,
+    const Vector2& originPivot,
+    const Vector2& scale)
+{
+    POMDOG_ASSERT(impl);
+    impl->Draw(spriteBatch, layout, position, color, rotation, originPivot, scale);
 }
 
 } // namespace Pomdog
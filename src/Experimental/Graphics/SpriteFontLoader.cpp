@@ -2,15 +2,18 @@
 
 #include "Pomdog/Experimental/Graphics/SpriteFontLoader.hpp"
 #include "Pomdog/Content/AssetManager.hpp"
+#include "Pomdog/Content/Utility/CookedData.hpp"
+#include "Pomdog/Content/Utility/MakeFourCC.hpp"
 #include "Pomdog/Experimental/Graphics/FontGlyph.hpp"
 #include "Pomdog/Experimental/Graphics/SpriteFont.hpp"
+#include "Pomdog/Graphics/Texture2D.hpp"
 #include "Pomdog/Utility/Assert.hpp"
-#include "Pomdog/Utility/FileSystem.hpp"
 #include "Pomdog/Utility/PathHelper.hpp"
 #include <algorithm>
-#include <fstream>
+#include <limits>
 #include <regex>
 #include <sstream>
+#include <string_view>
 #include <utility>
 
 namespace Pomdog::Detail {
@@ -298,40 +301,293 @@ FontGlyph ParseGlyph(std::istream& stream)
     return result;
 }
 
-} // unnamed namespace
+std::tuple<std::shared_ptr<SpriteFont>, std::shared_ptr<Error>>
+CreateSpriteFont(
+    AssetManager& assets,
+    const std::string& filePath,
+    const BitmapFontInfo& info,
+    const BitmapFontCommon& common,
+    std::vector<BitmapFontPage>&& pages,
+    std::vector<FontGlyph>&& glyphs,
+    std::vector<FontKerning>&& kernings)
+{
+    if (pages.empty()) {
+        auto err = Errors::New("invalid file format " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    }
+    POMDOG_ASSERT(!pages.empty());
+
+    auto pageLess = [](const BitmapFontPage& a, const BitmapFontPage& b) {
+        return a.ID < b.ID;
+    };
+
+    std::sort(std::begin(pages), std::end(pages), pageLess);
+    if (std::unique(std::begin(pages), std::end(pages), pageLess) != std::end(pages)) {
+        auto err = Errors::New("invalid file format " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    }
+    POMDOG_ASSERT(std::unique(std::begin(pages), std::end(pages), pageLess) == std::end(pages));
+
+    // NOTE: The page IDs are indices into the textures, so they must be 0 to n-1.
+    if ((pages.front().ID != 0) || (pages.back().ID != (pages.size() - 1))) {
+        auto err = Errors::New("the page IDs are not contiguous " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    if (glyphs.empty()) {
+        auto err = Errors::New("the font has no glyphs " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    for (const auto& glyph : glyphs) {
+        if ((glyph.TexturePage < 0) || (static_cast<std::size_t>(glyph.TexturePage) >= pages.size())) {
+            auto err = Errors::New("the texture page of a glyph is out of range " + filePath);
+            return std::make_tuple(nullptr, std::move(err));
+        }
+    }
+
+    std::vector<std::shared_ptr<Texture2D>> textures;
+    {
+        auto directoryName = std::get<0>(PathHelper::Split(filePath));
+        for (auto& page : pages) {
+            auto [texture, textureErr] = assets.Load<Texture2D>(PathHelper::Join(directoryName, page.Path));
+            if (textureErr != nullptr) {
+                auto err = Errors::Wrap(std::move(textureErr), "failed to load sprite font texture " + page.Path);
+                return std::make_tuple(nullptr, std::move(err));
+            }
+            textures.push_back(std::move(texture));
+        }
+    }
+
+    POMDOG_ASSERT(!glyphs.empty());
+    auto defaultCharacter = glyphs.front().Character;
+
+    for (auto& glyph : glyphs) {
+        glyph.YOffset = glyph.YOffset - common.Base;
+    }
+
+    auto spriteFont = std::make_shared<SpriteFont>(
+        std::move(textures),
+        std::move(glyphs),
+        std::move(kernings),
+        static_cast<std::int16_t>(info.PaddingLeft + info.PaddingRight),
+        static_cast<std::int16_t>(common.LineHeight));
+    spriteFont->SetDefaultCharacter(defaultCharacter);
+
+    return std::make_tuple(std::move(spriteFont), nullptr);
+}
+
+// NOTE: The layout of a cooked sprite font must be kept in sync with
+// `tools/cook_data/font.go`. The values are stored as they are written in the
+// BMFont text, so that both formats are converted by CreateSpriteFont().
+constexpr std::uint32_t CookedSpriteFontSignature = MakeFourCC('F', 'O', 'N', 'T');
+constexpr std::uint32_t CookedSpriteFontVersion = 1;
+
+struct CookedSpriteFontSection final {
+    enum : std::uint32_t {
+        Strings,
+        Fonts,
+        Pages,
+        Glyphs,
+        Kernings,
+        SectionCount,
+    };
+};
+
+struct CookedSpriteFont final {
+    std::int16_t LineHeight;
+    std::int16_t Base;
+    std::int16_t PaddingLeft;
+    std::int16_t PaddingRight;
+};
+
+struct CookedSpriteFontPage final {
+    CookedString Path;
+    std::uint32_t ID;
+};
+
+struct CookedSpriteFontGlyph final {
+    std::int32_t X;
+    std::int32_t Y;
+    std::int32_t Width;
+    std::int32_t Height;
+    std::uint32_t Character;
+    std::int16_t XOffset;
+    std::int16_t YOffset;
+    std::int16_t XAdvance;
+    std::int16_t TexturePage;
+};
+
+struct CookedSpriteFontKerning final {
+    std::uint32_t First;
+    std::uint32_t Second;
+    std::int16_t Amount;
+    std::uint16_t Reserved;
+};
+
+static_assert(sizeof(CookedSpriteFont) == 8);
+static_assert(sizeof(CookedSpriteFontPage) == 12);
+static_assert(sizeof(CookedSpriteFontGlyph) == 28);
+static_assert(sizeof(CookedSpriteFontKerning) == 12);
 
 std::tuple<std::shared_ptr<SpriteFont>, std::shared_ptr<Error>>
-AssetLoader<SpriteFont>::operator()(AssetManager& assets, const std::string& filePath)
+ReadCookedSpriteFont(AssetManager& assets, const MappedFile& binary, const std::string& filePath)
 {
-    std::ifstream stream{filePath, std::ifstream::binary};
+    CookedDataReader reader;
+    auto err = reader.Open(
+        binary.GetData(),
+        binary.GetSize(),
+        CookedSpriteFontSignature,
+        CookedSpriteFontVersion,
+        CookedSpriteFontSection::SectionCount);
+
+    if (err != nullptr) {
+        err = Errors::Wrap(std::move(err), "invalid cooked sprite font " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    const auto fonts = reader.GetSection<CookedSpriteFont>(CookedSpriteFontSection::Fonts);
+    const auto cookedPages = reader.GetSection<CookedSpriteFontPage>(CookedSpriteFontSection::Pages);
+    const auto cookedGlyphs = reader.GetSection<CookedSpriteFontGlyph>(CookedSpriteFontSection::Glyphs);
+    const auto cookedKernings = reader.GetSection<CookedSpriteFontKerning>(CookedSpriteFontSection::Kernings);
 
-    if (!stream) {
-        auto err = Errors::New("cannot open the file, " + filePath);
+    if (fonts.size() != 1) {
+        auto err = Errors::New("invalid cooked sprite font " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    auto [byteLength, sizeErr] = FileSystem::GetFileSize(filePath);
-    if (sizeErr != nullptr) {
-        auto err = Errors::Wrap(std::move(sizeErr), "failed to get file size, " + filePath);
+    BitmapFontInfo info;
+    info.PaddingLeft = fonts[0].PaddingLeft;
+    info.PaddingRight = fonts[0].PaddingRight;
+
+    BitmapFontCommon common;
+    common.LineHeight = fonts[0].LineHeight;
+    common.Base = fonts[0].Base;
+
+    std::vector<BitmapFontPage> pages;
+    pages.reserve(cookedPages.size());
+    for (const auto& page : cookedPages) {
+        if (page.ID > std::numeric_limits<std::uint16_t>::max()) {
+            auto err = Errors::New("invalid cooked sprite font " + filePath);
+            return std::make_tuple(nullptr, std::move(err));
+        }
+        BitmapFontPage result;
+        result.Path = reader.GetString(page.Path);
+        result.ID = static_cast<std::uint16_t>(page.ID);
+        pages.push_back(std::move(result));
+    }
+
+    std::vector<FontGlyph> glyphs;
+    glyphs.reserve(cookedGlyphs.size());
+    for (const auto& glyph : cookedGlyphs) {
+        FontGlyph result;
+        result.Subrect = Rectangle{glyph.X, glyph.Y, glyph.Width, glyph.Height};
+        result.Character = static_cast<char32_t>(glyph.Character);
+        result.XOffset = glyph.XOffset;
+        result.YOffset = glyph.YOffset;
+        result.XAdvance = glyph.XAdvance;
+        result.TexturePage = glyph.TexturePage;
+        glyphs.push_back(std::move(result));
+    }
+
+    std::vector<FontKerning> kernings;
+    for (const auto& kerning : cookedKernings) {
+        if (kerning.Amount != 0) {
+            FontKerning result;
+            result.First = static_cast<char32_t>(kerning.First);
+            result.Second = static_cast<char32_t>(kerning.Second);
+            result.Amount = kerning.Amount;
+            kernings.push_back(std::move(result));
+        }
+    }
+
+    if (!reader.IsValid()) {
+        auto err = Errors::New("invalid cooked sprite font: a reference is out of range, " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    POMDOG_ASSERT(stream);
+    return CreateSpriteFont(
+        assets,
+        filePath,
+        info,
+        common,
+        std::move(pages),
+        std::move(glyphs),
+        std::move(kernings));
+}
+
+} // unnamed namespace
+
+FontKerning ParseKerning(std::istream& stream)
+{
+    FontKerning result;
+    result.First = 0;
+    result.Second = 0;
+    result.Amount = 0;
+
+    std::string source;
+    while (stream >> source && !stream.fail()) {
+        auto expr = std::regex("([a-zA-Z_][a-zA-Z0-9_]*)(=)(.*)");
+        std::smatch match;
+        if (std::regex_match(source, match, expr)) {
+            POMDOG_ASSERT(match.size() >= 4);
+            auto name = match[1].str();
+            auto arguments = match[3].str();
+
+            if (name == "first") {
+                result.First = std::stoi(arguments);
+            }
+            else if (name == "second") {
+                result.Second = std::stoi(arguments);
+            }
+            else if (name == "amount") {
+                static_assert(std::is_same<decltype(result.Amount), std::int16_t>::value, "");
+                result.Amount = static_cast<std::int16_t>(std::stoi(arguments));
+            }
+        }
+    }
+
+    return result;
+}
 
-    if (byteLength <= 0) {
+std::tuple<std::shared_ptr<SpriteFont>, std::shared_ptr<Error>>
+AssetLoader<SpriteFont>::operator()(AssetManager& assets, const std::string& filePath)
+{
+    auto [binary, openErr] = assets.OpenAssetFile(filePath);
+    if (openErr != nullptr) {
+        auto err = Errors::Wrap(std::move(openErr), "cannot open the file, " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    }
+
+    if (binary.GetSize() == 0) {
         auto err = Errors::New("the font file is too small " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
 
+    // NOTE: Sprite fonts cooked by `tools/cook_data` are read without parsing the text.
+    if (CookedDataReader::HasSignature(binary.GetData(), binary.GetSize(), CookedSpriteFontSignature)) {
+        return ReadCookedSpriteFont(assets, binary, filePath);
+    }
+
     std::vector<BitmapFontPage> pages;
     std::vector<FontGlyph> glyphs;
     glyphs.reserve(127);
+    std::vector<FontKerning> kernings;
 
     BitmapFontInfo info;
     BitmapFontCommon common;
 
+    const std::string_view text{reinterpret_cast<const char*>(binary.GetData()), binary.GetSize()};
+
     std::string line;
-    while (std::getline(stream, line)) {
+    for (std::size_t lineBegin = 0; lineBegin < text.size();) {
+        auto lineEnd = text.find('\n', lineBegin);
+        if (lineEnd == std::string_view::npos) {
+            lineEnd = text.size();
+        }
+        line.assign(text.substr(lineBegin, lineEnd - lineBegin));
+        lineBegin = lineEnd + 1;
+
         if (line.empty()) {
             continue;
         }
@@ -357,56 +613,22 @@ AssetLoader<SpriteFont>::operator()(AssetManager& assets, const std::string& fil
         else if (objectName == "char") {
             glyphs.push_back(ParseGlyph(ss));
         }
-    }
-
-    if (pages.empty()) {
-        auto err = Errors::New("invalid file format " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
-    }
-    POMDOG_ASSERT(!pages.empty());
-
-    auto pageLess = [](const BitmapFontPage& a, const BitmapFontPage& b) {
-        return a.ID < b.ID;
-    };
-
-    std::sort(std::begin(pages), std::end(pages), pageLess);
-    if (std::unique(std::begin(pages), std::end(pages), pageLess) != std::end(pages)) {
-        auto err = Errors::New("invalid file format " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
-    }
-    POMDOG_ASSERT(std::unique(std::begin(pages), std::end(pages), pageLess) == std::end(pages));
-
-    POMDOG_ASSERT(pages.front().ID == 0);
-    POMDOG_ASSERT(pages.back().ID == (pages.size() - 1));
-
-    std::vector<std::shared_ptr<Texture2D>> textures;
-    {
-        auto directoryName = std::get<0>(PathHelper::Split(filePath));
-        for (auto& page : pages) {
-            auto [texture, textureErr] = assets.Load<Texture2D>(PathHelper::Join(directoryName, page.Path));
-            if (textureErr != nullptr) {
-                auto err = Errors::Wrap(std::move(textureErr), "failed to load sprite font texture " + page.Path);
-                return std::make_tuple(nullptr, std::move(err));
+        else if (objectName == "kerning") {
+            auto kerning = ParseKerning(ss);
+            if (kerning.Amount != 0) {
+                kernings.push_back(std::move(kerning));
             }
-            textures.push_back(std::move(texture));
         }
     }
 
-    POMDOG_ASSERT(!glyphs.empty());
-    auto defaultCharacter = glyphs.front().Character;
-
-    for (auto& glyph : glyphs) {
-        glyph.YOffset = glyph.YOffset - common.Base;
-    }
-
-    auto spriteFont = std::make_shared<SpriteFont>(
-        std::move(textures),
+    return CreateSpriteFont(
+        assets,
+        filePath,
+        info,
+        common,
+        std::move(pages),
         std::move(glyphs),
-        static_cast<std::int16_t>(info.PaddingLeft + info.PaddingRight),
-        static_cast<std::int16_t>(common.LineHeight));
-    spriteFont->SetDefaultCharacter(defaultCharacter);
-
-    return std::make_tuple(std::move(spriteFont), nullptr);
+        std::move(kernings));
 }
 
 } // namespace Pomdog::Detail
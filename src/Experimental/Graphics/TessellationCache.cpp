@@ -0,0 +1,101 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "TessellationCache.hpp"
+#include "Pomdog/Math/MathHelper.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace Pomdog::Detail {
+namespace {
+
+template <typename EntryList, typename Func>
+auto FindOrCreate(
+    EntryList& entries,
+    std::size_t capacity,
+    int segments,
+    Func&& tessellate) -> const decltype(entries.front().Points)&
+{
+    using Entry = typename EntryList::value_type;
+    POMDOG_ASSERT(capacity > 0);
+
+    auto iter = std::find_if(std::begin(entries), std::end(entries), [&](const Entry& entry) {
+        return entry.Segments == segments;
+    });
+
+    if (iter != std::end(entries)) {
+        // NOTE: Move the most recently used entry to the front.
+        entries.splice(std::begin(entries), entries, iter);
+        return entries.front().Points;
+    }
+
+    if (entries.size() >= capacity) {
+        // NOTE: Reuse the storage of the least recently used entry.
+        entries.splice(std::begin(entries), entries, std::prev(std::end(entries)));
+    }
+    else {
+        entries.emplace_front();
+    }
+
+    auto& entry = entries.front();
+    entry.Segments = segments;
+    entry.Points.clear();
+    tessellate(entry.Points);
+    return entry.Points;
+}
+
+} // unnamed namespace
+
+TessellationCache::TessellationCache()
+    : TessellationCache(DefaultCapacity)
+{
+}
+
+TessellationCache::TessellationCache(std::size_t capacityIn)
+    : capacity(capacityIn)
+{
+    POMDOG_ASSERT(capacity > 0);
+}
+
+const std::vector<Vector2>& TessellationCache::GetUnitCircle(int segments)
+{
+    POMDOG_ASSERT(segments >= 3);
+
+    return FindOrCreate(circles, capacity, segments, [&](std::vector<Vector2>& points) {
+        const auto centralAngle = Math::TwoPi<float> / segments;
+        points.reserve(segments + 1);
+        points.push_back(Vector2{1.0f, 0.0f});
+        for (int i = 0; i < segments; ++i) {
+            const auto rad = centralAngle * static_cast<float>(i + 1);
+            points.push_back(Vector2{std::cos(rad), std::sin(rad)});
+        }
+    });
+}
+
+const std::vector<Vector3>& TessellationCache::GetUnitSphere(int segments)
+{
+    return FindOrCreate(spheres, capacity, segments, [&](std::vector<Vector3>& points) {
+        const auto rings = std::max(segments, 4);
+        const auto sectors = std::max(segments, 4);
+
+        points.reserve(rings * sectors);
+
+        const auto R = 1.0f / static_cast<float>(rings - 1);
+        const auto S = 1.0f / static_cast<float>(sectors - 1);
+
+        for (int ring = 0; ring < rings; ++ring) {
+            const auto latitude = Math::Pi<float> * ring * R;
+            const auto y = std::cos(latitude);
+            const auto r = std::sin(latitude);
+            for (int s = 0; s < sectors; ++s) {
+                const auto longitude = Math::TwoPi<float> * s * S;
+                const auto x = r * std::cos(longitude);
+                const auto z = r * std::sin(longitude);
+                points.push_back(Vector3{x, y, z});
+            }
+        }
+    });
+}
+
+} // namespace Pomdog::Detail
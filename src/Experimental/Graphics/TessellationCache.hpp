@@ -0,0 +1,42 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Math/Vector2.hpp"
+#include "Pomdog/Math/Vector3.hpp"
+#include <cstddef>
+#include <list>
+#include <vector>
+
+namespace Pomdog::Detail {
+
+/// TessellationCache is an LRU cache of unit shapes keyed by segment count.
+class TessellationCache final {
+public:
+    static constexpr std::size_t DefaultCapacity = 8;
+
+    TessellationCache();
+
+    explicit TessellationCache(std::size_t capacity);
+
+    /// Returns `segments + 1` points on the unit circle, starting at angle zero
+    /// and going counter-clockwise. The last point is equal to the first one.
+    const std::vector<Vector2>& GetUnitCircle(int segments);
+
+    /// Returns `rings * sectors` points on the unit sphere in ring-major order,
+    /// where `rings` and `sectors` are both `max(segments, 4)`.
+    const std::vector<Vector3>& GetUnitSphere(int segments);
+
+private:
+    template <typename T>
+    struct Entry final {
+        int Segments;
+        std::vector<T> Points;
+    };
+
+    std::list<Entry<Vector2>> circles;
+    std::list<Entry<Vector3>> spheres;
+    std::size_t capacity;
+};
+
+} // namespace Pomdog::Detail
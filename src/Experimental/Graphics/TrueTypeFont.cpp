@@ -7,7 +7,9 @@
 #include "Pomdog/Math/Point2D.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 #include "Pomdog/Utility/FileSystem.hpp"
+#include <cmath>
 #include <fstream>
+#include <limits>
 #include <locale>
 #include <utility>
 #include <vector>
@@ -24,15 +26,250 @@
 #endif
 
 namespace Pomdog {
+namespace {
+
+struct GlyphMetrics final {
+    int GlyphIndex;
+    float Scale;
+    int Advance;
+    int X0;
+    int Y0;
+    int X1;
+    int Y1;
+    bool IsSpace;
+};
+
+// NOTE: Reads the big-endian values of the font data. Reads out of range
+// return zero, so that a malformed table is treated as having no kerning.
+[[nodiscard]] std::uint16_t ReadUInt16(const std::vector<std::uint8_t>& data, std::size_t offset) noexcept
+{
+    if ((offset + 2) > data.size()) {
+        return 0;
+    }
+    return static_cast<std::uint16_t>((data[offset] << 8) | data[offset + 1]);
+}
+
+[[nodiscard]] std::int16_t ReadInt16(const std::vector<std::uint8_t>& data, std::size_t offset) noexcept
+{
+    return static_cast<std::int16_t>(ReadUInt16(data, offset));
+}
+
+[[nodiscard]] std::uint32_t ReadUInt32(const std::vector<std::uint8_t>& data, std::size_t offset) noexcept
+{
+    return (static_cast<std::uint32_t>(ReadUInt16(data, offset)) << 16) | ReadUInt16(data, offset + 2);
+}
+
+/// Returns the coverage index of the glyph, or -1 if the coverage table does not contain it.
+[[nodiscard]] int GetCoverageIndex(const std::vector<std::uint8_t>& data, std::size_t coverage, int glyph) noexcept
+{
+    switch (ReadUInt16(data, coverage)) {
+    case 1: {
+        // NOTE: The glyphs are sorted in ascending order.
+        int low = 0;
+        int high = static_cast<int>(ReadUInt16(data, coverage + 2)) - 1;
+        while (low <= high) {
+            const auto middle = (low + high) / 2;
+            const int g = ReadUInt16(data, coverage + 4 + 2 * static_cast<std::size_t>(middle));
+            if (glyph < g) {
+                high = middle - 1;
+            }
+            else if (glyph > g) {
+                low = middle + 1;
+            }
+            else {
+                return middle;
+            }
+        }
+        break;
+    }
+    case 2: {
+        // NOTE: The ranges of (start, end, start coverage index) are sorted by the start glyph.
+        int low = 0;
+        int high = static_cast<int>(ReadUInt16(data, coverage + 2)) - 1;
+        while (low <= high) {
+            const auto middle = (low + high) / 2;
+            const auto range = coverage + 4 + 6 * static_cast<std::size_t>(middle);
+            const int start = ReadUInt16(data, range);
+            const int end = ReadUInt16(data, range + 2);
+            if (glyph < start) {
+                high = middle - 1;
+            }
+            else if (glyph > end) {
+                low = middle + 1;
+            }
+            else {
+                return ReadUInt16(data, range + 4) + glyph - start;
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return -1;
+}
+
+/// Returns the class of the glyph in the class definition table. Glyphs that
+/// are not in the table are in class 0.
+[[nodiscard]] int GetGlyphClass(const std::vector<std::uint8_t>& data, std::size_t classDef, int glyph) noexcept
+{
+    switch (ReadUInt16(data, classDef)) {
+    case 1: {
+        const int startGlyph = ReadUInt16(data, classDef + 2);
+        const int glyphCount = ReadUInt16(data, classDef + 4);
+        if ((glyph >= startGlyph) && (glyph < startGlyph + glyphCount)) {
+            return ReadUInt16(data, classDef + 6 + 2 * static_cast<std::size_t>(glyph - startGlyph));
+        }
+        break;
+    }
+    case 2: {
+        int low = 0;
+        int high = static_cast<int>(ReadUInt16(data, classDef + 2)) - 1;
+        while (low <= high) {
+            const auto middle = (low + high) / 2;
+            const auto range = classDef + 4 + 6 * static_cast<std::size_t>(middle);
+            if (glyph < ReadUInt16(data, range)) {
+                high = middle - 1;
+            }
+            else if (glyph > ReadUInt16(data, range + 2)) {
+                low = middle + 1;
+            }
+            else {
+                return ReadUInt16(data, range + 4);
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return 0;
+}
+
+/// Returns the advance adjustment of the pair in a pair adjustment subtable
+/// of `GPOS`, or std::nullopt if the subtable does not apply to the pair.
+[[nodiscard]] std::optional<int>
+GetPairAdjustment(const std::vector<std::uint8_t>& data, std::size_t subtable, int glyph1, int glyph2) noexcept
+{
+    const auto coverageIndex = GetCoverageIndex(data, subtable + ReadUInt16(data, subtable + 2), glyph1);
+    if (coverageIndex < 0) {
+        return std::nullopt;
+    }
+
+    // NOTE: Like stb_truetype, only the pairs that adjust the advance of the
+    // first glyph (ValueFormat1 = XAdvance, ValueFormat2 = 0) are supported.
+    constexpr std::uint16_t valueFormatXAdvance = 0x0004;
+    if ((ReadUInt16(data, subtable + 4) != valueFormatXAdvance) || (ReadUInt16(data, subtable + 6) != 0)) {
+        return std::nullopt;
+    }
+
+    switch (ReadUInt16(data, subtable)) {
+    case 1: {
+        if (coverageIndex >= ReadUInt16(data, subtable + 8)) {
+            return std::nullopt;
+        }
+        const auto pairSet = subtable + ReadUInt16(data, subtable + 10 + 2 * static_cast<std::size_t>(coverageIndex));
+
+        // NOTE: The records of (second glyph, x advance) are sorted by the second glyph.
+        int low = 0;
+        int high = static_cast<int>(ReadUInt16(data, pairSet)) - 1;
+        while (low <= high) {
+            const auto middle = (low + high) / 2;
+            const auto record = pairSet + 2 + 4 * static_cast<std::size_t>(middle);
+            const int g = ReadUInt16(data, record);
+            if (glyph2 < g) {
+                high = middle - 1;
+            }
+            else if (glyph2 > g) {
+                low = middle + 1;
+            }
+            else {
+                return ReadInt16(data, record + 2);
+            }
+        }
+        return std::nullopt;
+    }
+    case 2: {
+        const auto class1 = GetGlyphClass(data, subtable + ReadUInt16(data, subtable + 8), glyph1);
+        const auto class2 = GetGlyphClass(data, subtable + ReadUInt16(data, subtable + 10), glyph2);
+        const int class1Count = ReadUInt16(data, subtable + 12);
+        const int class2Count = ReadUInt16(data, subtable + 14);
+        if ((class1 >= class1Count) || (class2 >= class2Count)) {
+            return std::nullopt;
+        }
+        return ReadInt16(data, subtable + 16 + 2 * static_cast<std::size_t>(class1 * class2Count + class2));
+    }
+    default:
+        break;
+    }
+    return std::nullopt;
+}
+
+/// Returns the offsets of the pair adjustment subtables of `GPOS` that are
+/// stored in extension lookups.
+[[nodiscard]] std::vector<std::size_t>
+FindExtensionPairAdjustments(const std::vector<std::uint8_t>& data, std::size_t gpos)
+{
+    constexpr std::uint16_t lookupTypePairAdjustment = 2;
+    constexpr std::uint16_t lookupTypeExtension = 9;
+
+    std::vector<std::size_t> subtables;
+    if (ReadUInt16(data, gpos) != 1) {
+        return subtables;
+    }
+
+    const auto lookupList = gpos + ReadUInt16(data, gpos + 8);
+    const auto lookupCount = ReadUInt16(data, lookupList);
+    for (std::size_t i = 0; i < lookupCount; ++i) {
+        const auto lookup = lookupList + ReadUInt16(data, lookupList + 2 + 2 * i);
+        if (ReadUInt16(data, lookup) != lookupTypeExtension) {
+            continue;
+        }
+
+        const auto subtableCount = ReadUInt16(data, lookup + 4);
+        for (std::size_t k = 0; k < subtableCount; ++k) {
+            const auto extension = lookup + ReadUInt16(data, lookup + 6 + 2 * k);
+            if ((ReadUInt16(data, extension) == 1) && (ReadUInt16(data, extension + 2) == lookupTypePairAdjustment)) {
+                subtables.push_back(extension + ReadUInt32(data, extension + 4));
+            }
+        }
+    }
+    return subtables;
+}
+
+FontGlyph CreateFontGlyph(const GlyphMetrics& metrics, char32_t codePoint, const Point2D& point)
+{
+    POMDOG_ASSERT(static_cast<int>(metrics.Scale * metrics.Advance) <= static_cast<int>(std::numeric_limits<std::int16_t>::max()));
+
+    FontGlyph glyph;
+    glyph.Subrect.X = point.X;
+    glyph.Subrect.Y = point.Y;
+    glyph.Subrect.Width = metrics.X1 - metrics.X0;
+    glyph.Subrect.Height = metrics.Y1 - metrics.Y0;
+    glyph.TexturePage = 0;
+    glyph.XAdvance = static_cast<std::int16_t>(metrics.Scale * metrics.Advance);
+    glyph.XOffset = static_cast<std::int16_t>(metrics.X0);
+    glyph.YOffset = static_cast<std::int16_t>(metrics.Y0);
+    glyph.Character = codePoint;
+    return glyph;
+}
+
+} // unnamed namespace
 
 class TrueTypeFont::Impl final {
 public:
     std::vector<std::uint8_t> ttfBinary;
     stbtt_fontinfo fontInfo;
 
+    // NOTE: stb_truetype reads the pair adjustments of `GPOS` but does not
+    // follow extension lookups, in which fonts such as Noto Sans store them.
+    std::vector<std::size_t> extensionPairAdjustments;
+
     void Reset();
 
     [[nodiscard]] std::shared_ptr<Error> LoadFont(const std::string& filePath);
+
+    std::optional<GlyphMetrics> GetGlyphMetrics(char32_t codePoint, float pixelHeight) const;
 };
 
 void TrueTypeFont::Impl::Reset()
@@ -40,6 +277,7 @@ void TrueTypeFont::Impl::Reset()
     if (!ttfBinary.empty()) {
         ttfBinary.clear();
     }
+    extensionPairAdjustments.clear();
 }
 
 std::shared_ptr<Error>
@@ -74,9 +312,43 @@ TrueTypeFont::Impl::LoadFont(const std::string& filePath)
         return Errors::Wrap(std::move(sizeErr), "failed to initialize truetype font " + filePath);
     }
 
+    if (fontInfo.gpos != 0) {
+        extensionPairAdjustments = FindExtensionPairAdjustments(ttfBinary, static_cast<std::size_t>(fontInfo.gpos));
+    }
+
     return nullptr;
 }
 
+std::optional<GlyphMetrics>
+TrueTypeFont::Impl::GetGlyphMetrics(char32_t codePoint, float pixelHeight) const
+{
+    if (ttfBinary.empty()) {
+        // error
+        return std::nullopt;
+    }
+
+    const auto& f = fontInfo;
+
+    GlyphMetrics metrics;
+    metrics.Scale = stbtt_ScaleForPixelHeight(&f, pixelHeight);
+    metrics.GlyphIndex = stbtt_FindGlyphIndex(&f, codePoint);
+
+    // FIXME: Use `UnicodeData.txt`-generated character table instead of std::locale and std::isspace.
+    std::locale defaultLocale;
+    metrics.IsSpace = (std::isspace(static_cast<char>(codePoint), defaultLocale) != 0) && (codePoint != '\n');
+
+    if (metrics.GlyphIndex <= 0 && !metrics.IsSpace) {
+        // error: not found
+        return std::nullopt;
+    }
+
+    int lsb = 0;
+    stbtt_GetGlyphHMetrics(&f, metrics.GlyphIndex, &metrics.Advance, &lsb);
+    stbtt_GetGlyphBitmapBox(&f, metrics.GlyphIndex, metrics.Scale, metrics.Scale,
+        &metrics.X0, &metrics.Y0, &metrics.X1, &metrics.Y1);
+    return metrics;
+}
+
 TrueTypeFont::TrueTypeFont()
     : impl(std::make_unique<Impl>())
 {
@@ -100,31 +372,15 @@ std::optional<FontGlyph> TrueTypeFont::RasterizeGlyph(
     int textureWidth,
     const std::function<void(int width, int height, Point2D& point, std::uint8_t*& output)>& callback)
 {
-    if (impl->ttfBinary.empty()) {
-        // error
+    POMDOG_ASSERT(impl);
+    auto metrics = impl->GetGlyphMetrics(codePoint, pixelHeight);
+    if (!metrics) {
         return std::nullopt;
     }
 
     const auto& f = impl->fontInfo;
-
-    const float scale = stbtt_ScaleForPixelHeight(&f, pixelHeight);
-
-    const int g = stbtt_FindGlyphIndex(&f, codePoint);
-
-    // FIXME: Use `UnicodeData.txt`-generated character table instead of std::locale and std::isspace.
-    std::locale defaultLocale;
-    const bool isSpace = (std::isspace(static_cast<char>(codePoint), defaultLocale) != 0) && (codePoint != '\n');
-
-    if (g <= 0 && !isSpace) {
-        // error: not found
-        return std::nullopt;
-    }
-
-    int advance, lsb, x0, y0, x1, y1;
-    stbtt_GetGlyphHMetrics(&f, g, &advance, &lsb);
-    stbtt_GetGlyphBitmapBox(&f, g, scale, scale, &x0, &y0, &x1, &y1);
-    const int glyphWidth = x1 - x0;
-    const int glyphHeight = y1 - y0;
+    const int glyphWidth = metrics->X1 - metrics->X0;
+    const int glyphHeight = metrics->Y1 - metrics->Y0;
 
     std::uint8_t* pixels = nullptr;
     Point2D point = {1, 1};
@@ -137,24 +393,139 @@ std::optional<FontGlyph> TrueTypeFont::RasterizeGlyph(
     POMDOG_ASSERT(point.Y >= 0);
     POMDOG_ASSERT(textureWidth > 0);
 
-    if (!isSpace) {
+    if (!metrics->IsSpace) {
         stbtt_MakeGlyphBitmap(&f, pixels + point.X + point.Y * textureWidth,
-            glyphWidth, glyphHeight, textureWidth, scale, scale, g);
+            glyphWidth, glyphHeight, textureWidth, metrics->Scale, metrics->Scale, metrics->GlyphIndex);
     }
 
-    POMDOG_ASSERT(static_cast<int>(scale * advance) <= static_cast<int>(std::numeric_limits<std::int16_t>::max()));
+    return CreateFontGlyph(*metrics, codePoint, point);
+}
 
-    FontGlyph glyph;
-    glyph.Subrect.X = point.X;
-    glyph.Subrect.Y = point.Y;
-    glyph.Subrect.Width = glyphWidth;
-    glyph.Subrect.Height = glyphHeight;
-    glyph.TexturePage = 0;
-    glyph.XAdvance = static_cast<std::int16_t>(scale * advance);
-    glyph.XOffset = static_cast<std::int16_t>(x0);
-    glyph.YOffset = static_cast<std::int16_t>(y0);
-    glyph.Character = codePoint;
-    return std::move(glyph);
+std::optional<FontGlyph> TrueTypeFont::RasterizeGlyph(
+    char32_t codePoint,
+    float pixelHeight,
+    std::vector<std::uint8_t>& pixels) const
+{
+    POMDOG_ASSERT(impl);
+    auto metrics = impl->GetGlyphMetrics(codePoint, pixelHeight);
+    if (!metrics) {
+        return std::nullopt;
+    }
+
+    const auto& f = impl->fontInfo;
+    const int glyphWidth = metrics->X1 - metrics->X0;
+    const int glyphHeight = metrics->Y1 - metrics->Y0;
+
+    pixels.clear();
+
+    if (!metrics->IsSpace && (glyphWidth > 0) && (glyphHeight > 0)) {
+        pixels.resize(static_cast<std::size_t>(glyphWidth) * static_cast<std::size_t>(glyphHeight), 0);
+
+        // NOTE: stbtt_MakeGlyphBitmap only reads the font data, so this is
+        // safe to call from multiple threads.
+        stbtt_MakeGlyphBitmap(&f, pixels.data(),
+            glyphWidth, glyphHeight, glyphWidth, metrics->Scale, metrics->Scale, metrics->GlyphIndex);
+    }
+
+    return CreateFontGlyph(*metrics, codePoint, Point2D{0, 0});
+}
+
+std::optional<FontGlyph> TrueTypeFont::RasterizeGlyphSDF(
+    char32_t codePoint,
+    float pixelHeight,
+    int padding,
+    std::vector<std::uint8_t>& pixels) const
+{
+    POMDOG_ASSERT(impl);
+    POMDOG_ASSERT(padding > 0);
+
+    auto metrics = impl->GetGlyphMetrics(codePoint, pixelHeight);
+    if (!metrics) {
+        return std::nullopt;
+    }
+
+    const auto& f = impl->fontInfo;
+
+    pixels.clear();
+
+    auto glyph = CreateFontGlyph(*metrics, codePoint, Point2D{0, 0});
+
+    if (metrics->IsSpace) {
+        glyph.Subrect.Width = 0;
+        glyph.Subrect.Height = 0;
+        return glyph;
+    }
+
+    constexpr unsigned char onEdgeValue = 128;
+    const float pixelDistanceScale = static_cast<float>(onEdgeValue) / static_cast<float>(padding);
+
+    int width = 0;
+    int height = 0;
+    int offsetX = 0;
+    int offsetY = 0;
+
+    // NOTE: stbtt_GetGlyphSDF returns nullptr for glyphs without an outline.
+    auto sdf = stbtt_GetGlyphSDF(&f, metrics->Scale, metrics->GlyphIndex,
+        padding, onEdgeValue, pixelDistanceScale, &width, &height, &offsetX, &offsetY);
+
+    if (sdf == nullptr) {
+        glyph.Subrect.Width = 0;
+        glyph.Subrect.Height = 0;
+        return glyph;
+    }
+
+    pixels.assign(sdf, sdf + static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+    stbtt_FreeSDF(sdf, f.userdata);
+
+    glyph.Subrect.Width = width;
+    glyph.Subrect.Height = height;
+    glyph.XOffset = static_cast<std::int16_t>(offsetX);
+    glyph.YOffset = static_cast<std::int16_t>(offsetY);
+    return glyph;
+}
+
+bool TrueTypeFont::HasKerning() const noexcept
+{
+    POMDOG_ASSERT(impl);
+    if (impl->ttfBinary.empty()) {
+        return false;
+    }
+    return (impl->fontInfo.kern != 0) || (impl->fontInfo.gpos != 0);
+}
+
+std::int16_t TrueTypeFont::GetKerning(char32_t first, char32_t second, float pixelHeight) const
+{
+    POMDOG_ASSERT(impl);
+
+    if (impl->ttfBinary.empty()) {
+        return 0;
+    }
+
+    const auto& f = impl->fontInfo;
+    const auto glyph1 = stbtt_FindGlyphIndex(&f, static_cast<int>(first));
+    const auto glyph2 = stbtt_FindGlyphIndex(&f, static_cast<int>(second));
+    if ((glyph1 <= 0) || (glyph2 <= 0)) {
+        return 0;
+    }
+
+    // NOTE: stbtt_GetGlyphKernAdvance reads the `kern` table or the pair
+    // adjustments of `GPOS` that are not in extension lookups.
+    int advance = stbtt_GetGlyphKernAdvance(&f, glyph1, glyph2);
+    if (advance == 0) {
+        for (auto subtable : impl->extensionPairAdjustments) {
+            if (auto adjustment = GetPairAdjustment(impl->ttfBinary, subtable, glyph1, glyph2); adjustment) {
+                advance = *adjustment;
+                break;
+            }
+        }
+    }
+
+    if (advance == 0) {
+        return 0;
+    }
+
+    const float scale = stbtt_ScaleForPixelHeight(&f, pixelHeight);
+    return static_cast<std::int16_t>(std::lround(scale * static_cast<float>(advance)));
 }
 
 //int TrueTypeFont::GetBaseline(float fontSize) const
@@ -1,7 +1,10 @@
 // Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
 
 #include "Pomdog/Experimental/Image/Image.hpp"
+#include "Pomdog/Content/Image/ImageBuffer.hpp"
+#include "Pomdog/Content/Image/PixelConversion.hpp"
 #include "Pomdog/Utility/Assert.hpp"
+#include <cstdint>
 #include <cstring>
 #include <utility>
 
@@ -62,6 +65,39 @@ void Image::SetData(std::vector<Color>&& pixelData)
     data = std::move(pixelData);
 }
 
+std::shared_ptr<Error> Image::SetData(const ImageBuffer& imageBuffer)
+{
+    if ((imageBuffer.Width != width) || (imageBuffer.Height != height)) {
+        return Errors::New("the size of the image buffer does not match the image");
+    }
+
+    static_assert(sizeof(Color) == 4, "Color must be tightly packed as R8G8B8A8.");
+    const auto pixelCount = data.size();
+    auto pixels = reinterpret_cast<std::uint8_t*>(data.data());
+
+    switch (imageBuffer.Format) {
+    case SurfaceFormat::R8G8B8A8_UNorm:
+    case SurfaceFormat::B8G8R8A8_UNorm:
+        if ((imageBuffer.PixelData == nullptr) || (imageBuffer.ByteLength < pixelCount * 4)) {
+            return Errors::New("the pixel data of the image buffer is too small");
+        }
+        std::memcpy(pixels, imageBuffer.PixelData, pixelCount * 4);
+        if (imageBuffer.Format == SurfaceFormat::B8G8R8A8_UNorm) {
+            PixelConversion::SwapRedBlue(pixels, pixelCount);
+        }
+        return nullptr;
+    case SurfaceFormat::A8_UNorm:
+        if ((imageBuffer.PixelData == nullptr) || (imageBuffer.ByteLength < pixelCount)) {
+            return Errors::New("the pixel data of the image buffer is too small");
+        }
+        PixelConversion::ConvertA8ToR8G8B8A8(imageBuffer.PixelData, pixels, pixelCount);
+        return nullptr;
+    default:
+        break;
+    }
+    return Errors::New("the format of the image buffer is not supported");
+}
+
 const Color& Image::GetPixel(int x, int y) const
 {
     POMDOG_ASSERT(width > 0);
@@ -97,11 +133,8 @@ void Image::Fill(const Color& color)
 
 void Image::PremultiplyAlpha()
 {
-    for (auto& pixel : data) {
-        const auto alpha = pixel.A;
-        pixel = Color::Multiply(pixel, static_cast<float>(alpha) / 255.0f);
-        pixel.A = alpha;
-    }
+    static_assert(sizeof(Color) == 4, "Color must be tightly packed as R8G8B8A8.");
+    PixelConversion::PremultiplyAlpha(reinterpret_cast<std::uint8_t*>(data.data()), data.size());
 }
 
 } // namespace Pomdog
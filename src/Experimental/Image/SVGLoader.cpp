@@ -2,6 +2,7 @@
 
 #include "Pomdog/Experimental/Image/SVGLoader.hpp"
 #include "../../Utility/ScopeGuard.hpp"
+#include "Pomdog/Content/AssetManager.hpp"
 #include "Pomdog/Graphics/Texture2D.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 #include "Pomdog/Utility/FileSystem.hpp"
@@ -148,6 +149,25 @@ DecodeFile(
     return DecodeSVG(binary.data(), binary.size(), width, height);
 }
 
+std::vector<std::tuple<ImageBuffer, std::shared_ptr<Error>>>
+DecodeFiles(
+    AssetManager& assets,
+    const std::vector<std::string>& filePaths,
+    int width,
+    int height)
+{
+    POMDOG_ASSERT(width > 0);
+    POMDOG_ASSERT(height > 0);
+
+    std::vector<std::tuple<ImageBuffer, std::shared_ptr<Error>>> results(filePaths.size());
+
+    assets.ParallelFor(filePaths.size(), [&](std::size_t index) {
+        results[index] = DecodeFile(filePaths[index], width, height);
+    });
+
+    return results;
+}
+
 std::tuple<std::shared_ptr<Texture2D>, std::shared_ptr<Error>>
 LoadTexture(
     const std::shared_ptr<GraphicsDevice>& graphicsDevice,
@@ -7,9 +7,8 @@
 #include "Pomdog/Content/Utility/MakeFourCC.hpp"
 #include "Pomdog/Experimental/MagicaVoxel/VoxModel.hpp"
 #include "Pomdog/Utility/Assert.hpp"
-#include "Pomdog/Utility/FileSystem.hpp"
 #include <algorithm>
-#include <fstream>
+#include <cstring>
 #include <utility>
 
 namespace Pomdog::Detail {
@@ -19,19 +18,18 @@ using Detail::BinaryReader;
 using Detail::MakeFourCC;
 using MagicaVoxel::VoxChunkHeader;
 
-std::ifstream::pos_type ChunkSize(std::ifstream& stream, const VoxChunkHeader& chunk)
+std::size_t ChunkSize(std::size_t offset, const VoxChunkHeader& chunk)
 {
     POMDOG_ASSERT(chunk.ContentSize >= 0);
     POMDOG_ASSERT(chunk.ChildrenSize >= 0);
-    POMDOG_ASSERT(stream.tellg() >= 0);
 
-    return stream.tellg() + static_cast<std::ifstream::pos_type>(chunk.ContentSize + chunk.ChildrenSize);
+    return offset + static_cast<std::size_t>(chunk.ContentSize) + static_cast<std::size_t>(chunk.ChildrenSize);
 }
 
 } // unnamed namespace
 
 std::tuple<std::shared_ptr<MagicaVoxel::VoxModel>, std::shared_ptr<Error>>
-AssetLoader<MagicaVoxel::VoxModel>::operator()([[maybe_unused]] AssetManager& assets, const std::string& filePath)
+AssetLoader<MagicaVoxel::VoxModel>::operator()(AssetManager& assets, const std::string& filePath)
 {
     constexpr std::int32_t MagicaVoxelVersion = 150;
     constexpr auto fourCC = MakeFourCC('V', 'O', 'X', ' ');
@@ -40,80 +38,119 @@ AssetLoader<MagicaVoxel::VoxModel>::operator()([[maybe_unused]] AssetManager& as
     constexpr auto IdXYZI = MakeFourCC('X', 'Y', 'Z', 'I');
     constexpr auto IdRGBA = MakeFourCC('R', 'G', 'B', 'A');
 
-    std::ifstream stream{filePath, std::ifstream::binary};
-
-    if (!stream) {
-        auto err = Errors::New("cannot open the file, " + filePath);
+    auto [binary, openErr] = assets.OpenAssetFile(filePath);
+    if (openErr != nullptr) {
+        auto err = Errors::Wrap(std::move(openErr), "cannot open the file, " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    auto [byteLength, sizeErr] = FileSystem::GetFileSize(filePath);
-    if (sizeErr != nullptr) {
-        auto err = Errors::Wrap(std::move(sizeErr), "failed to get file size, " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
-    }
+    const auto data = binary.GetData();
+    const auto byteLength = binary.GetSize();
+    std::size_t offset = 0;
 
-    POMDOG_ASSERT(stream);
+    // NOTE: Returns true if `sizeInBytes` bytes remain from the current offset.
+    auto canRead = [&](auto sizeInBytes) -> bool {
+        return (offset <= byteLength) && (sizeInBytes <= byteLength - offset);
+    };
+
+    auto invalidFormat = [&] {
+        auto err = Errors::New("invalid VOX format " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    };
 
-    if (byteLength <= 0) {
+    if (!canRead(sizeof(std::uint32_t) + sizeof(std::int32_t) + sizeof(VoxChunkHeader))) {
         auto err = Errors::New("the font file is too small " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    if (fourCC != BinaryReader::Read<std::uint32_t>(stream)) {
-        auto err = Errors::New("invalid VOX format " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
+    if (fourCC != BinaryReader::Read<std::uint32_t>(data + offset)) {
+        return invalidFormat();
     }
+    offset += sizeof(std::uint32_t);
 
-    if (MagicaVoxelVersion != BinaryReader::Read<std::int32_t>(stream)) {
+    if (MagicaVoxelVersion != BinaryReader::Read<std::int32_t>(data + offset)) {
         auto err = Errors::New("version does not much " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
+    offset += sizeof(std::int32_t);
 
-    const auto mainChunk = BinaryReader::Read<VoxChunkHeader>(stream);
+    const auto mainChunk = BinaryReader::Read<VoxChunkHeader>(data + offset);
+    offset += sizeof(VoxChunkHeader);
 
     if (mainChunk.ID != IdMain) {
         auto err = Errors::New("cannot find main chunk " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
+    if ((mainChunk.ContentSize < 0) || (mainChunk.ChildrenSize < 0)) {
+        return invalidFormat();
+    }
 
-    const auto mainChunkEnd = ChunkSize(stream, mainChunk);
+    const auto mainChunkEnd = std::min(ChunkSize(offset, mainChunk), byteLength);
 
-    stream.seekg(mainChunk.ContentSize, std::ios::cur);
+    offset += mainChunk.ContentSize;
 
     auto model = std::make_shared<MagicaVoxel::VoxModel>();
 
-    while (stream.tellg() < mainChunkEnd) {
-        const auto chunk = BinaryReader::Read<VoxChunkHeader>(stream);
-        const auto chunkEnd = ChunkSize(stream, chunk);
+    while (offset < mainChunkEnd) {
+        if (!canRead(sizeof(VoxChunkHeader))) {
+            return invalidFormat();
+        }
+
+        const auto chunk = BinaryReader::Read<VoxChunkHeader>(data + offset);
+        offset += sizeof(VoxChunkHeader);
+
+        if ((chunk.ContentSize < 0) || (chunk.ChildrenSize < 0)) {
+            return invalidFormat();
+        }
+
+        const auto chunkEnd = ChunkSize(offset, chunk);
 
         if (chunk.ID == IdSize) {
-            model->X = BinaryReader::Read<std::int32_t>(stream);
-            model->Y = BinaryReader::Read<std::int32_t>(stream);
-            model->Z = BinaryReader::Read<std::int32_t>(stream);
+            if (!canRead(sizeof(std::int32_t) * 3)) {
+                return invalidFormat();
+            }
+
+            model->X = BinaryReader::Read<std::int32_t>(data + offset);
+            model->Y = BinaryReader::Read<std::int32_t>(data + offset + sizeof(std::int32_t));
+            model->Z = BinaryReader::Read<std::int32_t>(data + offset + sizeof(std::int32_t) * 2);
 
             POMDOG_ASSERT(model->X >= 0);
             POMDOG_ASSERT(model->Y >= 0);
             POMDOG_ASSERT(model->Z >= 0);
 
             if (model->X < 0 || model->Y < 0 || model->Z < 0) {
-                auto err = Errors::New("invalid VOX format " + filePath);
-                return std::make_tuple(nullptr, std::move(err));
+                return invalidFormat();
             }
         }
         else if (chunk.ID == IdXYZI) {
-            const auto voxelCount = BinaryReader::Read<std::int32_t>(stream);
+            if (!canRead(sizeof(std::int32_t))) {
+                return invalidFormat();
+            }
+
+            const auto voxelCount = BinaryReader::Read<std::int32_t>(data + offset);
             if (voxelCount < 0) {
                 auto err = Errors::New("negative number of voxels " + filePath);
                 return std::make_tuple(nullptr, std::move(err));
             }
 
             if (voxelCount > 0) {
-                model->Voxels = BinaryReader::ReadArray<MagicaVoxel::Voxel>(stream, voxelCount);
+                const auto voxelOffset = offset + sizeof(std::int32_t);
+                const auto voxelBytes = sizeof(MagicaVoxel::Voxel) * static_cast<std::size_t>(voxelCount);
+                if ((voxelOffset > byteLength) || (voxelBytes > byteLength - voxelOffset)) {
+                    return invalidFormat();
+                }
+
+                // NOTE: The voxels are copied from the mapped file at once.
+                model->Voxels.resize(voxelCount);
+                std::memcpy(model->Voxels.data(), data + voxelOffset, voxelBytes);
             }
         }
         else if (chunk.ID == IdRGBA) {
-            model->ColorPalette = BinaryReader::Read<decltype(model->ColorPalette)>(stream);
+            if (!canRead(sizeof(model->ColorPalette))) {
+                return invalidFormat();
+            }
+
+            model->ColorPalette = BinaryReader::Read<decltype(model->ColorPalette)>(data + offset);
 
             model->ColorPalette.back() = Color::Black;
 
@@ -124,7 +161,7 @@ AssetLoader<MagicaVoxel::VoxModel>::operator()([[maybe_unused]] AssetManager& as
                 std::end(model->ColorPalette));
         }
 
-        stream.seekg(chunkEnd, std::ios::beg);
+        offset = chunkEnd;
     }
 
     return std::make_tuple(std::move(model), nullptr);
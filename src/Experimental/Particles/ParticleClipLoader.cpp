@@ -1,7 +1,9 @@
 // Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
 
 #include "Pomdog/Experimental/Particles/ParticleClipLoader.hpp"
-#include "Pomdog/Content/Utility/BinaryReader.hpp"
+#include "Pomdog/Content/AssetManager.hpp"
+#include "Pomdog/Content/Utility/CookedData.hpp"
+#include "Pomdog/Content/Utility/MakeFourCC.hpp"
 #include "Pomdog/Experimental/Particles/EmitterShapes/ParticleEmitterShapeBox.hpp"
 #include "Pomdog/Experimental/Particles/EmitterShapes/ParticleEmitterShapeCone.hpp"
 #include "Pomdog/Experimental/Particles/EmitterShapes/ParticleEmitterShapeHemisphere.hpp"
@@ -13,10 +15,8 @@
 #include "Pomdog/Experimental/Particles/Parameters/ParticleParameterRandomCurves.hpp"
 #include "Pomdog/Experimental/Particles/ParticleClip.hpp"
 #include "Pomdog/Utility/Assert.hpp"
-#include "Pomdog/Utility/FileSystem.hpp"
 #include "Pomdog/Utility/StringHelper.hpp"
 #include <rapidjson/document.h>
-#include <fstream>
 #include <utility>
 #include <vector>
 
@@ -164,6 +164,24 @@ ParseMember(const rapidjson::Value& value, const char* name, Duration& result)
     return err;
 }
 
+std::shared_ptr<Error>
+ValidateParticleClip(const ParticleClip& clip)
+{
+    if ((clip.MaxParticles <= 0) || (clip.MaxParticles > 4096)) {
+        return Errors::New("invalid range, MaxParticles");
+    }
+    if (clip.StartLifetime <= 0) {
+        return Errors::New("StartLifetime should be > 0");
+    }
+    if (clip.EmissionRate <= 0) {
+        return Errors::New("EmissionRate should be > 0");
+    }
+    if (clip.EmissionRateOverTime <= 0) {
+        return Errors::New("EmissionRateOverTime should be > 0");
+    }
+    return nullptr;
+}
+
 std::tuple<std::shared_ptr<ParticleClip>, std::shared_ptr<Error>>
 ReadParticleClip(const rapidjson::Value& object)
 {
@@ -195,20 +213,7 @@ ReadParticleClip(const rapidjson::Value& object)
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    if ((clip.MaxParticles <= 0) || (clip.MaxParticles > 4096)) {
-        auto err = Errors::New("invalid range, MaxParticles");
-        return std::make_tuple(nullptr, std::move(err));
-    }
-    if (clip.StartLifetime <= 0) {
-        auto err = Errors::New("StartLifetime should be > 0");
-        return std::make_tuple(nullptr, std::move(err));
-    }
-    if (clip.EmissionRate <= 0) {
-        auto err = Errors::New("EmissionRate should be > 0");
-        return std::make_tuple(nullptr, std::move(err));
-    }
-    if (clip.EmissionRateOverTime <= 0) {
-        auto err = Errors::New("EmissionRateOverTime should be > 0");
+    if (auto err = ValidateParticleClip(clip); err != nullptr) {
         return std::make_tuple(nullptr, std::move(err));
     }
 
@@ -385,45 +390,289 @@ ReadParticleClip(const rapidjson::Value& object)
     return std::make_tuple(std::move(particleClip), nullptr);
 }
 
-} // unnamed namespace
+// NOTE: The layout of a cooked particle clip must be kept in sync with
+// `tools/cook_data/particle.go`. Angles are stored in degrees as in the JSON.
+constexpr std::uint32_t CookedParticleClipSignature = MakeFourCC('P', 'C', 'L', 'P');
+constexpr std::uint32_t CookedParticleClipVersion = 1;
+
+struct CookedParticleClipSection final {
+    enum : std::uint32_t {
+        Strings,
+        Clips,
+        FloatKeys,
+        ColorKeys,
+        SectionCount,
+    };
+};
+
+enum class CookedEmitterShape : std::uint32_t {
+    Box,
+    Cone,
+    Hemisphere,
+    Sector,
+    Sphere,
+};
+
+enum class CookedParameterType : std::uint32_t {
+    Constant,
+    Random,
+    Curve,
+};
+
+struct CookedFloatParameter final {
+    CookedParameterType Type;
+
+    /// The value of a constant parameter, or the minimum of a random parameter.
+    float Min;
+    float Max;
+    CookedSpan Keys;
+};
+
+struct CookedColorParameter final {
+    CookedParameterType Type;
+    std::uint8_t Min[4];
+    std::uint8_t Max[4];
+    CookedSpan Keys;
+};
+
+struct CookedFloatKey final {
+    float Time;
+    float Value;
+};
+
+struct CookedColorKey final {
+    float Time;
+    std::uint8_t Value[4];
+};
+
+struct CookedParticleClip final {
+    double Duration;
+    std::int32_t EmissionRate;
+    std::int32_t EmissionRateOverTime;
+    std::int32_t MaxParticles;
+    float StartLifetime;
+    float StartDelay;
+    float GravityModifier;
+    std::uint32_t Looping;
+    CookedEmitterShape ShapeType;
+
+    /// The width, height and depth of a box, the radius and height of a cone,
+    /// the central angle of a sector or the radius of the other shapes.
+    float Shape[3];
+    CookedFloatParameter StartSpeed;
+    CookedFloatParameter StartRotation;
+    CookedFloatParameter RotationOverLifetime;
+    CookedFloatParameter StartSize;
+    CookedFloatParameter SizeOverLifetime;
+    CookedColorParameter StartColor;
+    CookedColorParameter ColorOverLifetime;
+};
+
+static_assert(sizeof(CookedFloatParameter) == 20);
+static_assert(sizeof(CookedColorParameter) == 20);
+static_assert(sizeof(CookedFloatKey) == 8);
+static_assert(sizeof(CookedColorKey) == 8);
+static_assert(sizeof(CookedParticleClip) == 192);
+
+Color ToColor(const std::uint8_t (&rgba)[4])
+{
+    return Color{rgba[0], rgba[1], rgba[2], rgba[3]};
+}
 
-std::tuple<std::shared_ptr<ParticleClip>, std::shared_ptr<Error>>
-AssetLoader<ParticleClip>::operator()(
-    [[maybe_unused]] AssetManager& assets, const std::string& filePath)
+/// Returns true if the keys satisfy the requirements of ParticleParameterCurve:
+/// at least one key, and the times are sorted and in [0, 1].
+template <typename T>
+bool IsValidCurve(const std::vector<ParticleCurveKey<T>>& points)
 {
-    using Detail::BinaryReader;
+    if (points.empty()) {
+        return false;
+    }
 
-    std::ifstream stream{filePath, std::ifstream::binary};
+    float prevTime = 0.0f;
+    for (const auto& point : points) {
+        // NOTE: This also rejects NaN.
+        if (!((point.TimeSeconds >= prevTime) && (point.TimeSeconds <= 1.0f))) {
+            return false;
+        }
+        prevTime = point.TimeSeconds;
+    }
+    return true;
+}
 
-    if (!stream) {
-        auto err = Errors::New("cannot open the file, " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
+template <typename T, typename Convert>
+std::unique_ptr<Detail::Particles::ParticleParameter<T>>
+ReadCookedParameter(
+    CookedDataReader& reader,
+    const CookedFloatParameter& parameter,
+    const CookedArray<CookedFloatKey>& keys,
+    Convert convert)
+{
+    switch (parameter.Type) {
+    case CookedParameterType::Constant:
+        return std::make_unique<ParticleParameterConstant<T>>(convert(parameter.Min));
+    case CookedParameterType::Random:
+        return std::make_unique<ParticleParameterRandom<T>>(convert(parameter.Min), convert(parameter.Max));
+    case CookedParameterType::Curve: {
+        std::vector<ParticleCurveKey<T>> points;
+        for (const auto& key : reader.Slice(keys, parameter.Keys)) {
+            ParticleCurveKey<T> point;
+            point.TimeSeconds = key.Time;
+            point.Value = convert(key.Value);
+            points.push_back(std::move(point));
+        }
+        if (!IsValidCurve(points)) {
+            return nullptr;
+        }
+        return std::make_unique<ParticleParameterCurve<T>>(std::move(points));
+    }
+    }
+    return nullptr;
+}
+
+std::unique_ptr<Detail::Particles::ParticleParameter<Color>>
+ReadCookedParameter(
+    CookedDataReader& reader,
+    const CookedColorParameter& parameter,
+    const CookedArray<CookedColorKey>& keys)
+{
+    switch (parameter.Type) {
+    case CookedParameterType::Constant:
+        return std::make_unique<ParticleParameterConstant<Color>>(ToColor(parameter.Min));
+    case CookedParameterType::Random:
+        return std::make_unique<ParticleParameterRandom<Color>>(ToColor(parameter.Min), ToColor(parameter.Max));
+    case CookedParameterType::Curve: {
+        std::vector<ParticleCurveKey<Color>> points;
+        for (const auto& key : reader.Slice(keys, parameter.Keys)) {
+            ParticleCurveKey<Color> point;
+            point.TimeSeconds = key.Time;
+            point.Value = ToColor(key.Value);
+            points.push_back(std::move(point));
+        }
+        if (!IsValidCurve(points)) {
+            return nullptr;
+        }
+        return std::make_unique<ParticleParameterCurve<Color>>(std::move(points));
+    }
     }
+    return nullptr;
+}
 
-    auto [byteLength, sizeErr] = FileSystem::GetFileSize(filePath);
-    if (sizeErr != nullptr) {
-        auto err = Errors::Wrap(std::move(sizeErr), "failed to get file size, " + filePath);
+std::unique_ptr<Particles::ParticleEmitterShape>
+ReadCookedShape(const CookedParticleClip& source)
+{
+    switch (source.ShapeType) {
+    case CookedEmitterShape::Box:
+        return std::make_unique<ParticleEmitterShapeBox>(Vector3{source.Shape[0], source.Shape[1], source.Shape[2]});
+    case CookedEmitterShape::Cone:
+        return std::make_unique<ParticleEmitterShapeCone>(source.Shape[0], source.Shape[1]);
+    case CookedEmitterShape::Hemisphere:
+        return std::make_unique<ParticleEmitterShapeHemisphere>(source.Shape[0]);
+    case CookedEmitterShape::Sector:
+        return std::make_unique<ParticleEmitterShapeSector>(MathHelper::ToRadians(source.Shape[0]));
+    case CookedEmitterShape::Sphere:
+        return std::make_unique<ParticleEmitterShapeSphere>(source.Shape[0]);
+    }
+    return nullptr;
+}
+
+std::tuple<std::shared_ptr<ParticleClip>, std::shared_ptr<Error>>
+ReadCookedParticleClip(const std::uint8_t* data, std::size_t size)
+{
+    CookedDataReader reader;
+    auto err = reader.Open(
+        data,
+        size,
+        CookedParticleClipSignature,
+        CookedParticleClipVersion,
+        CookedParticleClipSection::SectionCount);
+
+    if (err != nullptr) {
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    POMDOG_ASSERT(stream);
+    const auto clips = reader.GetSection<CookedParticleClip>(CookedParticleClipSection::Clips);
+    const auto floatKeys = reader.GetSection<CookedFloatKey>(CookedParticleClipSection::FloatKeys);
+    const auto colorKeys = reader.GetSection<CookedColorKey>(CookedParticleClipSection::ColorKeys);
 
-    if (byteLength <= 0) {
-        auto err = Errors::New("the file is too small " + filePath);
+    if (clips.size() != 1) {
+        return std::make_tuple(nullptr, Errors::New("should have a particle clip"));
+    }
+    const auto& source = clips[0];
+
+    auto particleClip = std::make_shared<ParticleClip>();
+    auto& clip = *particleClip;
+
+    clip.Duration = Duration{source.Duration};
+    clip.EmissionRate = source.EmissionRate;
+    clip.EmissionRateOverTime = source.EmissionRateOverTime;
+    clip.MaxParticles = source.MaxParticles;
+    clip.StartLifetime = source.StartLifetime;
+    clip.StartDelay = source.StartDelay;
+    clip.GravityModifier = source.GravityModifier;
+    clip.Looping = (source.Looping != 0);
+
+    if (err = ValidateParticleClip(clip); err != nullptr) {
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    auto json = BinaryReader::ReadArray<char>(stream, byteLength);
-    POMDOG_ASSERT(!json.empty());
+    auto identity = [](float value) { return value; };
+    auto toRadians = [](float degrees) { return MathHelper::ToRadians(degrees); };
+
+    clip.Shape = ReadCookedShape(source);
+    clip.StartSpeed = ReadCookedParameter<float>(reader, source.StartSpeed, floatKeys, identity);
+    clip.StartRotation = ReadCookedParameter<Radian<float>>(reader, source.StartRotation, floatKeys, toRadians);
+    clip.RotationOverLifetime = ReadCookedParameter<Radian<float>>(reader, source.RotationOverLifetime, floatKeys, toRadians);
+    clip.StartSize = ReadCookedParameter<float>(reader, source.StartSize, floatKeys, identity);
+    clip.SizeOverLifetime = ReadCookedParameter<float>(reader, source.SizeOverLifetime, floatKeys, identity);
+    clip.StartColor = ReadCookedParameter(reader, source.StartColor, colorKeys);
+    clip.ColorOverLifetime = ReadCookedParameter(reader, source.ColorOverLifetime, colorKeys);
+
+    const bool hasParameters = (clip.Shape != nullptr)
+        && (clip.StartSpeed != nullptr)
+        && (clip.StartRotation != nullptr)
+        && (clip.RotationOverLifetime != nullptr)
+        && (clip.StartSize != nullptr)
+        && (clip.SizeOverLifetime != nullptr)
+        && (clip.StartColor != nullptr)
+        && (clip.ColorOverLifetime != nullptr);
+
+    if (!hasParameters || !reader.IsValid()) {
+        return std::make_tuple(nullptr, Errors::New("invalid cooked particle clip: an unknown type, an invalid curve or an out of range reference"));
+    }
+
+    return std::make_tuple(std::move(particleClip), nullptr);
+}
+
+} // unnamed namespace
+
+std::tuple<std::shared_ptr<ParticleClip>, std::shared_ptr<Error>>
+AssetLoader<ParticleClip>::operator()(
+    AssetManager& assets, const std::string& filePath)
+{
+    auto [binary, openErr] = assets.OpenAssetFile(filePath);
+    if (openErr != nullptr) {
+        auto err = Errors::Wrap(std::move(openErr), "cannot open the file, " + filePath);
+        return std::make_tuple(nullptr, std::move(err));
+    }
 
-    if (json.empty()) {
+    if (binary.GetSize() == 0) {
         auto err = Errors::New("the file is too small " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
-    json.push_back('\0');
 
+    // NOTE: Particle clips cooked by `tools/cook_data` are read without parsing JSON.
+    if (CookedDataReader::HasSignature(binary.GetData(), binary.GetSize(), CookedParticleClipSignature)) {
+        auto [clip, err] = ReadCookedParticleClip(binary.GetData(), binary.GetSize());
+        if (err != nullptr) {
+            err = Errors::Wrap(std::move(err), "failed to read the cooked particle clip " + filePath);
+        }
+        return std::make_tuple(std::move(clip), std::move(err));
+    }
+
+    // NOTE: The JSON is parsed directly from the mapped file, which is not
+    // null-terminated, so the length has to be passed.
     rapidjson::Document doc;
-    doc.Parse(json.data());
+    doc.Parse(reinterpret_cast<const char*>(binary.GetData()), binary.GetSize());
 
     if (doc.HasParseError() || !doc.IsObject() || doc.MemberBegin() == doc.MemberEnd()) {
         auto err = Errors::New("failed to parse JSON " + filePath);
@@ -1,23 +1,20 @@
 // Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
 
 #include "Pomdog/Experimental/Spine/AnimationGraphBuilder.hpp"
-#include "Pomdog/Content/Utility/BinaryReader.hpp"
 #include "Pomdog/Experimental/Skeletal2D/AnimationClip.hpp"
 #include "Pomdog/Experimental/Skeletal2D/BlendTrees/AnimationClipNode.hpp"
 #include "Pomdog/Experimental/Skeletal2D/BlendTrees/AnimationLerpNode.hpp"
 #include "Pomdog/Experimental/Spine/AnimationLoader.hpp"
 #include "Pomdog/Experimental/Spine/SkeletonDesc.hpp"
 #include "Pomdog/Utility/Assert.hpp"
-#include "Pomdog/Utility/FileSystem.hpp"
+#include "Pomdog/Utility/MappedFile.hpp"
 #include <rapidjson/document.h>
-#include <fstream>
 #include <optional>
 #include <vector>
 
 namespace Pomdog::Spine {
 namespace {
 
-using Detail::BinaryReader;
 using Skeletal2D::AnimationBlendInput;
 using Skeletal2D::AnimationBlendInputType;
 using Skeletal2D::AnimationClip;
@@ -112,33 +109,19 @@ CreateAnimationNode(
 std::tuple<std::shared_ptr<Skeletal2D::AnimationGraph>, std::shared_ptr<Error>>
 LoadAnimationGraph(const SkeletonDesc& skeletonDesc, const std::string& filePath)
 {
-    std::ifstream stream{filePath, std::ifstream::binary};
-
-    if (!stream) {
-        auto err = Errors::New("cannot open the file, " + filePath);
-        return std::make_tuple(nullptr, std::move(err));
-    }
-
-    auto [byteLength, sizeErr] = FileSystem::GetFileSize(filePath);
-    if (sizeErr != nullptr) {
-        auto err = Errors::Wrap(std::move(sizeErr), "failed to get file size, " + filePath);
+    auto [binary, openErr] = MappedFile::Open(filePath);
+    if (openErr != nullptr) {
+        auto err = Errors::Wrap(std::move(openErr), "cannot open the file, " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    POMDOG_ASSERT(stream);
-
-    if (byteLength <= 0) {
+    if (binary.GetSize() == 0) {
         auto err = Errors::New("the file is too small " + filePath);
         return std::make_tuple(nullptr, std::move(err));
     }
 
-    auto json = BinaryReader::ReadArray<char>(stream, byteLength);
-    POMDOG_ASSERT(!json.empty());
-
-    json.push_back('\0');
-
     rapidjson::Document doc;
-    doc.Parse(json.data());
+    doc.Parse(reinterpret_cast<const char*>(binary.GetData()), binary.GetSize());
 
     if (doc.HasParseError()) {
         auto err = Errors::New("failed to parse JSON, " + filePath);
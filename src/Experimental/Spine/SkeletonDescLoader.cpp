@@ -2,14 +2,16 @@
 
 #include "Pomdog/Experimental/Spine/SkeletonDescLoader.hpp"
 #include "Pomdog/Content/AssetManager.hpp"
-#include "Pomdog/Content/Utility/BinaryReader.hpp"
+#include "Pomdog/Content/Utility/CookedData.hpp"
+#include "Pomdog/Content/Utility/MakeFourCC.hpp"
 #include "Pomdog/Math/Degree.hpp"
 #include "Pomdog/Math/MathHelper.hpp"
 #include "Pomdog/Utility/Assert.hpp"
-#include "Pomdog/Utility/FileSystem.hpp"
+#include "Pomdog/Utility/MappedFile.hpp"
 #include <rapidjson/document.h>
 #include <algorithm>
-#include <fstream>
+#include <cmath>
+#include <limits>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -41,6 +43,70 @@ std::uint16_t ToUInt16(T n)
     return static_cast<std::uint16_t>(n);
 }
 
+/// Converts the angle in degrees into radians in [-pi, pi].
+Radian<float> ToNormalizedRadians(Degree<float> degreeAngle)
+{
+    // NOTE: Subtracting 360 in a loop never terminates for large angles,
+    // where `angle - 360` rounds back to `angle`.
+    degreeAngle.value = std::remainder(degreeAngle.value, 360.0f);
+    return MathHelper::ToRadians(degreeAngle);
+}
+
+struct LocalVertex final {
+    Vector2 Position;
+    float Weight;
+    Skeletal2D::JointIndex JointIndex;
+};
+
+/// Creates a skinned vertex from the bones that influence it. Up to four
+/// bones with the largest weights are used.
+SkinnedMeshVertexDesc CreateSkinnedMeshVertex(std::vector<LocalVertex>& localVertices, const Vector2& textureCoordinate)
+{
+    POMDOG_ASSERT(!localVertices.empty());
+
+    SkinnedMeshVertexDesc vertex;
+    vertex.Weights.fill(0.0f);
+
+    std::sort(std::begin(localVertices), std::end(localVertices),
+        [](const LocalVertex& a, const LocalVertex& b) {
+            POMDOG_ASSERT(a.JointIndex);
+            POMDOG_ASSERT(b.JointIndex);
+            return a.Weight > b.Weight;
+        });
+
+    if (localVertices.size() >= vertex.Joints.size()) {
+        float accumulatedWeight = 0;
+        for (std::uint8_t index = 0; index < vertex.Joints.size(); ++index) {
+            POMDOG_ASSERT(index < vertex.Joints.size());
+            accumulatedWeight += localVertices[index].Weight;
+        }
+
+        if (accumulatedWeight < 1) {
+            auto weightDiff = (1 - accumulatedWeight) / vertex.Joints.size();
+            for (auto& localVertex : localVertices) {
+                localVertex.Weight += weightDiff;
+            }
+        }
+    }
+
+    vertex.Position = localVertices.front().Position;
+
+    auto boneCount = std::min(vertex.Joints.size(), localVertices.size());
+    for (std::uint8_t index = 0; index < boneCount; ++index) {
+        POMDOG_ASSERT(vertex.Joints.size() == 4);
+        POMDOG_ASSERT(index < vertex.Joints.size());
+        vertex.Joints[index] = localVertices[index].JointIndex;
+
+        POMDOG_ASSERT(vertex.Weights.size() == 3);
+        if (index < vertex.Weights.size()) {
+            vertex.Weights[index] = localVertices[index].Weight;
+        }
+    }
+
+    vertex.TextureCoordinate = textureCoordinate;
+    return vertex;
+}
+
 void ReadJsonMember(const rapidjson::Value& object, const char* memberName, std::string& output)
 {
     if (!object.HasMember(memberName)) {
@@ -85,14 +151,7 @@ void ReadJsonMember(const rapidjson::Value& object, const char* memberName, Radi
 
     auto& memberObject = object[memberName];
     if (memberObject.IsNumber()) {
-        Degree<float> degreeAngle = memberObject.GetFloat();
-        while (degreeAngle > 180.0f) {
-            degreeAngle -= 360.0f;
-        }
-        while (degreeAngle < -180.0f) {
-            degreeAngle += 360.0f;
-        }
-        output = MathHelper::ToRadians(degreeAngle);
+        output = ToNormalizedRadians(memberObject.GetFloat());
     }
 }
 
@@ -289,15 +348,11 @@ std::vector<SkinnedMeshVertexDesc> ReadSkinnedMeshVertices(
     std::uint32_t verticesIter = 0;
     auto uvsIter = uvsArray.Begin();
 
+    std::vector<LocalVertex> localVertices;
+
     while (uvsIter != uvsArray.End()) {
         POMDOG_ASSERT(verticesIter < verticesArray.Size());
 
-        struct LocalVertex final {
-            Vector2 Position;
-            float Weight;
-            Skeletal2D::JointIndex JointIndex;
-        };
-
         POMDOG_ASSERT(verticesArray[verticesIter].IsUint());
         const auto sourceBoneCount = [](std::uint32_t x) -> std::uint8_t {
             POMDOG_ASSERT(x >= 0);
@@ -307,7 +362,7 @@ std::vector<SkinnedMeshVertexDesc> ReadSkinnedMeshVertices(
         ++verticesIter;
         POMDOG_ASSERT(sourceBoneCount > 0);
 
-        std::vector<LocalVertex> localVertices;
+        localVertices.clear();
         localVertices.reserve(sourceBoneCount);
 
         for (std::uint8_t index = 0; index < sourceBoneCount; ++index) {
@@ -334,53 +389,16 @@ std::vector<SkinnedMeshVertexDesc> ReadSkinnedMeshVertices(
             localVertices.push_back(std::move(vertex));
         }
 
-        SkinnedMeshVertexDesc vertex;
-
-        std::sort(std::begin(localVertices), std::end(localVertices),
-            [](const LocalVertex& a, const LocalVertex& b) {
-                POMDOG_ASSERT(a.JointIndex);
-                POMDOG_ASSERT(b.JointIndex);
-                return a.Weight > b.Weight;
-            });
-
-        if (localVertices.size() >= vertex.Joints.size()) {
-            float accumulatedWeight = 0;
-            for (std::uint8_t index = 0; index < vertex.Joints.size(); ++index) {
-                POMDOG_ASSERT(index < vertex.Joints.size());
-                accumulatedWeight += localVertices[index].Weight;
-            }
-
-            if (accumulatedWeight < 1) {
-                auto weightDiff = (1 - accumulatedWeight) / vertex.Joints.size();
-                for (auto& localVertex : localVertices) {
-                    localVertex.Weight += weightDiff;
-                }
-            }
-        }
-
-        vertex.Position = localVertices.front().Position;
-
-        auto boneCount = std::min(vertex.Joints.size(), localVertices.size());
-        for (std::uint8_t index = 0; index < boneCount; ++index) {
-            POMDOG_ASSERT(vertex.Joints.size() == 4);
-            POMDOG_ASSERT(index < vertex.Joints.size());
-            vertex.Joints[index] = localVertices[index].JointIndex;
-
-            POMDOG_ASSERT(vertex.Weights.size() == 3);
-            if (index < vertex.Weights.size()) {
-                vertex.Weights[index] = localVertices[index].Weight;
-            }
-        }
-
+        Vector2 textureCoordinate;
         POMDOG_ASSERT(uvsIter->IsNumber());
-        vertex.TextureCoordinate.X = uvsIter->GetFloat();
+        textureCoordinate.X = uvsIter->GetFloat();
         ++uvsIter;
         POMDOG_ASSERT(uvsIter != uvsArray.End());
         POMDOG_ASSERT(uvsIter->IsNumber());
-        vertex.TextureCoordinate.Y = uvsIter->GetFloat();
+        textureCoordinate.Y = uvsIter->GetFloat();
         ++uvsIter;
 
-        vertices.push_back(std::move(vertex));
+        vertices.push_back(CreateSkinnedMeshVertex(localVertices, textureCoordinate));
     }
 
     return vertices;
@@ -607,13 +625,7 @@ std::vector<AnimationSamplePointRotate> ReadAnimationRotateSamples(const rapidjs
 
         Degree<float> degreeAngle = 0.0f;
         ReadJsonMember(*iter, "angle", degreeAngle);
-        while (degreeAngle > 180.0f) {
-            degreeAngle -= 360.0f;
-        }
-        while (degreeAngle < -180.0f) {
-            degreeAngle += 360.0f;
-        }
-        samplePoint.Rotation = MathHelper::ToRadians(degreeAngle).value;
+        samplePoint.Rotation = ToNormalizedRadians(degreeAngle).value;
 
         samplePoints.push_back(std::move(samplePoint));
     }
@@ -781,40 +793,466 @@ std::vector<AnimationClipDesc> ReadAnimationClips(const rapidjson::Value& docume
     return animations;
 }
 
-} // namespace
+// NOTE: The layout of a cooked skeleton must be kept in sync with
+// `tools/cook_data/spine.go`. The values are stored as they are written in
+// the JSON, such as angles in degrees, so that both formats are converted by
+// the same code.
+constexpr std::uint32_t CookedSkeletonSignature = Detail::MakeFourCC('S', 'K', 'E', 'L');
+constexpr std::uint32_t CookedSkeletonVersion = 1;
+
+struct CookedSkeletonSection final {
+    enum : std::uint32_t {
+        Strings,
+        Bones,
+        Slots,
+        Skins,
+        SkinSlots,
+        Attachments,
+        SkinnedMeshes,
+        SkinnedMeshVertices,
+        SkinnedMeshInfluences,
+        SkinnedMeshIndices,
+        AnimationClips,
+        BoneTracks,
+        TranslateSamples,
+        RotateSamples,
+        ScaleSamples,
+        SlotTracks,
+        AttachmentSamples,
+        SectionCount,
+    };
+};
+
+using Detail::CookedArray;
+using Detail::CookedDataReader;
+using Detail::CookedSpan;
+using Detail::CookedString;
+
+struct CookedBone final {
+    CookedString Name;
+    CookedString Parent;
+    float X;
+    float Y;
+    float Scale;
+    float Rotation;
+};
+
+struct CookedSlot final {
+    CookedString Name;
+    CookedString Attachment;
+    std::uint32_t Color;
+    std::uint32_t Joint;
+};
+
+struct CookedSkin final {
+    CookedString Name;
+    CookedSpan Slots;
+};
+
+struct CookedSkinSlot final {
+    CookedString SlotName;
+    CookedSpan Attachments;
+    CookedSpan SkinnedMeshes;
+};
+
+struct CookedAttachment final {
+    CookedString Name;
+    float X;
+    float Y;
+    float ScaleX;
+    float ScaleY;
+    float Rotation;
+    std::uint16_t Width;
+    std::uint16_t Height;
+};
+
+struct CookedSkinnedMesh final {
+    CookedString Name;
+    CookedSpan Vertices;
+    CookedSpan Indices;
+};
+
+struct CookedSkinnedMeshVertex final {
+    float U;
+    float V;
+    CookedSpan Influences;
+};
+
+struct CookedSkinnedMeshInfluence final {
+    std::uint32_t Joint;
+    float X;
+    float Y;
+    float Weight;
+};
+
+struct CookedAnimationClip final {
+    CookedString Name;
+    CookedSpan BoneTracks;
+    CookedSpan SlotTracks;
+};
+
+struct CookedBoneTrack final {
+    CookedString BoneName;
+    CookedSpan TranslateSamples;
+    CookedSpan RotateSamples;
+    CookedSpan ScaleSamples;
+};
+
+struct CookedTranslateSample final {
+    float Time;
+    float X;
+    float Y;
+    std::uint32_t Curve;
+};
+
+struct CookedRotateSample final {
+    float Time;
+    float Angle;
+    std::uint32_t Curve;
+};
+
+struct CookedScaleSample final {
+    float Time;
+    float Scale;
+    std::uint32_t Curve;
+};
+
+struct CookedSlotTrack final {
+    CookedString SlotName;
+    CookedSpan AttachmentSamples;
+};
+
+struct CookedAttachmentSample final {
+    CookedString Name;
+    float Time;
+};
+
+static_assert(sizeof(CookedBone) == 32);
+static_assert(sizeof(CookedSlot) == 24);
+static_assert(sizeof(CookedSkin) == 16);
+static_assert(sizeof(CookedSkinSlot) == 24);
+static_assert(sizeof(CookedAttachment) == 32);
+static_assert(sizeof(CookedSkinnedMesh) == 24);
+static_assert(sizeof(CookedSkinnedMeshVertex) == 16);
+static_assert(sizeof(CookedSkinnedMeshInfluence) == 16);
+static_assert(sizeof(CookedAnimationClip) == 24);
+static_assert(sizeof(CookedBoneTrack) == 32);
+static_assert(sizeof(CookedTranslateSample) == 16);
+static_assert(sizeof(CookedRotateSample) == 12);
+static_assert(sizeof(CookedScaleSample) == 12);
+static_assert(sizeof(CookedSlotTrack) == 16);
+static_assert(sizeof(CookedAttachmentSample) == 12);
+
+class CookedSkeletonReader final {
+public:
+    CookedDataReader reader;
+    CookedArray<CookedSkinSlot> skinSlots;
+    CookedArray<CookedAttachment> attachments;
+    CookedArray<CookedSkinnedMesh> skinnedMeshes;
+    CookedArray<CookedSkinnedMeshVertex> skinnedMeshVertices;
+    CookedArray<CookedSkinnedMeshInfluence> skinnedMeshInfluences;
+    CookedArray<std::uint16_t> skinnedMeshIndices;
+    CookedArray<CookedBoneTrack> boneTracks;
+    CookedArray<CookedTranslateSample> translateSamples;
+    CookedArray<CookedRotateSample> rotateSamples;
+    CookedArray<CookedScaleSample> scaleSamples;
+    CookedArray<CookedSlotTrack> slotTracks;
+    CookedArray<CookedAttachmentSample> attachmentSamples;
+    std::size_t jointCount = 0;
+
+    std::string ReadString(const CookedString& s)
+    {
+        return std::string{reader.GetString(s)};
+    }
+
+    KeyframeCurve ReadCurve(std::uint32_t curve)
+    {
+        if (curve > static_cast<std::uint32_t>(KeyframeCurve::Bezier)) {
+            valid = false;
+            return KeyframeCurve::Liener;
+        }
+        return static_cast<KeyframeCurve>(curve);
+    }
+
+    Radian<float> ReadAngle(float degrees)
+    {
+        if (!std::isfinite(degrees)) {
+            valid = false;
+            return 0.0f;
+        }
+        return ToNormalizedRadians(degrees);
+    }
+
+    template <typename T, T Denominator>
+    void ReadCompressedFloat(float value, Skeletal2D::Detail::CompressedFloat<T, Denominator>& output)
+    {
+        using CompressedFloat = Skeletal2D::Detail::CompressedFloat<T, Denominator>;
+
+        // NOTE: This also rejects NaN.
+        if (!((value >= CompressedFloat::Min()) && (value < CompressedFloat::Max()))) {
+            valid = false;
+            value = 0.0f;
+        }
+        output = value;
+    }
+
+    JointIndex ReadJointIndex(std::uint32_t joint)
+    {
+        if ((joint >= jointCount) || (joint > std::numeric_limits<std::uint8_t>::max())) {
+            valid = false;
+            return {};
+        }
+        return ToJointIndex(joint);
+    }
+
+    SkinnedMeshAttachmentDesc ReadSkinnedMesh(const CookedSkinnedMesh& source)
+    {
+        SkinnedMeshAttachmentDesc desc;
+        desc.Name = ReadString(source.Name);
+
+        const auto vertices = reader.Slice(skinnedMeshVertices, source.Vertices);
+        desc.Vertices.reserve(vertices.size());
+
+        std::vector<LocalVertex> localVertices;
+        for (const auto& vertex : vertices) {
+            const auto influences = reader.Slice(skinnedMeshInfluences, vertex.Influences);
+            if (influences.size() == 0) {
+                valid = false;
+                break;
+            }
+
+            localVertices.clear();
+            localVertices.reserve(influences.size());
+            for (const auto& influence : influences) {
+                LocalVertex localVertex;
+                localVertex.JointIndex = ReadJointIndex(influence.Joint);
+                localVertex.Position = Vector2{influence.X, influence.Y};
+                localVertex.Weight = influence.Weight;
+                localVertices.push_back(std::move(localVertex));
+            }
+            if (!valid) {
+                break;
+            }
+            desc.Vertices.push_back(CreateSkinnedMeshVertex(localVertices, Vector2{vertex.U, vertex.V}));
+        }
+
+        const auto indices = reader.Slice(skinnedMeshIndices, source.Indices);
+        desc.Indices.assign(indices.begin(), indices.end());
+        return desc;
+    }
+
+    SkinSlotDesc ReadSkinSlot(const CookedSkinSlot& source)
+    {
+        SkinSlotDesc desc;
+        desc.SlotName = ReadString(source.SlotName);
+
+        const auto slotAttachments = reader.Slice(attachments, source.Attachments);
+        desc.Attachments.reserve(slotAttachments.size());
+        for (const auto& attachment : slotAttachments) {
+            AttachmentDesc attachmentDesc;
+            attachmentDesc.Name = ReadString(attachment.Name);
+            attachmentDesc.Translate = Vector2{attachment.X, attachment.Y};
+            attachmentDesc.Scale = Vector2{attachment.ScaleX, attachment.ScaleY};
+            attachmentDesc.Rotation = ReadAngle(attachment.Rotation);
+            attachmentDesc.Width = attachment.Width;
+            attachmentDesc.Height = attachment.Height;
+            desc.Attachments.push_back(std::move(attachmentDesc));
+        }
+
+        const auto meshes = reader.Slice(skinnedMeshes, source.SkinnedMeshes);
+        desc.SkinnedMeshAttachments.reserve(meshes.size());
+        for (const auto& mesh : meshes) {
+            desc.SkinnedMeshAttachments.push_back(ReadSkinnedMesh(mesh));
+        }
+        return desc;
+    }
+
+    BoneAnimationTrackDesc ReadBoneTrack(const CookedBoneTrack& source)
+    {
+        BoneAnimationTrackDesc desc;
+        desc.BoneName = ReadString(source.BoneName);
+
+        const auto translates = reader.Slice(translateSamples, source.TranslateSamples);
+        desc.TranslateSamples.reserve(translates.size());
+        for (const auto& sample : translates) {
+            AnimationSamplePointTranslate samplePoint;
+            samplePoint.Time = AnimationTimeInterval(sample.Time);
+            ReadCompressedFloat(sample.X, samplePoint.TranslateX);
+            ReadCompressedFloat(sample.Y, samplePoint.TranslateY);
+            samplePoint.Curve = ReadCurve(sample.Curve);
+            desc.TranslateSamples.push_back(std::move(samplePoint));
+        }
+
+        const auto rotates = reader.Slice(rotateSamples, source.RotateSamples);
+        desc.RotateSamples.reserve(rotates.size());
+        for (const auto& sample : rotates) {
+            AnimationSamplePointRotate samplePoint;
+            samplePoint.Time = AnimationTimeInterval(sample.Time);
+            samplePoint.Rotation = ReadAngle(sample.Angle).value;
+            samplePoint.Curve = ReadCurve(sample.Curve);
+            desc.RotateSamples.push_back(std::move(samplePoint));
+        }
+
+        const auto scales = reader.Slice(scaleSamples, source.ScaleSamples);
+        desc.ScaleSamples.reserve(scales.size());
+        for (const auto& sample : scales) {
+            AnimationSamplePointScale samplePoint;
+            samplePoint.Time = AnimationTimeInterval(sample.Time);
+            ReadCompressedFloat(sample.Scale, samplePoint.Scale);
+            samplePoint.Curve = ReadCurve(sample.Curve);
+            desc.ScaleSamples.push_back(std::move(samplePoint));
+        }
+        return desc;
+    }
+
+    SlotAnimationTrackDesc ReadSlotTrack(const CookedSlotTrack& source)
+    {
+        SlotAnimationTrackDesc desc;
+        desc.SlotName = ReadString(source.SlotName);
+
+        const auto samples = reader.Slice(attachmentSamples, source.AttachmentSamples);
+        desc.AttachmentSamples.reserve(samples.size());
+        for (const auto& sample : samples) {
+            AnimationSamplePointAttachment samplePoint;
+            samplePoint.AttachmentName = ReadString(sample.Name);
+            samplePoint.Time = AnimationTimeInterval(sample.Time);
+            desc.AttachmentSamples.push_back(std::move(samplePoint));
+        }
+        return desc;
+    }
+
+    bool IsValid() const noexcept
+    {
+        return valid && reader.IsValid();
+    }
+
+private:
+    bool valid = true;
+};
 
 std::tuple<SkeletonDesc, std::shared_ptr<Error>>
-SkeletonDescLoader::Load(const std::string& filePath)
+ReadCookedSkeleton(const std::uint8_t* data, std::size_t size, const std::string& filePath)
 {
-    using Detail::BinaryReader;
+    CookedSkeletonReader cooked;
+    auto& reader = cooked.reader;
+
+    auto err = reader.Open(
+        data,
+        size,
+        CookedSkeletonSignature,
+        CookedSkeletonVersion,
+        CookedSkeletonSection::SectionCount);
+
+    if (err != nullptr) {
+        err = Errors::Wrap(std::move(err), "invalid cooked skeleton, " + filePath);
+        return std::make_tuple(SkeletonDesc{}, std::move(err));
+    }
 
-    std::ifstream stream{filePath, std::ifstream::binary};
+    const auto bones = reader.GetSection<CookedBone>(CookedSkeletonSection::Bones);
+    const auto slots = reader.GetSection<CookedSlot>(CookedSkeletonSection::Slots);
+    const auto skins = reader.GetSection<CookedSkin>(CookedSkeletonSection::Skins);
+    const auto animationClips = reader.GetSection<CookedAnimationClip>(CookedSkeletonSection::AnimationClips);
+    cooked.skinSlots = reader.GetSection<CookedSkinSlot>(CookedSkeletonSection::SkinSlots);
+    cooked.attachments = reader.GetSection<CookedAttachment>(CookedSkeletonSection::Attachments);
+    cooked.skinnedMeshes = reader.GetSection<CookedSkinnedMesh>(CookedSkeletonSection::SkinnedMeshes);
+    cooked.skinnedMeshVertices = reader.GetSection<CookedSkinnedMeshVertex>(CookedSkeletonSection::SkinnedMeshVertices);
+    cooked.skinnedMeshInfluences = reader.GetSection<CookedSkinnedMeshInfluence>(CookedSkeletonSection::SkinnedMeshInfluences);
+    cooked.skinnedMeshIndices = reader.GetSection<std::uint16_t>(CookedSkeletonSection::SkinnedMeshIndices);
+    cooked.boneTracks = reader.GetSection<CookedBoneTrack>(CookedSkeletonSection::BoneTracks);
+    cooked.translateSamples = reader.GetSection<CookedTranslateSample>(CookedSkeletonSection::TranslateSamples);
+    cooked.rotateSamples = reader.GetSection<CookedRotateSample>(CookedSkeletonSection::RotateSamples);
+    cooked.scaleSamples = reader.GetSection<CookedScaleSample>(CookedSkeletonSection::ScaleSamples);
+    cooked.slotTracks = reader.GetSection<CookedSlotTrack>(CookedSkeletonSection::SlotTracks);
+    cooked.attachmentSamples = reader.GetSection<CookedAttachmentSample>(CookedSkeletonSection::AttachmentSamples);
+    cooked.jointCount = bones.size();
 
-    if (!stream) {
-        auto err = Errors::New("cannot open the file, " + filePath);
-        return std::make_tuple(SkeletonDesc{}, std::move(err));
+    Spine::SkeletonDesc skeleton;
+
+    skeleton.Bones.reserve(bones.size());
+    for (const auto& bone : bones) {
+        BoneDesc boneDesc;
+        boneDesc.Name = cooked.ReadString(bone.Name);
+        boneDesc.Parent = cooked.ReadString(bone.Parent);
+        boneDesc.Pose.Translate.X = bone.X;
+        boneDesc.Pose.Translate.Y = bone.Y;
+        boneDesc.Pose.Scale = bone.Scale;
+        boneDesc.Pose.Rotation = cooked.ReadAngle(bone.Rotation).value;
+        skeleton.Bones.push_back(std::move(boneDesc));
+    }
+
+    skeleton.Slots.reserve(slots.size());
+    for (const auto& slot : slots) {
+        SlotDesc slotDesc;
+        slotDesc.Name = cooked.ReadString(slot.Name);
+        slotDesc.Attachement = cooked.ReadString(slot.Attachment);
+        slotDesc.Color = Color::FromPackedValue(slot.Color);
+        slotDesc.Joint = cooked.ReadJointIndex(slot.Joint);
+        skeleton.Slots.push_back(std::move(slotDesc));
+    }
+
+    skeleton.Skins.reserve(skins.size());
+    for (const auto& skin : skins) {
+        SkinDesc skinDesc;
+        skinDesc.Name = cooked.ReadString(skin.Name);
+
+        const auto skinSlots = reader.Slice(cooked.skinSlots, skin.Slots);
+        skinDesc.Slots.reserve(skinSlots.size());
+        for (const auto& skinSlot : skinSlots) {
+            skinDesc.Slots.push_back(cooked.ReadSkinSlot(skinSlot));
+        }
+        skeleton.Skins.push_back(std::move(skinDesc));
+    }
+
+    skeleton.AnimationClips.reserve(animationClips.size());
+    for (const auto& clip : animationClips) {
+        AnimationClipDesc clipDesc;
+        clipDesc.Name = cooked.ReadString(clip.Name);
+
+        const auto clipBoneTracks = reader.Slice(cooked.boneTracks, clip.BoneTracks);
+        clipDesc.BoneTracks.reserve(clipBoneTracks.size());
+        for (const auto& track : clipBoneTracks) {
+            clipDesc.BoneTracks.push_back(cooked.ReadBoneTrack(track));
+        }
+
+        const auto clipSlotTracks = reader.Slice(cooked.slotTracks, clip.SlotTracks);
+        clipDesc.SlotTracks.reserve(clipSlotTracks.size());
+        for (const auto& track : clipSlotTracks) {
+            clipDesc.SlotTracks.push_back(cooked.ReadSlotTrack(track));
+        }
+        skeleton.AnimationClips.push_back(std::move(clipDesc));
     }
 
-    auto [byteLength, sizeErr] = FileSystem::GetFileSize(filePath);
-    if (sizeErr != nullptr) {
-        auto err = Errors::Wrap(std::move(sizeErr), "failed to get file size, " + filePath);
+    if (!cooked.IsValid()) {
+        auto err = Errors::New("invalid cooked skeleton: a reference is out of range, " + filePath);
         return std::make_tuple(SkeletonDesc{}, std::move(err));
     }
 
-    POMDOG_ASSERT(stream);
+    return std::make_tuple(std::move(skeleton), nullptr);
+}
+
+} // namespace
 
-    if (byteLength <= 0) {
-        auto err = Errors::New("the file is too small " + filePath);
+std::tuple<SkeletonDesc, std::shared_ptr<Error>>
+SkeletonDescLoader::Load(const std::string& filePath)
+{
+    auto [binary, openErr] = MappedFile::Open(filePath);
+    if (openErr != nullptr) {
+        auto err = Errors::Wrap(std::move(openErr), "cannot open the file, " + filePath);
         return std::make_tuple(SkeletonDesc{}, std::move(err));
     }
 
-    auto json = BinaryReader::ReadArray<char>(stream, byteLength);
-    POMDOG_ASSERT(!json.empty());
+    if (binary.GetSize() == 0) {
+        auto err = Errors::New("the file is too small " + filePath);
+        return std::make_tuple(SkeletonDesc{}, std::move(err));
+    }
 
-    json.push_back('\0');
+    // NOTE: Skeletons cooked by `tools/cook_data` are read without parsing JSON.
+    if (Detail::CookedDataReader::HasSignature(binary.GetData(), binary.GetSize(), CookedSkeletonSignature)) {
+        return ReadCookedSkeleton(binary.GetData(), binary.GetSize(), filePath);
+    }
 
     rapidjson::Document doc;
-    doc.Parse(json.data());
+    doc.Parse(reinterpret_cast<const char*>(binary.GetData()), binary.GetSize());
 
     if (doc.HasParseError() || !doc.IsObject()) {
         auto err = Errors::New("failed to parse JSON " + filePath);
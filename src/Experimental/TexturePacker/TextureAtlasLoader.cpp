@@ -2,11 +2,14 @@
 
 #include "Pomdog/Experimental/TexturePacker/TextureAtlasLoader.hpp"
 #include "Pomdog/Content/AssetManager.hpp"
+#include "Pomdog/Content/Utility/CookedData.hpp"
+#include "Pomdog/Content/Utility/MakeFourCC.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 #include "Pomdog/Utility/Exception.hpp"
+#include "Pomdog/Utility/MappedFile.hpp"
 #include <algorithm>
-#include <fstream>
 #include <sstream>
+#include <string_view>
 #include <utility>
 
 namespace Pomdog::TexturePacker {
@@ -36,19 +39,117 @@ TextureAtlasRegion CreateAtlasRegion(const std::string& line, std::int16_t pageI
     return region;
 }
 
+// NOTE: The layout of a cooked texture atlas must be kept in sync with
+// `tools/cook_data/atlas.go`.
+constexpr std::uint32_t CookedTextureAtlasSignature = Detail::MakeFourCC('A', 'T', 'L', 'S');
+constexpr std::uint32_t CookedTextureAtlasVersion = 1;
+
+struct CookedTextureAtlasSection final {
+    enum : std::uint32_t {
+        Strings,
+        Pages,
+        Regions,
+        SectionCount,
+    };
+};
+
+using Detail::CookedDataReader;
+using Detail::CookedString;
+
+struct CookedTextureAtlasPage final {
+    CookedString Name;
+};
+
+struct CookedTextureAtlasRegion final {
+    CookedString Name;
+    std::int32_t X;
+    std::int32_t Y;
+    std::int32_t Width;
+    std::int32_t Height;
+    std::int16_t XOffset;
+    std::int16_t YOffset;
+    std::int16_t OriginalWidth;
+    std::int16_t OriginalHeight;
+    std::int16_t TexturePage;
+    std::uint16_t Rotate;
+};
+
+static_assert(sizeof(CookedTextureAtlasPage) == 8);
+static_assert(sizeof(CookedTextureAtlasRegion) == 36);
+
+std::tuple<TextureAtlas, std::shared_ptr<Error>>
+ReadCookedTextureAtlas(const std::uint8_t* data, std::size_t size, const std::string& filePath)
+{
+    CookedDataReader reader;
+    auto err = reader.Open(
+        data,
+        size,
+        CookedTextureAtlasSignature,
+        CookedTextureAtlasVersion,
+        CookedTextureAtlasSection::SectionCount);
+
+    if (err != nullptr) {
+        err = Errors::Wrap(std::move(err), "invalid cooked texture atlas, " + filePath);
+        return std::make_tuple(TextureAtlas{}, std::move(err));
+    }
+
+    const auto pages = reader.GetSection<CookedTextureAtlasPage>(CookedTextureAtlasSection::Pages);
+    const auto regions = reader.GetSection<CookedTextureAtlasRegion>(CookedTextureAtlasSection::Regions);
+
+    TextureAtlas result;
+
+    result.pages.reserve(pages.size());
+    for (const auto& page : pages) {
+        TextureAtlasPage atlasPage;
+        atlasPage.Name = reader.GetString(page.Name);
+        result.pages.push_back(std::move(atlasPage));
+    }
+
+    bool valid = true;
+    result.regions.reserve(regions.size());
+    for (const auto& region : regions) {
+        if ((region.TexturePage < 0) || (static_cast<std::size_t>(region.TexturePage) >= pages.size())) {
+            valid = false;
+            break;
+        }
+
+        TextureAtlasRegion atlasRegion;
+        atlasRegion.Name = reader.GetString(region.Name);
+        atlasRegion.TexturePage = region.TexturePage;
+        atlasRegion.Region.Subrect = {region.X, region.Y, region.Width, region.Height};
+        atlasRegion.Region.XOffset = region.XOffset;
+        atlasRegion.Region.YOffset = region.YOffset;
+        atlasRegion.Region.Width = region.OriginalWidth;
+        atlasRegion.Region.Height = region.OriginalHeight;
+        atlasRegion.Region.Rotate = (region.Rotate != 0);
+        result.regions.push_back(std::move(atlasRegion));
+    }
+
+    if (!valid || !reader.IsValid()) {
+        auto err = Errors::New("invalid cooked texture atlas: a reference is out of range, " + filePath);
+        return std::make_tuple(TextureAtlas{}, std::move(err));
+    }
+
+    return std::make_tuple(std::move(result), nullptr);
+}
+
 } // unnamed namespace
 
 std::tuple<TextureAtlas, std::shared_ptr<Error>>
 TextureAtlasLoader::Load(const std::string& filePath)
 {
-    std::ifstream stream{filePath, std::ifstream::binary};
-
-    if (!stream) {
-        auto err = Errors::New("cannot open the file, " + filePath);
+    auto [file, openErr] = MappedFile::Open(filePath);
+    if (openErr != nullptr) {
+        auto err = Errors::Wrap(std::move(openErr), "cannot open the file, " + filePath);
         return std::make_tuple(TextureAtlas{}, std::move(err));
     }
 
-    POMDOG_ASSERT(stream);
+    // NOTE: Texture atlases cooked by `tools/cook_data` are read without parsing the text.
+    if (CookedDataReader::HasSignature(file.GetData(), file.GetSize(), CookedTextureAtlasSignature)) {
+        return ReadCookedTextureAtlas(file.GetData(), file.GetSize(), filePath);
+    }
+
+    const std::string_view text{reinterpret_cast<const char*>(file.GetData()), file.GetSize()};
 
     TextureAtlas result;
     std::int16_t pageIndex = 0;
@@ -56,7 +157,14 @@ TextureAtlasLoader::Load(const std::string& filePath)
     ParserState state = ParserState::PageName;
 
     std::string line;
-    while (std::getline(stream, line)) {
+    for (std::size_t lineBegin = 0; lineBegin < text.size();) {
+        auto lineEnd = text.find('\n', lineBegin);
+        if (lineEnd == std::string_view::npos) {
+            lineEnd = text.size();
+        }
+        line.assign(text.substr(lineBegin, lineEnd - lineBegin));
+        lineBegin = lineEnd + 1;
+
         switch (state) {
         case ParserState::ParsingError: {
             break;
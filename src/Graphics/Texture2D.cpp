@@ -5,6 +5,7 @@
 #include "../RenderSystem/NativeTexture2D.hpp"
 #include "../RenderSystem/TextureHelper.hpp"
 #include "Pomdog/Graphics/GraphicsDevice.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 #include "Pomdog/Utility/Exception.hpp"
 #include <algorithm>
@@ -39,6 +40,8 @@ Texture2D::Texture2D(
 
 Texture2D::~Texture2D() = default;
 
+Texture2D& Texture2D::operator=(Texture2D&&) = default;
+
 std::int32_t Texture2D::GetWidth() const
 {
     return pixelWidth;
@@ -69,6 +72,24 @@ void Texture2D::SetData(const void* pixelData)
     nativeTexture2D->SetData(pixelWidth, pixelHeight, levelCount, format, pixelData);
 }
 
+void Texture2D::SetData(const Rectangle& region, std::int32_t mipLevel, const void* pixelData)
+{
+    POMDOG_ASSERT(nativeTexture2D);
+    POMDOG_ASSERT(pixelData);
+    POMDOG_ASSERT(mipLevel >= 0);
+    POMDOG_ASSERT(mipLevel < levelCount);
+    POMDOG_ASSERT(region.X >= 0);
+    POMDOG_ASSERT(region.Y >= 0);
+    POMDOG_ASSERT(region.Width > 0);
+    POMDOG_ASSERT(region.Height > 0);
+    POMDOG_ASSERT(region.GetRight() <= std::max(pixelWidth >> mipLevel, 1));
+    POMDOG_ASSERT(region.GetBottom() <= std::max(pixelHeight >> mipLevel, 1));
+    POMDOG_ASSERT(format != SurfaceFormat::BlockComp1_UNorm);
+    POMDOG_ASSERT(format != SurfaceFormat::BlockComp2_UNorm);
+    POMDOG_ASSERT(format != SurfaceFormat::BlockComp3_UNorm);
+    nativeTexture2D->SetData(region, mipLevel, format, pixelData);
+}
+
 Detail::NativeTexture2D* Texture2D::GetNativeTexture2D()
 {
     return nativeTexture2D.get();
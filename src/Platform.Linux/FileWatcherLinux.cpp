@@ -0,0 +1,133 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "FileWatcherLinux.hpp"
+#include "../Utility/ErrorHelper.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include "Pomdog/Utility/PathHelper.hpp"
+#include <dirent.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+
+namespace Pomdog::Detail::Linux {
+namespace {
+
+// NOTE: Editors often save a file by writing a temporary file and renaming it,
+// so moved files are reported as well as written files.
+constexpr std::uint32_t WatchMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR;
+
+constexpr std::size_t EventBufferSize = 16 * (sizeof(struct inotify_event) + NAME_MAX + 1);
+
+} // namespace
+
+FileWatcherLinux::~FileWatcherLinux()
+{
+    if (inotifyDescriptor != -1) {
+        // NOTE: Closing the descriptor removes all the watches.
+        ::close(inotifyDescriptor);
+        inotifyDescriptor = -1;
+    }
+}
+
+std::shared_ptr<Error>
+FileWatcherLinux::Watch(const std::string& directory)
+{
+    POMDOG_ASSERT(!directory.empty());
+
+    if (inotifyDescriptor == -1) {
+        inotifyDescriptor = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyDescriptor == -1) {
+            return Errors::New(ToErrc(errno), "::inotify_init1() failed");
+        }
+        eventBuffer.resize(EventBufferSize);
+    }
+
+    return AddWatch(directory);
+}
+
+std::shared_ptr<Error>
+FileWatcherLinux::AddWatch(const std::string& directory)
+{
+    POMDOG_ASSERT(inotifyDescriptor != -1);
+
+    const auto watchDescriptor = ::inotify_add_watch(inotifyDescriptor, directory.c_str(), WatchMask);
+    if (watchDescriptor == -1) {
+        return Errors::New(ToErrc(errno), "::inotify_add_watch() failed, " + directory);
+    }
+    watchDirectories.insert_or_assign(watchDescriptor, directory);
+
+    // NOTE: inotify does not watch subdirectories, so each of them is watched separately.
+    auto dir = ::opendir(directory.c_str());
+    if (dir == nullptr) {
+        return Errors::New(ToErrc(errno), "::opendir() failed, " + directory);
+    }
+
+    std::shared_ptr<Error> err;
+    while (auto entry = ::readdir(dir)) {
+        if ((entry->d_type != DT_DIR) ||
+            (std::strcmp(entry->d_name, ".") == 0) ||
+            (std::strcmp(entry->d_name, "..") == 0)) {
+            continue;
+        }
+        if (err = AddWatch(PathHelper::Join(directory, entry->d_name)); err != nullptr) {
+            break;
+        }
+    }
+    ::closedir(dir);
+
+    return err;
+}
+
+void FileWatcherLinux::Poll(std::vector<std::string>& changedFilePaths)
+{
+    if (inotifyDescriptor == -1) {
+        return;
+    }
+
+    for (;;) {
+        const auto readSize = ::read(inotifyDescriptor, eventBuffer.data(), eventBuffer.size());
+        if (readSize <= 0) {
+            // NOTE: EAGAIN means that no events are left.
+            break;
+        }
+
+        for (ssize_t offset = 0; offset < readSize;) {
+            const auto event = reinterpret_cast<const struct inotify_event*>(eventBuffer.data() + offset);
+            offset += sizeof(struct inotify_event) + event->len;
+
+            auto iter = watchDirectories.find(event->wd);
+            if (iter == std::end(watchDirectories)) {
+                continue;
+            }
+
+            if ((event->mask & IN_IGNORED) != 0) {
+                // NOTE: The directory was removed.
+                watchDirectories.erase(iter);
+                continue;
+            }
+
+            if (event->len == 0) {
+                continue;
+            }
+
+            auto path = PathHelper::Join(iter->second, event->name);
+            if ((event->mask & IN_ISDIR) != 0) {
+                // NOTE: The files created in a new directory before it is
+                // watched are not reported.
+                if ((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0) {
+                    [[maybe_unused]] auto err = AddWatch(path);
+                }
+                continue;
+            }
+
+            if ((event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) != 0) {
+                changedFilePaths.push_back(std::move(path));
+            }
+        }
+    }
+}
+
+} // namespace Pomdog::Detail::Linux
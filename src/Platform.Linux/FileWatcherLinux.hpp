@@ -0,0 +1,41 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Utility/Errors.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Pomdog::Detail::Linux {
+
+/// Watches a directory and its subdirectories for modified files with inotify.
+class FileWatcherLinux final {
+public:
+    FileWatcherLinux() = default;
+
+    FileWatcherLinux(const FileWatcherLinux&) = delete;
+    FileWatcherLinux& operator=(const FileWatcherLinux&) = delete;
+
+    ~FileWatcherLinux();
+
+    /// Starts watching the directory.
+    [[nodiscard]] std::shared_ptr<Error>
+    Watch(const std::string& directory);
+
+    /// Appends the paths to the files that were written or moved into the
+    /// watched directories since the last call. This does not block.
+    void Poll(std::vector<std::string>& changedFilePaths);
+
+private:
+    [[nodiscard]] std::shared_ptr<Error>
+    AddWatch(const std::string& directory);
+
+private:
+    std::unordered_map<int, std::string> watchDirectories;
+    std::vector<char> eventBuffer;
+    int inotifyDescriptor = -1;
+};
+
+} // namespace Pomdog::Detail::Linux
@@ -3,8 +3,8 @@
 #include "Texture2DDirect3D11.hpp"
 #include "../RenderSystem.DXGI/DXGIFormatHelper.hpp"
 #include "../RenderSystem/SurfaceFormatHelper.hpp"
-#include "../RenderSystem/TextureHelper.hpp"
 #include "Pomdog/Graphics/SurfaceFormat.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 #include "Pomdog/Utility/Exception.hpp"
 #include <algorithm>
@@ -12,53 +12,39 @@
 namespace Pomdog::Detail::Direct3D11 {
 namespace {
 
-void LoadPixelData(
-    void* output,
-    const void* input,
-    std::int32_t width,
-    std::int32_t height,
-    std::int32_t levelCount,
-    SurfaceFormat format)
+bool IsBlockCompressed(SurfaceFormat format) noexcept
 {
-    std::size_t sizeInBytes = TextureHelper::ComputeTextureSizeInBytes(
-        width, height, levelCount, format);
-
-    POMDOG_ASSERT(input != nullptr);
-    POMDOG_ASSERT(sizeInBytes > 0);
-
-    std::memcpy(output, input, sizeInBytes);
+    switch (format) {
+    case SurfaceFormat::BlockComp1_UNorm:
+    case SurfaceFormat::BlockComp2_UNorm:
+    case SurfaceFormat::BlockComp3_UNorm:
+        return true;
+    default:
+        break;
+    }
+    return false;
 }
 
-void LoadPixelDataWithStride(
-    void* output,
-    const void* input,
-    std::int32_t height,
-    std::size_t outputRowPitch,
-    std::size_t inputRowPitch)
+UINT ComputeRowPitch(std::int32_t width, SurfaceFormat format) noexcept
 {
-    for (int y = 0; y < height; y++) {
-        auto dst = reinterpret_cast<std::uint8_t*>(output) + y * outputRowPitch;
-        auto src = reinterpret_cast<const std::uint8_t*>(input) + y * inputRowPitch;
-        std::memcpy(dst, src, inputRowPitch);
+    switch (format) {
+    case SurfaceFormat::BlockComp1_UNorm:
+        return static_cast<UINT>(8 * ((width + 3) / 4));
+    case SurfaceFormat::BlockComp2_UNorm:
+    case SurfaceFormat::BlockComp3_UNorm:
+        return static_cast<UINT>(16 * ((width + 3) / 4));
+    default:
+        break;
     }
+    return static_cast<UINT>(width * SurfaceFormatHelper::ToBytesPerBlock(format));
 }
 
-void LoadPixelDataBlockComp1(
-    void* output,
-    const void* input,
-    std::int32_t width,
-    std::int32_t height,
-    std::size_t outputRowPitch)
+UINT ComputeRowCount(std::int32_t height, SurfaceFormat format) noexcept
 {
-    const auto bytesPerRow = static_cast<std::size_t>(8 * (std::max(width, 4) / 4));
-
-    for (int y = 0; y < height / 4; y++) {
-        auto dst = reinterpret_cast<std::uint8_t*>(output) + y * outputRowPitch;
-        auto src = reinterpret_cast<const std::uint8_t*>(input) + y * bytesPerRow;
-        for (int x = 0; x < width / 4; x++) {
-            std::memcpy(dst, src, bytesPerRow);
-        }
+    if (IsBlockCompressed(format)) {
+        return static_cast<UINT>((height + 3) / 4);
     }
+    return static_cast<UINT>(height);
 }
 
 } // namespace
@@ -86,9 +72,12 @@ Texture2DDirect3D11::Texture2DDirect3D11(
     textureDesc.MipLevels = levelCount;
     textureDesc.SampleDesc.Count = 1;
     textureDesc.SampleDesc.Quality = 0;
-    textureDesc.Usage = D3D11_USAGE_DYNAMIC;
+    // NOTE: A dynamic texture can only be updated as a whole with
+    // D3D11_MAP_WRITE_DISCARD, so the default usage is used to allow
+    // updating sub-regions with UpdateSubresource().
+    textureDesc.Usage = D3D11_USAGE_DEFAULT;
     textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-    textureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    textureDesc.CPUAccessFlags = 0;
     textureDesc.MiscFlags = 0;
 
     auto hr = device->CreateTexture2D(&textureDesc, nullptr, &texture2D);
@@ -137,46 +126,68 @@ void Texture2DDirect3D11::SetData(
 
     POMDOG_ASSERT(deviceContext != nullptr);
 
-    // NOTE: Map the texture
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
-    auto hr = deviceContext->Map(texture2D.Get(), 0,
-        D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-
-    if (FAILED(hr)) {
-        // FUS RO DAH!
-        POMDOG_THROW_EXCEPTION(std::runtime_error, "Failed to map buffer");
+    auto mipmapWidth = pixelWidth;
+    auto mipmapHeight = pixelHeight;
+    std::size_t startOffset = 0;
+
+    for (std::int32_t mipmapLevel = 0; mipmapLevel < levelCount; ++mipmapLevel) {
+        const auto rowPitch = ComputeRowPitch(mipmapWidth, format);
+        const auto depthPitch = rowPitch * ComputeRowCount(mipmapHeight, format);
+
+        deviceContext->UpdateSubresource(
+            texture2D.Get(),
+            D3D11CalcSubresource(mipmapLevel, 0, levelCount),
+            nullptr,
+            reinterpret_cast<const std::uint8_t*>(pixelData) + startOffset,
+            rowPitch,
+            depthPitch);
+
+        startOffset += depthPitch;
+        mipmapWidth = std::max((mipmapWidth >> 1), 1);
+        mipmapHeight = std::max((mipmapHeight >> 1), 1);
     }
+}
 
-    const auto inputRowPitch = static_cast<UINT>(pixelWidth * SurfaceFormatHelper::ToBytesPerBlock(format));
-    if (inputRowPitch == mappedResource.RowPitch) {
-        LoadPixelData(mappedResource.pData, pixelData, pixelWidth, pixelHeight, levelCount, format);
-    }
-    else {
-        switch (format) {
-        case SurfaceFormat::R8_UNorm:
-        case SurfaceFormat::R8G8_UNorm:
-        case SurfaceFormat::R8G8B8A8_UNorm:
-            LoadPixelDataWithStride(mappedResource.pData, pixelData, pixelHeight, mappedResource.RowPitch, inputRowPitch);
-            break;
-        case SurfaceFormat::BlockComp1_UNorm:
-            LoadPixelDataBlockComp1(mappedResource.pData, pixelData, pixelWidth, pixelHeight, mappedResource.RowPitch);
-            break;
-        case SurfaceFormat::A8_UNorm:
-        case SurfaceFormat::B8G8R8A8_UNorm:
-        case SurfaceFormat::R10G10B10A2_UNorm:
-        case SurfaceFormat::R11G11B10_Float:
-        case SurfaceFormat::R16G16_Float:
-        case SurfaceFormat::R16G16B16A16_Float:
-        case SurfaceFormat::R32_Float:
-        case SurfaceFormat::R32G32B32A32_Float:
-        case SurfaceFormat::BlockComp2_UNorm:
-        case SurfaceFormat::BlockComp3_UNorm:
-            LoadPixelData(mappedResource.pData, pixelData, pixelWidth, pixelHeight, levelCount, format);
-            break;
-        }
-    }
+void Texture2DDirect3D11::SetData(
+    const Rectangle& region,
+    std::int32_t mipLevel,
+    SurfaceFormat format,
+    const void* pixelData)
+{
+    POMDOG_ASSERT(texture2D);
+    POMDOG_ASSERT(region.Width > 0);
+    POMDOG_ASSERT(region.Height > 0);
+    POMDOG_ASSERT(mipLevel >= 0);
+    POMDOG_ASSERT(pixelData != nullptr);
+    POMDOG_ASSERT(!IsBlockCompressed(format));
+
+    // NOTE: Get the device context
+    ComPtr<ID3D11Device> device;
+    texture2D->GetDevice(&device);
+    ComPtr<ID3D11DeviceContext> deviceContext;
+    device->GetImmediateContext(&deviceContext);
+
+    POMDOG_ASSERT(deviceContext != nullptr);
 
-    deviceContext->Unmap(texture2D.Get(), 0);
+    D3D11_BOX box;
+    box.left = static_cast<UINT>(region.X);
+    box.top = static_cast<UINT>(region.Y);
+    box.front = 0;
+    box.right = static_cast<UINT>(region.X + region.Width);
+    box.bottom = static_cast<UINT>(region.Y + region.Height);
+    box.back = 1;
+
+    const auto rowPitch = ComputeRowPitch(region.Width, format);
+
+    // NOTE: The subresource index of the mipmap level in the first array slice
+    // is equal to the mipmap level.
+    deviceContext->UpdateSubresource(
+        texture2D.Get(),
+        static_cast<UINT>(mipLevel),
+        &box,
+        pixelData,
+        rowPitch,
+        rowPitch * static_cast<UINT>(region.Height));
 }
 
 ID3D11ShaderResourceView* Texture2DDirect3D11::GetShaderResourceView() const
@@ -25,6 +25,12 @@ public:
         SurfaceFormat format,
         const void* pixelData) override;
 
+    void SetData(
+        const Rectangle& region,
+        std::int32_t mipLevel,
+        SurfaceFormat format,
+        const void* pixelData) override;
+
     ID3D11ShaderResourceView* GetShaderResourceView() const;
 
 private:
@@ -7,6 +7,7 @@
 #include "../RenderSystem/SurfaceFormatHelper.hpp"
 #include "../Utility/ScopeGuard.hpp"
 #include "Pomdog/Graphics/SurfaceFormat.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 #include <algorithm>
 
@@ -335,6 +336,47 @@ void Texture2DGL4::SetData(std::int32_t pixelWidth, std::int32_t pixelHeight,
     }
 }
 
+void Texture2DGL4::SetData(
+    const Rectangle& region,
+    std::int32_t mipLevel,
+    SurfaceFormat format,
+    const void* pixelData)
+{
+    POMDOG_ASSERT(region.Width > 0);
+    POMDOG_ASSERT(region.Height > 0);
+    POMDOG_ASSERT(mipLevel >= 0);
+    POMDOG_ASSERT(pixelData != nullptr);
+    POMDOG_ASSERT(format != SurfaceFormat::BlockComp1_UNorm
+        && format != SurfaceFormat::BlockComp2_UNorm
+        && format != SurfaceFormat::BlockComp3_UNorm);
+
+    const auto oldTexture = TypesafeHelperGL4::Get<Texture2DObjectGL4>();
+    ScopeGuard scope([&] { TypesafeHelperGL4::BindTexture(oldTexture); });
+
+    POMDOG_ASSERT(textureObject);
+    TypesafeHelperGL4::BindTexture(*textureObject);
+    POMDOG_CHECK_ERROR_GL4("glBindTexture");
+
+    // NOTE: The rows of the region are tightly packed, so their size in bytes
+    // is not necessarily a multiple of the default unpack alignment (4).
+    GLint oldUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glTexSubImage2D(GL_TEXTURE_2D,
+        mipLevel,
+        region.X,
+        region.Y,
+        region.Width,
+        region.Height,
+        ToFormatComponents(format),
+        ToPixelFundamentalType(format),
+        pixelData);
+    POMDOG_CHECK_ERROR_GL4("glTexSubImage2D");
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment);
+}
+
 void Texture2DGL4::GenerateMipmap()
 {
     POMDOG_ASSERT(textureObject);
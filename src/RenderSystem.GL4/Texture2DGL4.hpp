@@ -38,6 +38,12 @@ public:
         SurfaceFormat format,
         const void* pixelData) override;
 
+    void SetData(
+        const Rectangle& region,
+        std::int32_t mipLevel,
+        SurfaceFormat format,
+        const void* pixelData) override;
+
     void GenerateMipmap();
 
     const Texture2DObjectGL4& GetTextureHandle() const;
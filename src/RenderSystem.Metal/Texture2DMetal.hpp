@@ -24,6 +24,12 @@ public:
         SurfaceFormat format,
         const void* pixelData) override;
 
+    void SetData(
+        const Rectangle& region,
+        std::int32_t mipLevel,
+        SurfaceFormat format,
+        const void* pixelData) override;
+
     id<MTLTexture> GetTexture() const noexcept;
 
 private:
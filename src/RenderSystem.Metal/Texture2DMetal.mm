@@ -5,6 +5,7 @@
 #include "../RenderSystem/SurfaceFormatHelper.hpp"
 #include "../RenderSystem/TextureHelper.hpp"
 #include "Pomdog/Graphics/SurfaceFormat.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
 #include "Pomdog/Utility/Assert.hpp"
 #include "Pomdog/Utility/Exception.hpp"
 #include <algorithm>
@@ -93,6 +94,31 @@ void Texture2DMetal::SetData(
     }
 }
 
+void Texture2DMetal::SetData(
+    const Rectangle& region,
+    std::int32_t mipLevel,
+    SurfaceFormat format,
+    const void* pixelData)
+{
+    POMDOG_ASSERT(texture != nil);
+    POMDOG_ASSERT(region.Width > 0);
+    POMDOG_ASSERT(region.Height > 0);
+    POMDOG_ASSERT(mipLevel >= 0);
+    POMDOG_ASSERT(pixelData != nullptr);
+    POMDOG_ASSERT(format != SurfaceFormat::BlockComp1_UNorm
+        && format != SurfaceFormat::BlockComp2_UNorm
+        && format != SurfaceFormat::BlockComp3_UNorm);
+
+    auto const bytesPerPixel = SurfaceFormatHelper::ToBytesPerBlock(format);
+
+    MTLRegion textureRegion = MTLRegionMake2D(region.X, region.Y, region.Width, region.Height);
+
+    [texture replaceRegion:textureRegion
+        mipmapLevel:mipLevel
+        withBytes:pixelData
+        bytesPerRow:region.Width * bytesPerPixel];
+}
+
 id<MTLTexture> Texture2DMetal::GetTexture() const noexcept
 {
     return texture;
@@ -124,4 +124,16 @@ void Texture2DVulkan::SetData(
     POMDOG_ASSERT(pixelData != nullptr);
 }
 
+void Texture2DVulkan::SetData(
+    [[maybe_unused]] const Rectangle& region,
+    [[maybe_unused]] std::int32_t mipLevel,
+    [[maybe_unused]] SurfaceFormat format,
+    [[maybe_unused]] const void* pixelData)
+{
+    POMDOG_ASSERT(mipLevel >= 0);
+    POMDOG_ASSERT(pixelData != nullptr);
+
+    // FIXME: Not implemented yet.
+}
+
 } // namespace Pomdog::Detail::Vulkan
@@ -27,6 +27,12 @@ public:
         SurfaceFormat format,
         const void* pixelData) override;
 
+    void SetData(
+        const Rectangle& region,
+        std::int32_t mipLevel,
+        SurfaceFormat format,
+        const void* pixelData) override;
+
 private:
     ::VkDevice device;
     ::VkImage image;
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Pomdog/Graphics/detail/ForwardDeclarations.hpp"
+#include "Pomdog/Math/detail/ForwardDeclarations.hpp"
 #include <cstdint>
 
 namespace Pomdog::Detail {
@@ -21,6 +22,13 @@ public:
         std::int32_t levelCount,
         SurfaceFormat format,
         const void* pixelData) = 0;
+
+    /// Sets the pixel data of the region in the mipmap level.
+    virtual void SetData(
+        const Rectangle& region,
+        std::int32_t mipLevel,
+        SurfaceFormat format,
+        const void* pixelData) = 0;
 };
 
 } // namespace Pomdog::Detail
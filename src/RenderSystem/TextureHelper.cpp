@@ -45,11 +45,11 @@ std::int32_t TextureHelper::ComputeTextureSizeInBytes(
         auto bytesPerRow = mipmapWidth * bytesPerBlock;
         switch (format) {
         case SurfaceFormat::BlockComp1_UNorm:
-            bytesPerRow = 8 * (std::max(mipmapWidth, 4) / 4);
+            bytesPerRow = 8 * ((mipmapWidth + 3) / 4);
             break;
         case SurfaceFormat::BlockComp2_UNorm:
         case SurfaceFormat::BlockComp3_UNorm:
-            bytesPerRow = 16 * (std::max(mipmapWidth, 4) / 4);
+            bytesPerRow = 16 * ((mipmapWidth + 3) / 4);
             break;
         default:
             break;
@@ -60,7 +60,8 @@ std::int32_t TextureHelper::ComputeTextureSizeInBytes(
         case SurfaceFormat::BlockComp1_UNorm:
         case SurfaceFormat::BlockComp2_UNorm:
         case SurfaceFormat::BlockComp3_UNorm:
-            strideBytesPerMipmap = bytesPerRow * (std::max(mipmapHeight, 4) / 4);
+            // NOTE: Partial blocks at the edges are stored as whole blocks.
+            strideBytesPerMipmap = bytesPerRow * ((mipmapHeight + 3) / 4);
             break;
         default:
             break;
@@ -0,0 +1,315 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "StreamingAudioSourceAL.hpp"
+#include "ErrorCheckerAL.hpp"
+#include "Pomdog/Audio/AudioStream.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace Pomdog::Detail::SoundSystem::OpenAL {
+namespace {
+
+// NOTE: Each buffer holds 250 milliseconds of audio, so the source has
+// a second of audio queued ahead of the playback position.
+constexpr std::size_t BuffersPerSecond = 4;
+
+// NOTE: The buffers are refilled well before the queued audio runs out.
+constexpr auto UpdateInterval = std::chrono::milliseconds(50);
+
+ALenum ToFormat(AudioChannels channels)
+{
+    switch (channels) {
+    case AudioChannels::Mono:
+        return AL_FORMAT_MONO16;
+    case AudioChannels::Stereo:
+        return AL_FORMAT_STEREO16;
+    }
+
+    POMDOG_ASSERT(false);
+    return AL_FORMAT_MONO16;
+}
+
+} // unnamed namespace
+
+StreamingAudioSourceAL::StreamingAudioSourceAL(
+    AudioEngineAL&,
+    std::unique_ptr<AudioStream>&& audioStream,
+    bool isLoopedIn)
+    : stream(std::move(audioStream))
+    , isLooped(isLoopedIn)
+{
+    POMDOG_ASSERT(stream != nullptr);
+    POMDOG_ASSERT(stream->GetSampleRate() > 0);
+
+    format = ToFormat(stream->GetChannels());
+    framesPerBuffer = std::max<std::size_t>(static_cast<std::size_t>(stream->GetSampleRate()) / BuffersPerSecond, 1);
+    samples.resize(framesPerBuffer * static_cast<std::size_t>(stream->GetChannels()));
+
+    alGenSources(1, &source);
+
+#ifdef DEBUG
+    ErrorCheckerAL::CheckError("alGenSources", __FILE__, __LINE__);
+#endif
+
+    alGenBuffers(static_cast<ALsizei>(buffers.size()), buffers.data());
+
+#ifdef DEBUG
+    ErrorCheckerAL::CheckError("alGenBuffers", __FILE__, __LINE__);
+#endif
+
+    // NOTE: The OpenAL context is current for the whole process, so the
+    // buffers can be queued from the streaming thread.
+    thread = std::thread([this] { Run(); });
+}
+
+StreamingAudioSourceAL::~StreamingAudioSourceAL()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isShutdown = true;
+    }
+    condition.notify_all();
+
+    if (thread.joinable()) {
+        thread.join();
+    }
+
+    UnqueueBuffers();
+    alDeleteSources(1, &source);
+    alDeleteBuffers(static_cast<ALsizei>(buffers.size()), buffers.data());
+}
+
+void StreamingAudioSourceAL::Pause()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (state != SoundState::Playing) {
+        return;
+    }
+
+    alSourcePause(source);
+
+#ifdef DEBUG
+    ErrorCheckerAL::CheckError("alSourcePause", __FILE__, __LINE__);
+#endif
+
+    state = SoundState::Paused;
+}
+
+void StreamingAudioSourceAL::Play()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (state == SoundState::Playing) {
+        return;
+    }
+
+    if (state == SoundState::Stopped) {
+        QueueBuffers();
+    }
+
+    alSourcePlay(source);
+
+#ifdef DEBUG
+    ErrorCheckerAL::CheckError("alSourcePlay", __FILE__, __LINE__);
+#endif
+
+    state = SoundState::Playing;
+}
+
+void StreamingAudioSourceAL::Stop()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (state == SoundState::Stopped) {
+        return;
+    }
+
+    UnqueueBuffers();
+    Rewind();
+    state = SoundState::Stopped;
+}
+
+void StreamingAudioSourceAL::Seek(const Duration& position)
+{
+    POMDOG_ASSERT(position.count() >= 0.0);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // NOTE: The audio queued from the previous position is discarded.
+    UnqueueBuffers();
+
+    // NOTE: A position at the end of the audio must not be rounded past the last frame.
+    const auto frame = std::min(
+        static_cast<std::size_t>(position.count() * stream->GetSampleRate()),
+        stream->GetFrameCount());
+    if (stream->Seek(frame)) {
+        isEndOfStream = false;
+    }
+    else {
+        Rewind();
+    }
+
+    // NOTE: A stopped source decodes from the new position when it is played.
+    if (state == SoundState::Stopped) {
+        return;
+    }
+
+    QueueBuffers();
+    if (state == SoundState::Playing) {
+        alSourcePlay(source);
+    }
+}
+
+void StreamingAudioSourceAL::ExitLoop()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    isLooped = false;
+}
+
+SoundState StreamingAudioSourceAL::GetState() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return state;
+}
+
+void StreamingAudioSourceAL::SetPitch(float pitch)
+{
+    // pitch --> nativePitch
+    //  0.0f --> 1.0f
+    // -1.0f --> 0.5f
+    // +1.0f --> 1.5f
+    auto nativePitch = 1.0f + (0.5f * pitch);
+
+    POMDOG_ASSERT(nativePitch > 0.0f);
+    alSourcef(source, AL_PITCH, nativePitch);
+
+#ifdef DEBUG
+    ErrorCheckerAL::CheckError("alSourcef", __FILE__, __LINE__);
+#endif
+}
+
+void StreamingAudioSourceAL::SetVolume(float volume)
+{
+    POMDOG_ASSERT(volume >= 0.0f);
+    alSourcef(source, AL_GAIN, volume);
+
+#ifdef DEBUG
+    ErrorCheckerAL::CheckError("alSourcef", __FILE__, __LINE__);
+#endif
+}
+
+void StreamingAudioSourceAL::Run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!isShutdown) {
+        if (state == SoundState::Playing) {
+            UpdateBuffers();
+        }
+        condition.wait_for(lock, UpdateInterval, [this] { return isShutdown; });
+    }
+}
+
+void StreamingAudioSourceAL::UpdateBuffers()
+{
+    ALint processed = 0;
+    alGetSourcei(source, AL_BUFFERS_PROCESSED, &processed);
+
+    for (; processed > 0; --processed) {
+        ALuint buffer = 0;
+        alSourceUnqueueBuffers(source, 1, &buffer);
+        if (FillBuffer(buffer)) {
+            alSourceQueueBuffers(source, 1, &buffer);
+        }
+    }
+
+    ALint sourceState = AL_STOPPED;
+    alGetSourcei(source, AL_SOURCE_STATE, &sourceState);
+    if (sourceState == AL_PLAYING) {
+        return;
+    }
+
+    ALint queued = 0;
+    alGetSourcei(source, AL_BUFFERS_QUEUED, &queued);
+    if (queued > 0) {
+        // NOTE: The source stops by itself if it plays all the queued audio
+        // before the buffers are refilled, so it is restarted.
+        alSourcePlay(source);
+        return;
+    }
+
+    // NOTE: The source has played to the end of the stream.
+    Rewind();
+    state = SoundState::Stopped;
+}
+
+void StreamingAudioSourceAL::QueueBuffers()
+{
+    for (auto buffer : buffers) {
+        if (!FillBuffer(buffer)) {
+            break;
+        }
+        alSourceQueueBuffers(source, 1, &buffer);
+    }
+
+#ifdef DEBUG
+    ErrorCheckerAL::CheckError("alSourceQueueBuffers", __FILE__, __LINE__);
+#endif
+}
+
+void StreamingAudioSourceAL::UnqueueBuffers()
+{
+    // NOTE: Stopping the source marks all of its buffers as processed,
+    // so that they can be detached at once.
+    alSourceStop(source);
+    alSourcei(source, AL_BUFFER, 0);
+
+#ifdef DEBUG
+    ErrorCheckerAL::CheckError("alSourcei", __FILE__, __LINE__);
+#endif
+}
+
+void StreamingAudioSourceAL::Rewind()
+{
+    // NOTE: A stream that cannot be rewound is not played again.
+    isEndOfStream = !stream->Seek(0);
+}
+
+bool StreamingAudioSourceAL::FillBuffer(ALuint buffer)
+{
+    if (isEndOfStream) {
+        return false;
+    }
+
+    const auto channelCount = static_cast<std::size_t>(stream->GetChannels());
+
+    std::size_t frameCount = 0;
+    bool isRewound = false;
+    while (frameCount < framesPerBuffer) {
+        const auto count = stream->Read(
+            samples.data() + frameCount * channelCount,
+            framesPerBuffer - frameCount);
+
+        if (count > 0) {
+            frameCount += count;
+            isRewound = false;
+            continue;
+        }
+
+        // NOTE: An empty stream would be rewound forever.
+        if (!isLooped || isRewound || !stream->Seek(0)) {
+            isEndOfStream = true;
+            break;
+        }
+        isRewound = true;
+    }
+
+    if (frameCount == 0) {
+        return false;
+    }
+
+    const auto byteLength = frameCount * channelCount * sizeof(std::int16_t);
+    alBufferData(buffer, format, samples.data(), static_cast<ALsizei>(byteLength), stream->GetSampleRate());
+    return true;
+}
+
+} // namespace Pomdog::Detail::SoundSystem::OpenAL
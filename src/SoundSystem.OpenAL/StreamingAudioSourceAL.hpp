@@ -0,0 +1,85 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "PrerequisitesOpenAL.hpp"
+#include "Pomdog/Application/Duration.hpp"
+#include "Pomdog/Audio/SoundState.hpp"
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Pomdog {
+class AudioStream;
+} // namespace Pomdog
+
+namespace Pomdog::Detail::SoundSystem::OpenAL {
+
+class AudioEngineAL;
+
+class StreamingAudioSourceAL final {
+public:
+    StreamingAudioSourceAL(
+        AudioEngineAL& audioEngine,
+        std::unique_ptr<AudioStream>&& audioStream,
+        bool isLooped);
+
+    StreamingAudioSourceAL(const StreamingAudioSourceAL&) = delete;
+    StreamingAudioSourceAL& operator=(const StreamingAudioSourceAL&) = delete;
+
+    ~StreamingAudioSourceAL();
+
+    void Pause();
+
+    void Play();
+
+    void Stop();
+
+    void Seek(const Duration& position);
+
+    void ExitLoop();
+
+    SoundState GetState() const;
+
+    void SetPitch(float pitch);
+
+    void SetVolume(float volume);
+
+private:
+    static constexpr std::size_t BufferCount = 4;
+
+    void Run();
+
+    void UpdateBuffers();
+
+    void QueueBuffers();
+
+    void UnqueueBuffers();
+
+    void Rewind();
+
+    [[nodiscard]] bool FillBuffer(ALuint buffer);
+
+private:
+    std::unique_ptr<AudioStream> stream;
+    std::vector<std::int16_t> samples;
+    std::array<ALuint, BufferCount> buffers;
+    ALuint source = 0;
+    ALenum format = AL_FORMAT_STEREO16;
+    std::size_t framesPerBuffer = 0;
+
+    std::thread thread;
+    mutable std::mutex mutex;
+    std::condition_variable condition;
+    SoundState state = SoundState::Stopped;
+    bool isLooped = false;
+    bool isEndOfStream = false;
+    bool isShutdown = false;
+};
+
+} // namespace Pomdog::Detail::SoundSystem::OpenAL
@@ -0,0 +1,302 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "StreamingAudioSourceXAudio2.hpp"
+#include "AudioEngineXAudio2.hpp"
+#include "Pomdog/Audio/AudioStream.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+#include "Pomdog/Utility/Exception.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <utility>
+
+namespace Pomdog::Detail::SoundSystem::XAudio2 {
+namespace {
+
+// NOTE: Each buffer holds 250 milliseconds of audio.
+constexpr std::size_t BuffersPerSecond = 4;
+
+constexpr auto UpdateInterval = std::chrono::milliseconds(50);
+
+[[nodiscard]] WAVEFORMATEX ToWaveFormat(const AudioStream& stream) noexcept
+{
+    constexpr WORD bitsPerSample = 16;
+    const auto channels = static_cast<WORD>(stream.GetChannels());
+    const auto blockAlign = static_cast<WORD>((channels * bitsPerSample) / 8);
+
+    WAVEFORMATEX waveFormat;
+    waveFormat.wFormatTag = WAVE_FORMAT_PCM;
+    waveFormat.nChannels = channels;
+    waveFormat.nSamplesPerSec = static_cast<DWORD>(stream.GetSampleRate());
+    waveFormat.nAvgBytesPerSec = waveFormat.nSamplesPerSec * blockAlign;
+    waveFormat.nBlockAlign = blockAlign;
+    waveFormat.wBitsPerSample = bitsPerSample;
+    waveFormat.cbSize = 0;
+    return waveFormat;
+}
+
+} // unnamed namespace
+
+StreamingAudioSourceXAudio2::StreamingAudioSourceXAudio2(
+    AudioEngineXAudio2& audioEngine,
+    std::unique_ptr<AudioStream>&& audioStream,
+    bool isLoopedIn)
+    : stream(std::move(audioStream))
+    , isLooped(isLoopedIn)
+{
+    POMDOG_ASSERT(stream != nullptr);
+    POMDOG_ASSERT(stream->GetSampleRate() > 0);
+
+    auto xAudio2 = audioEngine.XAudio2Engine();
+    POMDOG_ASSERT(xAudio2);
+
+    const auto waveFormat = ToWaveFormat(*stream);
+    HRESULT hr = xAudio2->CreateSourceVoice(&sourceVoice, &waveFormat);
+    if (FAILED(hr)) {
+        POMDOG_THROW_EXCEPTION(std::runtime_error,
+            "Failed to call CreateSourceVoice, HRESULT=" + std::to_string(hr));
+    }
+
+    framesPerBuffer = std::max<std::size_t>(static_cast<std::size_t>(stream->GetSampleRate()) / BuffersPerSecond, 1);
+    for (auto& buffer : buffers) {
+        buffer.resize(framesPerBuffer * static_cast<std::size_t>(stream->GetChannels()));
+    }
+
+    thread = std::thread([this] { Run(); });
+}
+
+StreamingAudioSourceXAudio2::~StreamingAudioSourceXAudio2()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isShutdown = true;
+    }
+    condition.notify_all();
+
+    if (thread.joinable()) {
+        thread.join();
+    }
+
+    if (sourceVoice != nullptr) {
+        // NOTE: DestroyVoice() waits until the voice stops reading the buffers.
+        sourceVoice->Stop();
+        sourceVoice->FlushSourceBuffers();
+        sourceVoice->DestroyVoice();
+        sourceVoice = nullptr;
+    }
+}
+
+void StreamingAudioSourceXAudio2::Pause()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (state != SoundState::Playing) {
+        return;
+    }
+
+    POMDOG_ASSERT(sourceVoice);
+    sourceVoice->Stop();
+    state = SoundState::Paused;
+}
+
+void StreamingAudioSourceXAudio2::Play()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (state == SoundState::Playing) {
+        return;
+    }
+
+    if (state == SoundState::Stopped) {
+        QueueBuffers();
+    }
+
+    POMDOG_ASSERT(sourceVoice);
+    sourceVoice->Start();
+    state = SoundState::Playing;
+}
+
+void StreamingAudioSourceXAudio2::Stop()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (state == SoundState::Stopped) {
+        return;
+    }
+
+    POMDOG_ASSERT(sourceVoice);
+    sourceVoice->Stop();
+    sourceVoice->FlushSourceBuffers();
+    Rewind();
+    state = SoundState::Stopped;
+}
+
+void StreamingAudioSourceXAudio2::Seek(const Duration& position)
+{
+    POMDOG_ASSERT(position.count() >= 0.0);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // NOTE: The audio submitted from the previous position is discarded.
+    POMDOG_ASSERT(sourceVoice);
+    sourceVoice->Stop();
+    sourceVoice->FlushSourceBuffers();
+
+    // NOTE: A position at the end of the audio must not be rounded past the last frame.
+    const auto frame = std::min(
+        static_cast<std::size_t>(position.count() * stream->GetSampleRate()),
+        stream->GetFrameCount());
+    if (stream->Seek(frame)) {
+        isEndOfStream = false;
+    }
+    else {
+        Rewind();
+    }
+
+    if (state == SoundState::Stopped) {
+        return;
+    }
+
+    QueueBuffers();
+    if (state == SoundState::Playing) {
+        sourceVoice->Start();
+    }
+}
+
+void StreamingAudioSourceXAudio2::ExitLoop()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    isLooped = false;
+}
+
+SoundState StreamingAudioSourceXAudio2::GetState() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return state;
+}
+
+void StreamingAudioSourceXAudio2::SetPitch(float pitch)
+{
+    POMDOG_ASSERT(sourceVoice);
+    POMDOG_ASSERT(!std::isnan(pitch));
+    POMDOG_ASSERT(pitch <= 1.0f);
+    POMDOG_ASSERT(pitch >= -1.0f);
+
+    // pitch --> nativePitch
+    // +1.0f --> 2.0f (up one octave)
+    //  0.0f --> 1.0f (normal)
+    // -1.0f --> 0.5f (down one octave)
+
+    auto nativePitch = std::pow(2.0f, pitch);
+
+    sourceVoice->SetFrequencyRatio(nativePitch);
+}
+
+void StreamingAudioSourceXAudio2::SetVolume(float volume)
+{
+    POMDOG_ASSERT(sourceVoice);
+    POMDOG_ASSERT(volume <= 1.0f);
+    POMDOG_ASSERT(volume >= 0.0f);
+
+    sourceVoice->SetVolume(volume);
+}
+
+void StreamingAudioSourceXAudio2::Run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!isShutdown) {
+        if (state == SoundState::Playing) {
+            UpdateBuffers();
+        }
+        condition.wait_for(lock, UpdateInterval, [this] { return isShutdown; });
+    }
+}
+
+void StreamingAudioSourceXAudio2::UpdateBuffers()
+{
+    POMDOG_ASSERT(sourceVoice);
+
+    XAUDIO2_VOICE_STATE voiceState;
+    sourceVoice->GetState(&voiceState, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+
+    // NOTE: The voice reads the buffers in the order that they are submitted,
+    // so the next buffer in the ring is no longer read while fewer than
+    // BufferCount buffers are queued.
+    auto queued = static_cast<std::size_t>(voiceState.BuffersQueued);
+    for (; queued < BufferCount; ++queued) {
+        if (!SubmitBuffer()) {
+            break;
+        }
+    }
+
+    if (queued == 0) {
+        // NOTE: The voice has played to the end of the stream.
+        sourceVoice->Stop();
+        Rewind();
+        state = SoundState::Stopped;
+    }
+}
+
+void StreamingAudioSourceXAudio2::QueueBuffers()
+{
+    for (std::size_t i = 0; i < BufferCount; ++i) {
+        if (!SubmitBuffer()) {
+            break;
+        }
+    }
+}
+
+void StreamingAudioSourceXAudio2::Rewind()
+{
+    // NOTE: A stream that cannot be rewound is not played again.
+    isEndOfStream = !stream->Seek(0);
+}
+
+bool StreamingAudioSourceXAudio2::SubmitBuffer()
+{
+    if (isEndOfStream) {
+        return false;
+    }
+
+    auto& samples = buffers[nextBuffer];
+    const auto channelCount = static_cast<std::size_t>(stream->GetChannels());
+
+    std::size_t frameCount = 0;
+    bool isRewound = false;
+    while (frameCount < framesPerBuffer) {
+        const auto count = stream->Read(
+            samples.data() + frameCount * channelCount,
+            framesPerBuffer - frameCount);
+
+        if (count > 0) {
+            frameCount += count;
+            isRewound = false;
+            continue;
+        }
+
+        // NOTE: An empty stream would be rewound forever.
+        if (!isLooped || isRewound || !stream->Seek(0)) {
+            isEndOfStream = true;
+            break;
+        }
+        isRewound = true;
+    }
+
+    if (frameCount == 0) {
+        return false;
+    }
+
+    XAUDIO2_BUFFER bufferDesc = {};
+    bufferDesc.Flags = isEndOfStream ? XAUDIO2_END_OF_STREAM : 0;
+    bufferDesc.AudioBytes = static_cast<UINT32>(frameCount * channelCount * sizeof(std::int16_t));
+    bufferDesc.pAudioData = reinterpret_cast<const BYTE*>(samples.data());
+
+    POMDOG_ASSERT(sourceVoice);
+    HRESULT hr = sourceVoice->SubmitSourceBuffer(&bufferDesc);
+    if (FAILED(hr)) {
+        return false;
+    }
+
+    nextBuffer = (nextBuffer + 1) % BufferCount;
+    return true;
+}
+
+} // namespace Pomdog::Detail::SoundSystem::XAudio2
@@ -0,0 +1,82 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "PrerequisitesXAudio2.hpp"
+#include "Pomdog/Application/Duration.hpp"
+#include "Pomdog/Audio/SoundState.hpp"
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Pomdog {
+class AudioStream;
+} // namespace Pomdog
+
+namespace Pomdog::Detail::SoundSystem::XAudio2 {
+
+class AudioEngineXAudio2;
+
+class StreamingAudioSourceXAudio2 final {
+public:
+    StreamingAudioSourceXAudio2(
+        AudioEngineXAudio2& audioEngine,
+        std::unique_ptr<AudioStream>&& audioStream,
+        bool isLooped);
+
+    StreamingAudioSourceXAudio2(const StreamingAudioSourceXAudio2&) = delete;
+    StreamingAudioSourceXAudio2& operator=(const StreamingAudioSourceXAudio2&) = delete;
+
+    ~StreamingAudioSourceXAudio2();
+
+    void Pause();
+
+    void Play();
+
+    void Stop();
+
+    void Seek(const Duration& position);
+
+    void ExitLoop();
+
+    SoundState GetState() const;
+
+    void SetPitch(float pitch);
+
+    void SetVolume(float volume);
+
+private:
+    static constexpr std::size_t BufferCount = 4;
+
+    void Run();
+
+    void UpdateBuffers();
+
+    void QueueBuffers();
+
+    void Rewind();
+
+    [[nodiscard]] bool SubmitBuffer();
+
+private:
+    std::unique_ptr<AudioStream> stream;
+    std::array<std::vector<std::int16_t>, BufferCount> buffers;
+    IXAudio2SourceVoice* sourceVoice = nullptr;
+    std::size_t framesPerBuffer = 0;
+    std::size_t nextBuffer = 0;
+
+    std::thread thread;
+    mutable std::mutex mutex;
+    std::condition_variable condition;
+    SoundState state = SoundState::Stopped;
+    bool isLooped = false;
+    bool isEndOfStream = false;
+    bool isShutdown = false;
+};
+
+} // namespace Pomdog::Detail::SoundSystem::XAudio2
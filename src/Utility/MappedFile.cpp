@@ -0,0 +1,186 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Utility/MappedFile.hpp"
+#include "../Utility/ErrorHelper.hpp"
+#include "Pomdog/Basic/Platform.hpp"
+#include "Pomdog/Utility/Assert.hpp"
+
+#if defined(POMDOG_PLATFORM_LINUX) \
+    || defined(POMDOG_PLATFORM_MACOSX) \
+    || defined(POMDOG_PLATFORM_APPLE_IOS) \
+    || defined(POMDOG_PLATFORM_ANDROID) \
+    || defined(POMDOG_PLATFORM_BSD)
+#define POMDOG_MAPPED_FILE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#else
+#include "Pomdog/Utility/FileSystem.hpp"
+#include <fstream>
+#endif
+
+#include <utility>
+
+namespace Pomdog {
+
+MappedFile::MappedFile() noexcept
+    : data(nullptr)
+    , size(0)
+    , isMapped(false)
+{
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(other.data)
+    , size(other.size)
+    , buffer(std::move(other.buffer))
+    , source(std::move(other.source))
+    , isMapped(other.isMapped)
+{
+    other.data = nullptr;
+    other.size = 0;
+    other.isMapped = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        Close();
+        data = other.data;
+        size = other.size;
+        buffer = std::move(other.buffer);
+        source = std::move(other.source);
+        isMapped = other.isMapped;
+        other.data = nullptr;
+        other.size = 0;
+        other.isMapped = false;
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+std::tuple<MappedFile, std::shared_ptr<Error>>
+MappedFile::Open(const std::string& path)
+{
+    MappedFile file;
+
+#if defined(POMDOG_MAPPED_FILE_MMAP)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        auto err = Errors::New(Detail::ToErrc(errno), "cannot open the file, " + path);
+        return std::make_tuple(std::move(file), std::move(err));
+    }
+
+    struct ::stat st;
+    if (::fstat(fd, &st) != 0) {
+        auto err = Errors::New(Detail::ToErrc(errno), "::fstat() failed, " + path);
+        ::close(fd);
+        return std::make_tuple(std::move(file), std::move(err));
+    }
+
+    // NOTE: mmap() fails for an empty file, which is a valid file to open.
+    if (st.st_size <= 0) {
+        ::close(fd);
+        return std::make_tuple(std::move(file), nullptr);
+    }
+
+    const auto byteLength = static_cast<std::size_t>(st.st_size);
+    void* mapped = ::mmap(nullptr, byteLength, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // NOTE: The mapping remains valid after the descriptor is closed.
+    ::close(fd);
+
+    if (mapped == MAP_FAILED) {
+        auto err = Errors::New(Detail::ToErrc(errno), "::mmap() failed, " + path);
+        return std::make_tuple(std::move(file), std::move(err));
+    }
+
+    file.data = static_cast<const std::uint8_t*>(mapped);
+    file.size = byteLength;
+    file.isMapped = true;
+#else
+    std::ifstream stream{path, std::ifstream::binary};
+    if (!stream) {
+        auto err = Errors::New("cannot open the file, " + path);
+        return std::make_tuple(std::move(file), std::move(err));
+    }
+
+    auto [byteLength, sizeErr] = FileSystem::GetFileSize(path);
+    if (sizeErr != nullptr) {
+        auto err = Errors::Wrap(std::move(sizeErr), "failed to get file size, " + path);
+        return std::make_tuple(std::move(file), std::move(err));
+    }
+
+    file.buffer.resize(byteLength);
+    stream.read(reinterpret_cast<char*>(file.buffer.data()), file.buffer.size());
+    if (!stream) {
+        auto err = Errors::New("failed to read the file " + path);
+        return std::make_tuple(MappedFile{}, std::move(err));
+    }
+
+    file.data = file.buffer.empty() ? nullptr : file.buffer.data();
+    file.size = file.buffer.size();
+#endif
+
+    return std::make_tuple(std::move(file), nullptr);
+}
+
+MappedFile MappedFile::Slice(
+    const std::shared_ptr<const MappedFile>& sourceIn, std::size_t offset, std::size_t sizeIn)
+{
+    POMDOG_ASSERT(sourceIn != nullptr);
+    POMDOG_ASSERT(offset <= sourceIn->GetSize());
+    POMDOG_ASSERT(sizeIn <= sourceIn->GetSize() - offset);
+
+    MappedFile file;
+    if (sizeIn > 0) {
+        file.data = sourceIn->GetData() + offset;
+        file.size = sizeIn;
+        file.source = sourceIn;
+    }
+    return file;
+}
+
+MappedFile MappedFile::FromBuffer(std::vector<std::uint8_t>&& bufferIn)
+{
+    MappedFile file;
+    file.buffer = std::move(bufferIn);
+    file.data = file.buffer.empty() ? nullptr : file.buffer.data();
+    file.size = file.buffer.size();
+    return file;
+}
+
+const std::uint8_t* MappedFile::GetData() const noexcept
+{
+    return data;
+}
+
+std::size_t MappedFile::GetSize() const noexcept
+{
+    return size;
+}
+
+void MappedFile::Close() noexcept
+{
+#if defined(POMDOG_MAPPED_FILE_MMAP)
+    if (isMapped) {
+        POMDOG_ASSERT(data != nullptr);
+        POMDOG_ASSERT(size > 0);
+        ::munmap(const_cast<std::uint8_t*>(data), size);
+    }
+#endif
+    buffer.clear();
+    buffer.shrink_to_fit();
+    source.reset();
+    data = nullptr;
+    size = 0;
+    isMapped = false;
+}
+
+} // namespace Pomdog
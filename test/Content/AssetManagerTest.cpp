@@ -0,0 +1,344 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Content/AssetManager.hpp"
+#include "Pomdog/Basic/Platform.hpp"
+#include "Pomdog/Utility/FileSystem.hpp"
+#include "Pomdog/Utility/PathHelper.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using Pomdog::AssetKey;
+using Pomdog::AssetManager;
+using Pomdog::FileSystem;
+using Pomdog::PathHelper;
+
+namespace {
+
+std::vector<std::string> loadedAssets;
+std::vector<std::string> destroyedAssets;
+
+struct FakeAsset final {
+    std::string Name;
+
+    explicit FakeAsset(const std::string& name)
+        : Name(name)
+    {
+        loadedAssets.push_back(Name);
+    }
+
+    ~FakeAsset()
+    {
+        destroyedAssets.push_back(Name);
+    }
+};
+
+struct TextAsset final {
+    std::string Text;
+};
+
+struct ConstTextAsset final {
+    const std::string Text;
+};
+
+template <typename T>
+std::tuple<std::shared_ptr<T>, std::shared_ptr<Pomdog::Error>>
+LoadText(Pomdog::AssetManager& assets, const std::string& filePath)
+{
+    auto [file, err] = assets.OpenAssetFile(filePath);
+    if (err != nullptr) {
+        return std::make_tuple(nullptr, std::move(err));
+    }
+    std::string text{reinterpret_cast<const char*>(file.GetData()), file.GetSize()};
+    return std::make_tuple(std::make_shared<T>(T{std::move(text)}), nullptr);
+}
+
+} // namespace
+
+namespace Pomdog::Detail {
+
+template <>
+struct AssetLoader<TextAsset> final {
+    std::tuple<std::shared_ptr<TextAsset>, std::shared_ptr<Error>>
+    operator()(AssetManager& assets, const std::string& filePath)
+    {
+        return LoadText<TextAsset>(assets, filePath);
+    }
+
+    static std::size_t GetByteSize(const TextAsset& asset)
+    {
+        return asset.Text.size();
+    }
+};
+
+template <>
+struct AssetLoader<ConstTextAsset> final {
+    std::tuple<std::shared_ptr<ConstTextAsset>, std::shared_ptr<Error>>
+    operator()(AssetManager& assets, const std::string& filePath)
+    {
+        return LoadText<ConstTextAsset>(assets, filePath);
+    }
+};
+
+template <>
+struct AssetLoader<FakeAsset> final {
+    std::tuple<std::shared_ptr<FakeAsset>, std::shared_ptr<Error>>
+    operator()([[maybe_unused]] AssetManager& assets, const std::string& filePath)
+    {
+        return std::make_tuple(std::make_shared<FakeAsset>(filePath), nullptr);
+    }
+
+    static std::size_t GetByteSize([[maybe_unused]] const FakeAsset& asset)
+    {
+        return 100;
+    }
+};
+
+} // namespace Pomdog::Detail
+
+TEST_CASE("AssetManager", "[AssetManager]")
+{
+    loadedAssets.clear();
+    destroyedAssets.clear();
+
+    AssetManager assets{"", nullptr};
+
+    auto load = [&](const std::string& name) {
+        auto [asset, err] = assets.Load<FakeAsset>(name);
+        REQUIRE(err == nullptr);
+        REQUIRE(asset != nullptr);
+        return asset;
+    };
+
+    SECTION("MemoryUsage")
+    {
+        REQUIRE(assets.GetMemoryUsage() == 0);
+
+        load("a");
+        load("b");
+        REQUIRE(assets.GetMemoryUsage() == 200);
+        REQUIRE(assets.GetMemoryUsage<FakeAsset>() == 200);
+
+        // NOTE: Loading the same asset again does not count twice.
+        load("a");
+        REQUIRE(assets.GetMemoryUsage() == 200);
+        REQUIRE(loadedAssets == std::vector<std::string>{"a", "b"});
+
+        assets.Unload("a");
+        REQUIRE(assets.GetMemoryUsage() == 100);
+        REQUIRE(destroyedAssets == std::vector<std::string>{"a"});
+
+        assets.Unload();
+        REQUIRE(assets.GetMemoryUsage() == 0);
+        REQUIRE(assets.GetMemoryUsage<FakeAsset>() == 0);
+        REQUIRE(destroyedAssets == std::vector<std::string>{"a", "b"});
+    }
+    SECTION("EvictLeastRecentlyUsed")
+    {
+        assets.SetMemoryBudget(300);
+
+        load("a");
+        load("b");
+        load("c");
+        REQUIRE(assets.GetMemoryUsage() == 300);
+        REQUIRE(destroyedAssets.empty());
+
+        // NOTE: "a" becomes more recently used than "b" and "c".
+        load("a");
+
+        load("d");
+        REQUIRE(assets.GetMemoryUsage() == 300);
+        REQUIRE(destroyedAssets == std::vector<std::string>{"b"});
+
+        load("e");
+        REQUIRE(assets.GetMemoryUsage() == 300);
+        REQUIRE(destroyedAssets == std::vector<std::string>{"b", "c"});
+
+        // NOTE: An evicted asset is loaded again.
+        load("b");
+        REQUIRE(loadedAssets == std::vector<std::string>{"a", "b", "c", "d", "e", "b"});
+        REQUIRE(destroyedAssets == std::vector<std::string>{"b", "c", "a"});
+    }
+    SECTION("KeepReferencedAssets")
+    {
+        assets.SetMemoryBudget(200);
+
+        auto a = load("a");
+        auto b = load("b");
+        load("c");
+        REQUIRE(destroyedAssets.empty());
+        REQUIRE(assets.GetMemoryUsage() == 300);
+
+        // NOTE: "a" and "b" are still referenced, so evicting them would not
+        // free any memory.
+        auto d = load("d");
+        REQUIRE(destroyedAssets == std::vector<std::string>{"c"});
+        REQUIRE(assets.GetMemoryUsage() == 300);
+
+        // NOTE: Released assets are evicted when the budget is enforced.
+        a.reset();
+        b.reset();
+        assets.EvictUnusedAssets();
+        REQUIRE(destroyedAssets == std::vector<std::string>{"c", "a"});
+        REQUIRE(assets.GetMemoryUsage() == 200);
+
+        assets.SetMemoryBudget(100);
+        REQUIRE(destroyedAssets == std::vector<std::string>{"c", "a", "b"});
+        REQUIRE(assets.GetMemoryUsage() == 100);
+    }
+    SECTION("AssetKey")
+    {
+        const auto a = assets.MakeAssetKey("a");
+        const auto b = assets.MakeAssetKey("b");
+        REQUIRE(a.IsValid());
+        REQUIRE(b.IsValid());
+        REQUIRE(a != b);
+        REQUIRE(a == assets.MakeAssetKey("a"));
+        REQUIRE_FALSE(AssetKey{}.IsValid());
+
+        auto [asset1, err1] = assets.Load<FakeAsset>(a);
+        REQUIRE(err1 == nullptr);
+        REQUIRE(asset1 != nullptr);
+
+        // NOTE: Loading by the key and by the name share the cache.
+        auto asset2 = load("a");
+        REQUIRE(asset1 == asset2);
+        REQUIRE(loadedAssets == std::vector<std::string>{"a"});
+
+        // NOTE: The key stays valid after the asset is unloaded.
+        asset1.reset();
+        asset2.reset();
+        assets.Unload(a);
+        REQUIRE(destroyedAssets == std::vector<std::string>{"a"});
+        REQUIRE(assets.GetMemoryUsage() == 0);
+
+        auto [asset3, err3] = assets.Load<FakeAsset>(a);
+        REQUIRE(err3 == nullptr);
+        REQUIRE(asset3 != nullptr);
+        REQUIRE(loadedAssets == std::vector<std::string>{"a", "a"});
+        REQUIRE(assets.GetMemoryUsage() == 100);
+    }
+    SECTION("ParallelFor")
+    {
+        // NOTE: Every index is visited once, and the writes are visible to
+        // the caller when ParallelFor returns.
+        std::vector<int> visits(1000, 0);
+        assets.ParallelFor(visits.size(), [&](std::size_t index) { ++visits[index]; });
+        REQUIRE(std::all_of(std::begin(visits), std::end(visits), [](int v) { return v == 1; }));
+
+        std::atomic<int> callCount{0};
+        assets.ParallelFor(0, [&](std::size_t) { ++callCount; });
+        REQUIRE(callCount == 0);
+        assets.ParallelFor(1, [&](std::size_t) { ++callCount; });
+        REQUIRE(callCount == 1);
+    }
+    SECTION("ParallelFor on the worker threads")
+    {
+        // NOTE: The workers are all busy with the outer loop, so the inner
+        // loops must be completed by the threads that call them.
+        std::atomic<int> callCount{0};
+        assets.ParallelFor(16, [&](std::size_t) {
+            assets.ParallelFor(16, [&](std::size_t) { ++callCount; });
+        });
+        REQUIRE(callCount == 256);
+    }
+}
+
+#if defined(POMDOG_PLATFORM_LINUX)
+TEST_CASE("AssetManager HotReload", "[AssetManager]")
+{
+    const auto contentDir = PathHelper::Join(FileSystem::GetTempDirectoryPath(), "pomdog_AssetManagerTest_HotReload");
+    if (!FileSystem::Exists(contentDir)) {
+        REQUIRE(FileSystem::CreateDirectory(contentDir));
+    }
+
+    auto writeFile = [&](const std::string& name, const std::string& text) {
+        std::ofstream stream{PathHelper::Join(contentDir, name), std::ofstream::binary};
+        stream.write(text.data(), text.size());
+    };
+
+    writeFile("a.txt", "one");
+    writeFile("b.txt", "first");
+    writeFile("c.txt", "unused");
+
+    AssetManager assets{contentDir, nullptr};
+    REQUIRE(assets.EnableHotReload() == nullptr);
+
+    std::vector<std::string> changedFiles;
+    auto connection = assets.AssetFileChanged.Connect([&](const std::string& filePath) {
+        changedFiles.push_back(filePath);
+    });
+
+    auto [a, errA] = assets.Load<TextAsset>("a.txt");
+    REQUIRE(errA == nullptr);
+    REQUIRE(a->Text == "one");
+    REQUIRE(assets.GetMemoryUsage() == 3);
+
+    auto [b, errB] = assets.Load<ConstTextAsset>("b.txt");
+    REQUIRE(errB == nullptr);
+    REQUIRE(b->Text == "first");
+
+    SECTION("ReloadInPlace")
+    {
+        // NOTE: The changes are applied by Update(), once per file.
+        writeFile("a.txt", "two");
+        writeFile("a.txt", "three");
+        REQUIRE(a->Text == "one");
+
+        assets.Update();
+        REQUIRE(a->Text == "three");
+        REQUIRE(assets.GetMemoryUsage() == 5);
+        REQUIRE(changedFiles == std::vector<std::string>{PathHelper::Join(contentDir, "a.txt")});
+
+        auto [a2, err] = assets.Load<TextAsset>("a.txt");
+        REQUIRE(err == nullptr);
+        REQUIRE(a2 == a);
+    }
+    SECTION("ReloadAssetsLoadedByUnnormalizedNames")
+    {
+        auto [a2, err] = assets.Load<TextAsset>("./a.txt");
+        REQUIRE(err == nullptr);
+        REQUIRE(a2 == a);
+
+        writeFile("a.txt", "two");
+        assets.Update();
+        REQUIRE(a->Text == "two");
+    }
+    SECTION("UnloadAssetsThatCannotBeReloadedInPlace")
+    {
+        writeFile("b.txt", "second");
+        assets.Update();
+        REQUIRE(b->Text == "first");
+
+        auto [b2, err] = assets.Load<ConstTextAsset>("b.txt");
+        REQUIRE(err == nullptr);
+        REQUIRE(b2 != b);
+        REQUIRE(b2->Text == "second");
+    }
+    SECTION("NotifyFilesThatAreNotLoaded")
+    {
+        writeFile("c.txt", "changed");
+        assets.Update();
+        REQUIRE(changedFiles == std::vector<std::string>{PathHelper::Join(contentDir, "c.txt")});
+    }
+    SECTION("DisableHotReload")
+    {
+        assets.DisableHotReload();
+        writeFile("a.txt", "four");
+        assets.Update();
+        REQUIRE(a->Text == "one");
+        REQUIRE(changedFiles.empty());
+    }
+
+    for (auto name : {"a.txt", "b.txt", "c.txt"}) {
+        std::remove(PathHelper::Join(contentDir, name).c_str());
+    }
+    std::remove(contentDir.c_str());
+}
+#endif
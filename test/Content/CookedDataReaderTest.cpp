@@ -0,0 +1,357 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Content/Utility/CookedData.hpp"
+#include "Pomdog/Content/Utility/MakeFourCC.hpp"
+#include "Pomdog/Experimental/Spine/SkeletonDescLoader.hpp"
+#include "Pomdog/Experimental/TexturePacker/TextureAtlasLoader.hpp"
+#include "Pomdog/Utility/PathHelper.hpp"
+#include "catch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+using Pomdog::PathHelper;
+using Pomdog::Detail::CookedArray;
+using Pomdog::Detail::CookedDataHeader;
+using Pomdog::Detail::CookedDataReader;
+using Pomdog::Detail::CookedDataSection;
+using Pomdog::Detail::CookedSpan;
+using Pomdog::Detail::CookedString;
+using Pomdog::Detail::MakeFourCC;
+
+namespace {
+
+constexpr std::uint32_t TestSignature = MakeFourCC('T', 'E', 'S', 'T');
+constexpr std::uint32_t TestVersion = 1;
+
+/// CookedFile lays out the sections in the same way as `tools/cook_data`.
+/// The storage is an array of uint64_t so that the data is aligned to 8 bytes.
+class CookedFile final {
+public:
+    std::vector<std::uint64_t> storage;
+    std::size_t size = 0;
+
+    explicit CookedFile(const std::vector<std::vector<std::uint8_t>>& sections)
+    {
+        std::vector<std::uint8_t> bytes(sizeof(CookedDataHeader) + sections.size() * sizeof(CookedDataSection));
+
+        CookedDataHeader header;
+        header.Signature = TestSignature;
+        header.Version = TestVersion;
+        header.SectionCount = static_cast<std::uint32_t>(sections.size());
+        header.Reserved = 0;
+        std::memcpy(bytes.data(), &header, sizeof(header));
+
+        for (std::size_t i = 0; i < sections.size(); ++i) {
+            bytes.resize((bytes.size() + 7) / 8 * 8);
+
+            CookedDataSection section;
+            section.Offset = static_cast<std::uint32_t>(bytes.size());
+            section.Size = static_cast<std::uint32_t>(sections[i].size());
+            std::memcpy(bytes.data() + sizeof(header) + i * sizeof(section), &section, sizeof(section));
+
+            bytes.insert(std::end(bytes), std::begin(sections[i]), std::end(sections[i]));
+        }
+
+        size = bytes.size();
+        storage.resize((size + 7) / 8);
+        std::memcpy(storage.data(), bytes.data(), size);
+    }
+
+    const std::uint8_t* GetData() const noexcept
+    {
+        return reinterpret_cast<const std::uint8_t*>(storage.data());
+    }
+
+    CookedDataSection& GetSection(std::size_t index) noexcept
+    {
+        auto table = reinterpret_cast<std::uint8_t*>(storage.data()) + sizeof(CookedDataHeader);
+        return reinterpret_cast<CookedDataSection*>(table)[index];
+    }
+};
+
+template <typename T>
+std::vector<std::uint8_t> ToBytes(const std::vector<T>& records)
+{
+    std::vector<std::uint8_t> bytes(records.size() * sizeof(T));
+    std::memcpy(bytes.data(), records.data(), bytes.size());
+    return bytes;
+}
+
+CookedFile MakeTestFile()
+{
+    const std::string strings = "hello, world";
+    return CookedFile{{
+        std::vector<std::uint8_t>(std::begin(strings), std::end(strings)),
+        ToBytes<std::uint32_t>({10, 20, 30, 40, 50}),
+    }};
+}
+
+} // namespace
+
+TEST_CASE("CookedDataReader", "[CookedDataReader]")
+{
+    CookedDataReader reader;
+
+    SECTION("Open")
+    {
+        auto file = MakeTestFile();
+        REQUIRE(CookedDataReader::HasSignature(file.GetData(), file.size, TestSignature));
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) == nullptr);
+
+        const auto values = reader.GetSection<std::uint32_t>(1);
+        REQUIRE(values.size() == 5);
+        REQUIRE(values[0] == 10);
+        REQUIRE(values[4] == 50);
+
+        const auto slice = reader.Slice(values, CookedSpan{1, 3});
+        REQUIRE(slice.size() == 3);
+        REQUIRE(slice[0] == 20);
+        REQUIRE(slice[2] == 40);
+
+        REQUIRE(reader.GetString(CookedString{7, 5}) == "world");
+        REQUIRE(reader.IsValid());
+    }
+    SECTION("TruncatedHeader")
+    {
+        auto file = MakeTestFile();
+        REQUIRE_FALSE(CookedDataReader::HasSignature(file.GetData(), 3, TestSignature));
+        REQUIRE(reader.Open(file.GetData(), sizeof(CookedDataHeader) - 1, TestSignature, TestVersion, 2) != nullptr);
+        REQUIRE_FALSE(reader.IsValid());
+
+        // NOTE: The header is complete, but the section table is not.
+        REQUIRE(reader.Open(file.GetData(), sizeof(CookedDataHeader) + 4, TestSignature, TestVersion, 2) != nullptr);
+        REQUIRE_FALSE(reader.IsValid());
+    }
+    SECTION("HeaderMismatch")
+    {
+        auto file = MakeTestFile();
+        REQUIRE_FALSE(CookedDataReader::HasSignature(file.GetData(), file.size, MakeFourCC('N', 'O', 'P', 'E')));
+        REQUIRE(reader.Open(file.GetData(), file.size, MakeFourCC('N', 'O', 'P', 'E'), TestVersion, 2) != nullptr);
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion + 1, 2) != nullptr);
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 3) != nullptr);
+        REQUIRE_FALSE(reader.IsValid());
+    }
+    SECTION("SectionOutOfRange")
+    {
+        auto file = MakeTestFile();
+        file.GetSection(1).Size += 4;
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) != nullptr);
+
+        // NOTE: The offset and the size must not wrap around.
+        file.GetSection(1).Offset = 8;
+        file.GetSection(1).Size = std::numeric_limits<std::uint32_t>::max();
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) != nullptr);
+        REQUIRE_FALSE(reader.IsValid());
+    }
+    SECTION("MisalignedSection")
+    {
+        auto file = MakeTestFile();
+        file.GetSection(1).Offset -= 4;
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) != nullptr);
+        REQUIRE_FALSE(reader.IsValid());
+    }
+    SECTION("MisalignedSectionSize")
+    {
+        auto file = MakeTestFile();
+        file.GetSection(1).Size -= 2;
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) == nullptr);
+
+        const auto values = reader.GetSection<std::uint32_t>(1);
+        REQUIRE(values.size() == 0);
+        REQUIRE_FALSE(reader.IsValid());
+    }
+    SECTION("SliceOverflow")
+    {
+        auto file = MakeTestFile();
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) == nullptr);
+        const auto values = reader.GetSection<std::uint32_t>(1);
+
+        REQUIRE(reader.Slice(values, CookedSpan{5, 0}).size() == 0);
+        REQUIRE(reader.IsValid());
+
+        REQUIRE(reader.Slice(values, CookedSpan{4, 2}).size() == 0);
+        REQUIRE_FALSE(reader.IsValid());
+
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) == nullptr);
+        REQUIRE(reader.Slice(values, CookedSpan{1, std::numeric_limits<std::uint32_t>::max()}).size() == 0);
+        REQUIRE_FALSE(reader.IsValid());
+
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) == nullptr);
+        REQUIRE(reader.Slice(values, CookedSpan{6, 0}).size() == 0);
+        REQUIRE_FALSE(reader.IsValid());
+    }
+    SECTION("BadStringOffset")
+    {
+        auto file = MakeTestFile();
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) == nullptr);
+
+        REQUIRE(reader.GetString(CookedString{12, 0}).empty());
+        REQUIRE(reader.IsValid());
+
+        REQUIRE(reader.GetString(CookedString{7, 6}).empty());
+        REQUIRE_FALSE(reader.IsValid());
+
+        REQUIRE(reader.Open(file.GetData(), file.size, TestSignature, TestVersion, 2) == nullptr);
+        REQUIRE(reader.GetString(CookedString{std::numeric_limits<std::uint32_t>::max(), 2}).empty());
+        REQUIRE_FALSE(reader.IsValid());
+    }
+}
+
+// NOTE: The fixtures are cooked from the FeatureShowcase content by
+// `tools/cook_data`, and must be loaded to the same values as the sources.
+TEST_CASE("Cooked data matches the source", "[CookedDataReader]")
+{
+    using Pomdog::Spine::SkeletonDescLoader;
+    using Pomdog::TexturePacker::TextureAtlasLoader;
+
+    SECTION("Skeleton")
+    {
+        auto [source, sourceErr] = SkeletonDescLoader::Load(
+            PathHelper::Join(POMDOG_TEST_CONTENT_DIR, "Skeletal2D/Ghost/Ghost.json"));
+        REQUIRE(sourceErr == nullptr);
+
+        auto [cooked, cookedErr] = SkeletonDescLoader::Load(
+            PathHelper::Join(POMDOG_TEST_FIXTURES_DIR, "CookedData/Ghost.json"));
+        REQUIRE(cookedErr == nullptr);
+
+        REQUIRE(cooked.Bones.size() == source.Bones.size());
+        for (std::size_t i = 0; i < source.Bones.size(); ++i) {
+            const auto& a = source.Bones[i];
+            const auto& b = cooked.Bones[i];
+            REQUIRE(b.Name == a.Name);
+            REQUIRE(b.Parent == a.Parent);
+            REQUIRE(b.Pose.Translate.X == Approx(a.Pose.Translate.X));
+            REQUIRE(b.Pose.Translate.Y == Approx(a.Pose.Translate.Y));
+            REQUIRE(b.Pose.Rotation.value == Approx(a.Pose.Rotation.value));
+            REQUIRE(b.Pose.Scale == Approx(a.Pose.Scale));
+        }
+
+        REQUIRE(cooked.Slots.size() == source.Slots.size());
+        for (std::size_t i = 0; i < source.Slots.size(); ++i) {
+            const auto& a = source.Slots[i];
+            const auto& b = cooked.Slots[i];
+            REQUIRE(b.Name == a.Name);
+            REQUIRE(b.Attachement == a.Attachement);
+            REQUIRE(b.Color == a.Color);
+            REQUIRE(b.Joint == a.Joint);
+        }
+
+        REQUIRE(cooked.Skins.size() == source.Skins.size());
+        for (std::size_t i = 0; i < source.Skins.size(); ++i) {
+            REQUIRE(cooked.Skins[i].Name == source.Skins[i].Name);
+            REQUIRE(cooked.Skins[i].Slots.size() == source.Skins[i].Slots.size());
+            for (std::size_t k = 0; k < source.Skins[i].Slots.size(); ++k) {
+                const auto& a = source.Skins[i].Slots[k];
+                const auto& b = cooked.Skins[i].Slots[k];
+                REQUIRE(b.SlotName == a.SlotName);
+                REQUIRE(b.Attachments.size() == a.Attachments.size());
+                for (std::size_t n = 0; n < a.Attachments.size(); ++n) {
+                    REQUIRE(b.Attachments[n].Name == a.Attachments[n].Name);
+                    REQUIRE(b.Attachments[n].Translate.X == Approx(a.Attachments[n].Translate.X));
+                    REQUIRE(b.Attachments[n].Translate.Y == Approx(a.Attachments[n].Translate.Y));
+                    REQUIRE(b.Attachments[n].Scale.X == Approx(a.Attachments[n].Scale.X));
+                    REQUIRE(b.Attachments[n].Scale.Y == Approx(a.Attachments[n].Scale.Y));
+                    REQUIRE(b.Attachments[n].Rotation.value == Approx(a.Attachments[n].Rotation.value));
+                    REQUIRE(b.Attachments[n].Width == a.Attachments[n].Width);
+                    REQUIRE(b.Attachments[n].Height == a.Attachments[n].Height);
+                }
+                REQUIRE(b.SkinnedMeshAttachments.size() == a.SkinnedMeshAttachments.size());
+                for (std::size_t n = 0; n < a.SkinnedMeshAttachments.size(); ++n) {
+                    const auto& meshA = a.SkinnedMeshAttachments[n];
+                    const auto& meshB = b.SkinnedMeshAttachments[n];
+                    REQUIRE(meshB.Name == meshA.Name);
+                    REQUIRE(meshB.Indices == meshA.Indices);
+                    REQUIRE(meshB.Vertices.size() == meshA.Vertices.size());
+                    for (std::size_t v = 0; v < meshA.Vertices.size(); ++v) {
+                        REQUIRE(meshB.Vertices[v].Position.X == Approx(meshA.Vertices[v].Position.X));
+                        REQUIRE(meshB.Vertices[v].Position.Y == Approx(meshA.Vertices[v].Position.Y));
+                        REQUIRE(meshB.Vertices[v].TextureCoordinate.X == Approx(meshA.Vertices[v].TextureCoordinate.X));
+                        REQUIRE(meshB.Vertices[v].TextureCoordinate.Y == Approx(meshA.Vertices[v].TextureCoordinate.Y));
+                        for (std::size_t w = 0; w < meshA.Vertices[v].Weights.size(); ++w) {
+                            REQUIRE(meshB.Vertices[v].Weights[w] == Approx(meshA.Vertices[v].Weights[w]));
+                        }
+                        REQUIRE(meshB.Vertices[v].Joints == meshA.Vertices[v].Joints);
+                    }
+                }
+            }
+        }
+
+        REQUIRE(cooked.AnimationClips.size() == source.AnimationClips.size());
+        for (std::size_t i = 0; i < source.AnimationClips.size(); ++i) {
+            const auto& clipA = source.AnimationClips[i];
+            const auto& clipB = cooked.AnimationClips[i];
+            REQUIRE(clipB.Name == clipA.Name);
+
+            REQUIRE(clipB.BoneTracks.size() == clipA.BoneTracks.size());
+            for (std::size_t k = 0; k < clipA.BoneTracks.size(); ++k) {
+                const auto& a = clipA.BoneTracks[k];
+                const auto& b = clipB.BoneTracks[k];
+                REQUIRE(b.BoneName == a.BoneName);
+                REQUIRE(b.TranslateSamples.size() == a.TranslateSamples.size());
+                for (std::size_t n = 0; n < a.TranslateSamples.size(); ++n) {
+                    REQUIRE(b.TranslateSamples[n].Time.count() == Approx(a.TranslateSamples[n].Time.count()));
+                    REQUIRE(b.TranslateSamples[n].TranslateX.data == a.TranslateSamples[n].TranslateX.data);
+                    REQUIRE(b.TranslateSamples[n].TranslateY.data == a.TranslateSamples[n].TranslateY.data);
+                    REQUIRE(b.TranslateSamples[n].Curve == a.TranslateSamples[n].Curve);
+                }
+                REQUIRE(b.RotateSamples.size() == a.RotateSamples.size());
+                for (std::size_t n = 0; n < a.RotateSamples.size(); ++n) {
+                    REQUIRE(b.RotateSamples[n].Time.count() == Approx(a.RotateSamples[n].Time.count()));
+                    REQUIRE(b.RotateSamples[n].Rotation.data == a.RotateSamples[n].Rotation.data);
+                    REQUIRE(b.RotateSamples[n].Curve == a.RotateSamples[n].Curve);
+                }
+                REQUIRE(b.ScaleSamples.size() == a.ScaleSamples.size());
+                for (std::size_t n = 0; n < a.ScaleSamples.size(); ++n) {
+                    REQUIRE(b.ScaleSamples[n].Time.count() == Approx(a.ScaleSamples[n].Time.count()));
+                    REQUIRE(b.ScaleSamples[n].Scale.data == a.ScaleSamples[n].Scale.data);
+                    REQUIRE(b.ScaleSamples[n].Curve == a.ScaleSamples[n].Curve);
+                }
+            }
+
+            REQUIRE(clipB.SlotTracks.size() == clipA.SlotTracks.size());
+            for (std::size_t k = 0; k < clipA.SlotTracks.size(); ++k) {
+                const auto& a = clipA.SlotTracks[k];
+                const auto& b = clipB.SlotTracks[k];
+                REQUIRE(b.SlotName == a.SlotName);
+                REQUIRE(b.AttachmentSamples.size() == a.AttachmentSamples.size());
+                for (std::size_t n = 0; n < a.AttachmentSamples.size(); ++n) {
+                    REQUIRE(b.AttachmentSamples[n].AttachmentName == a.AttachmentSamples[n].AttachmentName);
+                    REQUIRE(b.AttachmentSamples[n].Time.count() == Approx(a.AttachmentSamples[n].Time.count()));
+                }
+            }
+        }
+    }
+    SECTION("TextureAtlas")
+    {
+        auto [source, sourceErr] = TextureAtlasLoader::Load(
+            PathHelper::Join(POMDOG_TEST_CONTENT_DIR, "Skeletal2D/Ghost/Ghost.atlas"));
+        REQUIRE(sourceErr == nullptr);
+
+        auto [cooked, cookedErr] = TextureAtlasLoader::Load(
+            PathHelper::Join(POMDOG_TEST_FIXTURES_DIR, "CookedData/Ghost.atlas"));
+        REQUIRE(cookedErr == nullptr);
+
+        REQUIRE(cooked.pages.size() == source.pages.size());
+        for (std::size_t i = 0; i < source.pages.size(); ++i) {
+            REQUIRE(cooked.pages[i].Name == source.pages[i].Name);
+        }
+
+        REQUIRE(cooked.regions.size() == source.regions.size());
+        for (std::size_t i = 0; i < source.regions.size(); ++i) {
+            const auto& a = source.regions[i];
+            const auto& b = cooked.regions[i];
+            REQUIRE(b.Name == a.Name);
+            REQUIRE(b.TexturePage == a.TexturePage);
+            REQUIRE(b.Region.Subrect == a.Region.Subrect);
+            REQUIRE(b.Region.XOffset == a.Region.XOffset);
+            REQUIRE(b.Region.YOffset == a.Region.YOffset);
+            REQUIRE(b.Region.Width == a.Region.Width);
+            REQUIRE(b.Region.Height == a.Region.Height);
+            REQUIRE(b.Region.Rotate == a.Region.Rotate);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Content/AssetManager.hpp"
+#include "Pomdog/Content/Image/PNG.hpp"
+#include "Pomdog/Utility/PathHelper.hpp"
+#include "catch.hpp"
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using Pomdog::AssetManager;
+using Pomdog::PathHelper;
+using Pomdog::SurfaceFormat;
+namespace PNG = Pomdog::PNG;
+
+namespace {
+
+std::vector<std::uint8_t> ReadFile(const std::string& filePath)
+{
+    std::ifstream stream{filePath, std::ios::binary};
+    REQUIRE(stream);
+    return std::vector<std::uint8_t>{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+} // namespace
+
+TEST_CASE("PNG", "[PNG]")
+{
+    const auto textureDir = PathHelper::Join(POMDOG_TEST_CONTENT_DIR, "Textures");
+
+    SECTION("Decode")
+    {
+        const auto binary = ReadFile(PathHelper::Join(textureDir, "pomdog.png"));
+        auto [image, err] = PNG::Decode(binary.data(), binary.size());
+        REQUIRE(err == nullptr);
+        REQUIRE(image.Width == 32);
+        REQUIRE(image.Height == 32);
+        REQUIRE(image.Format == SurfaceFormat::R8G8B8A8_UNorm);
+        REQUIRE(image.ByteLength == 32 * 32 * 4);
+        REQUIRE(image.PixelData == image.RawData.data());
+    }
+    SECTION("DecodeBatch")
+    {
+        std::vector<std::vector<std::uint8_t>> binaries;
+        for (auto name : {"pomdog.png", "particle_smoke.png", "particle_lightning.png", "pomdog.png"}) {
+            binaries.push_back(ReadFile(PathHelper::Join(textureDir, name)));
+        }
+
+        std::vector<std::tuple<const std::uint8_t*, std::size_t>> sources;
+        for (const auto& binary : binaries) {
+            sources.emplace_back(binary.data(), binary.size());
+        }
+
+        AssetManager assets{"", nullptr};
+        auto results = PNG::DecodeBatch(assets, sources);
+        REQUIRE(results.size() == sources.size());
+
+        // NOTE: The results are in the same order as the sources.
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto& [image, err] = results[i];
+            REQUIRE(err == nullptr);
+
+            auto [expected, expectedErr] = PNG::Decode(binaries[i].data(), binaries[i].size());
+            REQUIRE(expectedErr == nullptr);
+            REQUIRE(image.Width == expected.Width);
+            REQUIRE(image.Height == expected.Height);
+            REQUIRE(image.Format == expected.Format);
+            REQUIRE(image.RawData == expected.RawData);
+        }
+        REQUIRE(std::get<0>(results[1]).Width == 64);
+        REQUIRE(std::get<0>(results[0]).RawData == std::get<0>(results[3]).RawData);
+    }
+    SECTION("DecodeBatch with no sources")
+    {
+        AssetManager assets{"", nullptr};
+        REQUIRE(PNG::DecodeBatch(assets, {}).empty());
+    }
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Content/Image/PixelConversion.hpp"
+#include "catch.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace PixelConversion = Pomdog::PixelConversion;
+
+namespace {
+
+std::vector<std::uint8_t> MakePixels(std::size_t pixelCount)
+{
+    std::vector<std::uint8_t> pixels(pixelCount * 4);
+    std::uint32_t seed = 12345;
+    for (auto& p : pixels) {
+        seed = seed * 1103515245u + 12345u;
+        p = static_cast<std::uint8_t>(seed >> 24);
+    }
+    return pixels;
+}
+
+} // namespace
+
+TEST_CASE("PixelConversion", "[PixelConversion]")
+{
+    SECTION("PremultiplyAlpha")
+    {
+        std::vector<std::uint8_t> pixels = {
+            255, 128, 0, 255,
+            255, 128, 0, 0,
+            255, 128, 0, 128,
+            200, 100, 50, 1,
+            10, 20, 30, 254,
+        };
+        PixelConversion::PremultiplyAlpha(pixels.data(), 5);
+        REQUIRE(pixels == std::vector<std::uint8_t>{
+            255, 128, 0, 255,
+            0, 0, 0, 0,
+            128, 64, 0, 128,
+            1, 0, 0, 1,
+            10, 20, 30, 254,
+        });
+    }
+    SECTION("PremultiplyAlpha rounds to nearest for every color and alpha")
+    {
+        std::vector<std::uint8_t> pixels;
+        for (int alpha = 0; alpha < 256; ++alpha) {
+            for (int color = 0; color < 256; ++color) {
+                pixels.push_back(static_cast<std::uint8_t>(color));
+                pixels.push_back(static_cast<std::uint8_t>(255 - color));
+                pixels.push_back(static_cast<std::uint8_t>(color));
+                pixels.push_back(static_cast<std::uint8_t>(alpha));
+            }
+        }
+        auto expected = pixels;
+        for (std::size_t i = 0; i < expected.size(); i += 4) {
+            const int alpha = expected[i + 3];
+            for (std::size_t k = 0; k < 3; ++k) {
+                expected[i + k] = static_cast<std::uint8_t>((expected[i + k] * alpha * 2 + 255) / 510);
+            }
+        }
+        PixelConversion::PremultiplyAlpha(pixels.data(), pixels.size() / 4);
+        REQUIRE(pixels == expected);
+    }
+    SECTION("SwapRedBlue")
+    {
+        // NOTE: 19 pixels cover both the vectorized loop and the remainder.
+        auto pixels = MakePixels(19);
+        auto expected = pixels;
+        for (std::size_t i = 0; i < expected.size(); i += 4) {
+            std::swap(expected[i + 0], expected[i + 2]);
+        }
+        PixelConversion::SwapRedBlue(pixels.data(), 19);
+        REQUIRE(pixels == expected);
+
+        PixelConversion::SwapRedBlue(pixels.data(), 19);
+        REQUIRE(pixels == MakePixels(19));
+    }
+    SECTION("ConvertA8ToR8G8B8A8")
+    {
+        std::vector<std::uint8_t> alpha(35);
+        for (std::size_t i = 0; i < alpha.size(); ++i) {
+            alpha[i] = static_cast<std::uint8_t>(i * 7);
+        }
+
+        std::vector<std::uint8_t> pixels(alpha.size() * 4, 0);
+        PixelConversion::ConvertA8ToR8G8B8A8(alpha.data(), pixels.data(), alpha.size());
+
+        for (std::size_t i = 0; i < alpha.size(); ++i) {
+            REQUIRE(pixels[i * 4 + 0] == 255);
+            REQUIRE(pixels[i * 4 + 1] == 255);
+            REQUIRE(pixels[i * 4 + 2] == 255);
+            REQUIRE(pixels[i * 4 + 3] == alpha[i]);
+        }
+    }
+    SECTION("FillColorChannels")
+    {
+        // NOTE: 35 pixels cover both the vectorized loop and the remainder.
+        auto pixels = MakePixels(35);
+        auto expected = pixels;
+        for (std::size_t i = 0; i < expected.size(); i += 4) {
+            expected[i + 0] = 255;
+            expected[i + 1] = 128;
+            expected[i + 2] = 0;
+        }
+        PixelConversion::FillColorChannels(pixels.data(), 35, 255, 128, 0);
+        REQUIRE(pixels == expected);
+    }
+    SECTION("Empty")
+    {
+        PixelConversion::PremultiplyAlpha(nullptr, 0);
+        PixelConversion::SwapRedBlue(nullptr, 0);
+        PixelConversion::ConvertA8ToR8G8B8A8(nullptr, nullptr, 0);
+        PixelConversion::FillColorChannels(nullptr, 0, 255, 255, 255);
+    }
+}
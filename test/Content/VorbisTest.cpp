@@ -0,0 +1,88 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Audio/AudioStream.hpp"
+#include "Pomdog/Content/Audio/Vorbis.hpp"
+#include "Pomdog/Utility/PathHelper.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using Pomdog::AudioStream;
+using Pomdog::PathHelper;
+namespace Vorbis = Pomdog::Vorbis;
+
+namespace {
+
+// NOTE: Reads the stream to the end in small chunks, as StreamingAudioSource does.
+std::vector<std::int16_t> ReadToEnd(AudioStream& stream)
+{
+    constexpr std::size_t framesPerRead = 4096;
+    const auto channelCount = static_cast<std::size_t>(stream.GetChannels());
+
+    std::vector<std::int16_t> samples;
+    std::vector<std::int16_t> buffer(framesPerRead * channelCount);
+    for (;;) {
+        const auto count = stream.Read(buffer.data(), framesPerRead);
+        if (count == 0) {
+            break;
+        }
+        REQUIRE(count <= framesPerRead);
+        samples.insert(samples.end(), buffer.begin(), buffer.begin() + count * channelCount);
+    }
+    return samples;
+}
+
+} // unnamed namespace
+
+TEST_CASE("Vorbis", "[Vorbis]")
+{
+    auto [stream, err] = Vorbis::OpenStream(PathHelper::Join(POMDOG_TEST_CONTENT_DIR, "Sounds/synth.ogg"));
+    REQUIRE(err == nullptr);
+    REQUIRE(stream != nullptr);
+
+    const auto frameCount = stream->GetFrameCount();
+    const auto channelCount = static_cast<std::size_t>(stream->GetChannels());
+    REQUIRE(frameCount > 0);
+    REQUIRE(stream->GetSampleRate() > 0);
+
+    const auto samples = ReadToEnd(*stream);
+
+    SECTION("Read decodes every frame")
+    {
+        REQUIRE(samples.size() == frameCount * channelCount);
+
+        std::int16_t buffer[2] = {};
+        REQUIRE(stream->Read(buffer, 1) == 0);
+    }
+    SECTION("Seek to the start")
+    {
+        REQUIRE(stream->Seek(0));
+        REQUIRE(ReadToEnd(*stream) == samples);
+    }
+    SECTION("Seek to the middle")
+    {
+        const auto frame = frameCount / 2;
+        REQUIRE(stream->Seek(frame));
+
+        const auto rest = ReadToEnd(*stream);
+        REQUIRE(rest.size() == (frameCount - frame) * channelCount);
+        REQUIRE(std::equal(rest.begin(), rest.end(), samples.begin() + frame * channelCount));
+    }
+    SECTION("Seek to the end")
+    {
+        REQUIRE(stream->Seek(0));
+        REQUIRE(stream->Seek(frameCount));
+
+        std::int16_t buffer[2] = {};
+        REQUIRE(stream->Read(buffer, 1) == 0);
+
+        // NOTE: The stream can be played again after reaching the end.
+        REQUIRE(stream->Seek(0));
+        REQUIRE(ReadToEnd(*stream) == samples);
+    }
+    SECTION("Seek past the end")
+    {
+        REQUIRE_FALSE(stream->Seek(frameCount + 1));
+    }
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#pragma once
+
+#include "Pomdog/Application/GameWindow.hpp"
+#include "Pomdog/Application/MouseCursor.hpp"
+#include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
+#include "Pomdog/Input/Keyboard.hpp"
+#include "Pomdog/Input/KeyboardState.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
+#include <memory>
+#include <string>
+
+namespace Pomdog::GUI {
+
+class DummyGameWindow final : public GameWindow {
+public:
+    bool GetAllowUserResizing() const override { return false; }
+    void SetAllowUserResizing(bool) override {}
+    std::string GetTitle() const override { return {}; }
+    void SetTitle(const std::string&) override {}
+    Rectangle GetClientBounds() const override { return Rectangle{0, 0, 800, 480}; }
+    void SetClientBounds(const Rectangle&) override {}
+    bool IsMouseCursorVisible() const override { return true; }
+    void SetMouseCursorVisible(bool) override {}
+    void SetMouseCursor(MouseCursor) override {}
+};
+
+class DummyKeyboard final : public Keyboard {
+public:
+    KeyboardState GetState() const override { return {}; }
+};
+
+/// Creates a dispatcher for the widgets under test, which are never drawn.
+inline std::shared_ptr<UIEventDispatcher> CreateDummyDispatcher()
+{
+    return std::make_shared<UIEventDispatcher>(
+        std::make_shared<DummyGameWindow>(),
+        std::make_shared<DummyKeyboard>());
+}
+
+} // namespace Pomdog::GUI
@@ -0,0 +1,107 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "DummyDispatcher.hpp"
+#include "Pomdog/Experimental/GUI/TreeListViewDataSource.hpp"
+#include "Pomdog/Experimental/GUI/TreeViewItem.hpp"
+#include "catch.hpp"
+#include <memory>
+#include <vector>
+
+using namespace Pomdog::GUI;
+
+namespace {
+
+std::vector<int> GetItems(TreeListViewDataSource& dataSource)
+{
+    std::vector<int> items;
+    for (int i = 0; i < dataSource.GetItemCount(); i++) {
+        items.push_back(dataSource.GetNodeAt(i));
+    }
+    return items;
+}
+
+} // unnamed namespace
+
+TEST_CASE("TreeListViewDataSource", "[GUI]")
+{
+    // NOTE:
+    // a
+    // +- b
+    // |  +- c
+    // +- d
+    // e
+    TreeListViewDataSource dataSource;
+    const auto a = dataSource.AddNode(std::nullopt, "a");
+    const auto b = dataSource.AddNode(a, "b");
+    const auto c = dataSource.AddNode(b, "c");
+    const auto d = dataSource.AddNode(a, "d");
+    const auto e = dataSource.AddNode(std::nullopt, "e");
+
+    int itemsChangedCount = 0;
+    auto connection = dataSource.ItemsChanged.Connect([&] { ++itemsChangedCount; });
+
+    SECTION("Nodes")
+    {
+        REQUIRE(dataSource.GetNodeCount() == 5);
+        REQUIRE(dataSource.GetParent(a) == std::nullopt);
+        REQUIRE(dataSource.GetParent(c) == b);
+        REQUIRE(dataSource.GetDepth(a) == 0);
+        REQUIRE(dataSource.GetDepth(c) == 2);
+        REQUIRE(dataSource.HasChildren(a));
+        REQUIRE_FALSE(dataSource.HasChildren(d));
+        REQUIRE_FALSE(dataSource.IsExpanded(a));
+    }
+    SECTION("Collapsed nodes hide their descendants")
+    {
+        REQUIRE(GetItems(dataSource) == std::vector<int>{a, e});
+
+        dataSource.SetExpanded(a, true);
+        REQUIRE(GetItems(dataSource) == std::vector<int>{a, b, d, e});
+
+        dataSource.SetExpanded(b, true);
+        REQUIRE(GetItems(dataSource) == std::vector<int>{a, b, c, d, e});
+
+        dataSource.SetExpanded(a, false);
+        REQUIRE(GetItems(dataSource) == std::vector<int>{a, e});
+
+        // NOTE: The expanded state of the descendants is kept.
+        dataSource.SetExpanded(a, true);
+        REQUIRE(GetItems(dataSource) == std::vector<int>{a, b, c, d, e});
+        REQUIRE(itemsChangedCount == 4);
+    }
+    SECTION("Expanding a leaf node does not change the items")
+    {
+        dataSource.SetExpanded(e, true);
+        dataSource.SetExpanded(a, false);
+        REQUIRE(itemsChangedCount == 0);
+        REQUIRE(GetItems(dataSource) == std::vector<int>{a, e});
+    }
+    SECTION("Toggling an item widget expands the bound node")
+    {
+        auto dispatcher = CreateDummyDispatcher();
+        auto widget = dataSource.CreateItemWidget(dispatcher);
+        auto item = std::dynamic_pointer_cast<TreeViewItem>(widget);
+        REQUIRE(item != nullptr);
+
+        dataSource.BindItemWidget(0, widget);
+        REQUIRE_FALSE(item->IsExpanded());
+
+        item->Toggled(true);
+        REQUIRE(dataSource.IsExpanded(a));
+        REQUIRE(itemsChangedCount == 1);
+        REQUIRE(GetItems(dataSource) == std::vector<int>{a, b, d, e});
+
+        // NOTE: The widget is recycled for another node.
+        dataSource.BindItemWidget(1, widget);
+        item->Toggled(true);
+        REQUIRE(dataSource.IsExpanded(b));
+        REQUIRE(GetItems(dataSource) == std::vector<int>{a, b, c, d, e});
+    }
+    SECTION("Clear")
+    {
+        dataSource.Clear();
+        REQUIRE(dataSource.GetNodeCount() == 0);
+        REQUIRE(dataSource.GetItemCount() == 0);
+        REQUIRE(itemsChangedCount == 1);
+    }
+}
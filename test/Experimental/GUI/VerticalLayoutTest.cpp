@@ -0,0 +1,81 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "DummyDispatcher.hpp"
+#include "Pomdog/Experimental/GUI/TextBlock.hpp"
+#include "Pomdog/Experimental/GUI/VerticalLayout.hpp"
+#include "Pomdog/Math/Point2D.hpp"
+#include "catch.hpp"
+#include <memory>
+#include <vector>
+
+using Pomdog::Point2D;
+using namespace Pomdog::GUI;
+
+TEST_CASE("VerticalLayout GetChildAt", "[GUI]")
+{
+    auto dispatcher = CreateDummyDispatcher();
+    auto layout = std::make_shared<VerticalLayout>(dispatcher, 100, 10);
+
+    // NOTE: Three 12px high children with 2px spacing are placed from top to
+    // bottom at y = [28, 40], [14, 26] and [0, 12].
+    std::vector<std::shared_ptr<TextBlock>> children;
+    for (int i = 0; i < 3; ++i) {
+        auto child = std::make_shared<TextBlock>(dispatcher);
+        child->SetSize(50, 12);
+        layout->AddChild(child);
+        children.push_back(child);
+    }
+    layout->DoLayout();
+
+    REQUIRE(layout->GetHeight() == 40);
+    REQUIRE(children[0]->GetY() == 28);
+    REQUIRE(children[1]->GetY() == 14);
+    REQUIRE(children[2]->GetY() == 0);
+
+    const auto requireHits = [&] {
+        // NOTE: The top and bottom edges of each child
+        REQUIRE(layout->GetChildAt(Point2D{10, 40}) == children[0]);
+        REQUIRE(layout->GetChildAt(Point2D{10, 28}) == children[0]);
+        REQUIRE(layout->GetChildAt(Point2D{10, 26}) == children[1]);
+        REQUIRE(layout->GetChildAt(Point2D{10, 14}) == children[1]);
+        REQUIRE(layout->GetChildAt(Point2D{10, 12}) == children[2]);
+        REQUIRE(layout->GetChildAt(Point2D{10, 0}) == children[2]);
+
+        // NOTE: The left and right edges
+        REQUIRE(layout->GetChildAt(Point2D{0, 20}) == children[1]);
+        REQUIRE(layout->GetChildAt(Point2D{100, 20}) == children[1]);
+        REQUIRE(layout->GetChildAt(Point2D{101, 20}) == nullptr);
+
+        // NOTE: The spacing between children
+        REQUIRE(layout->GetChildAt(Point2D{10, 27}) == nullptr);
+        REQUIRE(layout->GetChildAt(Point2D{10, 13}) == nullptr);
+
+        // NOTE: Above the first child and past the last child
+        REQUIRE(layout->GetChildAt(Point2D{10, 41}) == nullptr);
+        REQUIRE(layout->GetChildAt(Point2D{10, -1}) == nullptr);
+    };
+
+    SECTION("Clean layout")
+    {
+        requireHits();
+    }
+    SECTION("Dirty layout")
+    {
+        // NOTE: The children keep their positions until the next layout, and
+        // they are searched linearly in the meantime.
+        layout->MarkContentLayoutDirty();
+        requireHits();
+    }
+    SECTION("Both searches agree")
+    {
+        std::vector<std::shared_ptr<Widget>> expected;
+        for (int y = -2; y <= 42; ++y) {
+            expected.push_back(layout->GetChildAt(Point2D{10, y}));
+        }
+
+        layout->MarkContentLayoutDirty();
+        for (int y = -2; y <= 42; ++y) {
+            REQUIRE(layout->GetChildAt(Point2D{10, y}) == expected[y + 2]);
+        }
+    }
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "DummyDispatcher.hpp"
+#include "Pomdog/Experimental/GUI/ListViewDataSource.hpp"
+#include "Pomdog/Experimental/GUI/TextBlock.hpp"
+#include "Pomdog/Experimental/GUI/VirtualizedListView.hpp"
+#include "catch.hpp"
+#include <memory>
+#include <optional>
+#include <vector>
+
+using namespace Pomdog::GUI;
+
+namespace {
+
+class DummyDataSource final : public ListViewDataSource {
+public:
+    int ItemCount = 0;
+
+    int GetItemCount() override
+    {
+        return ItemCount;
+    }
+
+    std::shared_ptr<Widget>
+    CreateItemWidget(const std::shared_ptr<UIEventDispatcher>& dispatcher) override
+    {
+        return std::make_shared<TextBlock>(dispatcher);
+    }
+
+    void BindItemWidget(int, const std::shared_ptr<Widget>&) override
+    {
+    }
+};
+
+} // unnamed namespace
+
+TEST_CASE("VirtualizedListView", "[GUI]")
+{
+    auto dispatcher = CreateDummyDispatcher();
+    auto dataSource = std::make_shared<DummyDataSource>();
+    dataSource->ItemCount = 10;
+
+    auto listView = std::make_shared<VirtualizedListView>(dispatcher, 100, 20);
+    listView->SetDataSource(dataSource);
+    REQUIRE(listView->GetItemCount() == 10);
+    REQUIRE(listView->GetCurrentIndex() == std::nullopt);
+
+    std::vector<std::optional<int>> changes;
+    auto connection = listView->CurrentIndexChanged.Connect([&](std::optional<int> index) {
+        changes.push_back(index);
+    });
+
+    SECTION("SetCurrentIndex")
+    {
+        listView->SetCurrentIndex(3);
+        listView->SetCurrentIndex(3);
+        REQUIRE(listView->GetCurrentIndex() == 3);
+        REQUIRE(changes == std::vector<std::optional<int>>{3});
+    }
+    SECTION("SetCurrentIndex out of range clears the selection")
+    {
+        listView->SetCurrentIndex(3);
+        listView->SetCurrentIndex(10);
+        REQUIRE(listView->GetCurrentIndex() == std::nullopt);
+
+        listView->SetCurrentIndex(-1);
+        REQUIRE(changes == std::vector<std::optional<int>>{3, std::nullopt});
+    }
+    SECTION("ReloadData clears the selection that is out of range")
+    {
+        listView->SetCurrentIndex(8);
+        dataSource->ItemCount = 5;
+        listView->ReloadData();
+        REQUIRE(listView->GetItemCount() == 5);
+        REQUIRE(listView->GetCurrentIndex() == std::nullopt);
+        REQUIRE(changes == std::vector<std::optional<int>>{8, std::nullopt});
+    }
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "DummyDispatcher.hpp"
+#include "Pomdog/Experimental/GUI/FloatField.hpp"
+#include "Pomdog/Experimental/GUI/ScrollView.hpp"
+#include "Pomdog/Experimental/GUI/TextBlock.hpp"
+#include "Pomdog/Experimental/GUI/TextEdit.hpp"
+#include "Pomdog/Experimental/GUI/Thickness.hpp"
+#include "Pomdog/Experimental/GUI/ToggleSwitch.hpp"
+#include "Pomdog/Experimental/GUI/UIEventDispatcher.hpp"
+#include "Pomdog/Math/Color.hpp"
+#include "catch.hpp"
+
+using Pomdog::Color;
+using namespace Pomdog::GUI;
+
+// NOTE: WidgetHierarchy replays the recorded draw calls only while the
+// dispatcher is not render dirty and DrawingContext::CanReplay() holds, so
+// setting a value that is already set must not mark it dirty.
+TEST_CASE("Setters keep the drawing cache replayable", "[GUI]")
+{
+    auto dispatcher = CreateDummyDispatcher();
+
+    SECTION("TextBlock")
+    {
+        auto textBlock = std::make_shared<TextBlock>(dispatcher);
+        textBlock->SetText("Pomdog");
+        textBlock->SetColor(Color::White);
+        textBlock->SetFontWeight(FontWeight::Bold);
+        textBlock->SetFontSize(FontSize::Large);
+        textBlock->SetBaselineHeight(4.0f);
+        textBlock->SetTextAlignment(TextAlignment::Center);
+        dispatcher->ClearRenderDirty();
+
+        textBlock->SetText("Pomdog");
+        textBlock->SetColor(Color::White);
+        textBlock->SetFontWeight(FontWeight::Bold);
+        textBlock->SetFontSize(FontSize::Large);
+        textBlock->SetBaselineHeight(4.0f);
+        textBlock->SetTextAlignment(TextAlignment::Center);
+        REQUIRE_FALSE(dispatcher->IsRenderDirty());
+
+        textBlock->SetText("Chuck");
+        REQUIRE(dispatcher->IsRenderDirty());
+    }
+    SECTION("TextEdit")
+    {
+        auto textEdit = std::make_shared<TextEdit>(dispatcher);
+        textEdit->SetText("Pomdog");
+        textEdit->SetEnabled(false);
+        dispatcher->ClearRenderDirty();
+
+        textEdit->SetText("Pomdog");
+        textEdit->SetEnabled(false);
+        textEdit->SetSelection(0, 0);
+        REQUIRE_FALSE(dispatcher->IsRenderDirty());
+
+        textEdit->SetEnabled(true);
+        REQUIRE(dispatcher->IsRenderDirty());
+    }
+    SECTION("FloatField")
+    {
+        auto floatField = std::make_shared<FloatField>(dispatcher);
+        floatField->SetValue(0.5);
+        floatField->SetMinimum(-1.0);
+        floatField->SetMaximum(1.0);
+        floatField->SetDecimals(2);
+        floatField->SetEnabled(false);
+        dispatcher->ClearRenderDirty();
+
+        floatField->SetValue(0.5);
+        floatField->SetMinimum(-1.0);
+        floatField->SetMaximum(1.0);
+        floatField->SetDecimals(2);
+        floatField->SetEnabled(false);
+        REQUIRE_FALSE(dispatcher->IsRenderDirty());
+
+        floatField->SetValue(0.25);
+        REQUIRE(dispatcher->IsRenderDirty());
+    }
+    SECTION("ToggleSwitch")
+    {
+        auto toggleSwitch = std::make_shared<ToggleSwitch>(dispatcher);
+        toggleSwitch->SetOn(true);
+        toggleSwitch->SetEnabled(false);
+        dispatcher->ClearRenderDirty();
+
+        toggleSwitch->SetOn(true);
+        toggleSwitch->SetEnabled(false);
+        REQUIRE_FALSE(dispatcher->IsRenderDirty());
+
+        toggleSwitch->SetOn(false);
+        REQUIRE(dispatcher->IsRenderDirty());
+    }
+    SECTION("ScrollView")
+    {
+        auto scrollView = std::make_shared<ScrollView>(dispatcher, 100, 100);
+        auto textBlock = std::make_shared<TextBlock>(dispatcher);
+        scrollView->SetWidget(textBlock);
+        scrollView->SetMargin(Thickness{1, 2, 3, 4});
+        scrollView->SetBackgroundColor(Color::Black);
+        scrollView->SetHorizontalAlignment(HorizontalAlignment::Left);
+        dispatcher->ClearRenderDirty();
+
+        scrollView->SetWidget(textBlock);
+        scrollView->SetMargin(Thickness{1, 2, 3, 4});
+        scrollView->SetBackgroundColor(Color::Black);
+        scrollView->SetHorizontalAlignment(HorizontalAlignment::Left);
+        REQUIRE_FALSE(dispatcher->IsRenderDirty());
+
+        scrollView->SetBackgroundColor(Color::White);
+        REQUIRE(dispatcher->IsRenderDirty());
+    }
+}
@@ -0,0 +1,110 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/Graphics/FontGlyph.hpp"
+#include "Pomdog/Experimental/Graphics/KerningTable.hpp"
+#include "catch.hpp"
+#include <cstdint>
+#include <vector>
+
+using Pomdog::FontKerning;
+using Pomdog::Detail::KerningTable;
+
+namespace {
+
+FontKerning MakeKerning(char32_t first, char32_t second, std::int16_t amount)
+{
+    FontKerning kerning;
+    kerning.First = first;
+    kerning.Second = second;
+    kerning.Amount = amount;
+    return kerning;
+}
+
+} // unnamed namespace
+
+TEST_CASE("KerningTable", "[KerningTable]")
+{
+    KerningTable table;
+
+    SECTION("Empty table")
+    {
+        REQUIRE(table.IsEmpty());
+        REQUIRE(table.GetCount() == 0);
+        REQUIRE(table.Find(U'A', U'V') == 0);
+        REQUIRE_FALSE(table.TryFind(U'A', U'V'));
+    }
+    SECTION("Reset")
+    {
+        table.Reset({
+            MakeKerning(U'A', U'V', -2),
+            MakeKerning(U'V', U'A', -3),
+            MakeKerning(U'T', U'o', -1),
+        });
+        REQUIRE(table.GetCount() == 3);
+        REQUIRE(table.Find(U'A', U'V') == -2);
+        REQUIRE(table.Find(U'V', U'A') == -3);
+        REQUIRE(table.Find(U'T', U'o') == -1);
+        REQUIRE(table.Find(U'o', U'T') == 0);
+        REQUIRE_FALSE(table.TryFind(U'o', U'T'));
+
+        table.Reset({});
+        REQUIRE(table.IsEmpty());
+        REQUIRE_FALSE(table.TryFind(U'A', U'V'));
+    }
+    SECTION("Reset with duplicate pairs keeps the last one")
+    {
+        table.Reset({
+            MakeKerning(U'A', U'V', -2),
+            MakeKerning(U'A', U'V', -5),
+        });
+        REQUIRE(table.GetCount() == 1);
+        REQUIRE(table.Find(U'A', U'V') == -5);
+    }
+    SECTION("Insert replaces the amount of an existing pair")
+    {
+        table.Insert(U'A', U'V', -2);
+        table.Insert(U'A', U'V', 4);
+        REQUIRE(table.GetCount() == 1);
+        REQUIRE(table.Find(U'A', U'V') == 4);
+    }
+    SECTION("Insert with zero amount")
+    {
+        // NOTE: A cached pair without kerning is distinguished from a missing pair.
+        table.Insert(U'A', U'B', 0);
+        REQUIRE_FALSE(table.IsEmpty());
+        REQUIRE(table.TryFind(U'A', U'B') == std::int16_t{0});
+        REQUIRE_FALSE(table.TryFind(U'B', U'A'));
+    }
+    SECTION("Pairs that differ only in the upper bits")
+    {
+        table.Insert(U'A', 0x10041, 1);
+        table.Insert(0x10041, U'A', 2);
+        table.Insert(U'A', U'A', 3);
+        REQUIRE(table.Find(U'A', 0x10041) == 1);
+        REQUIRE(table.Find(0x10041, U'A') == 2);
+        REQUIRE(table.Find(U'A', U'A') == 3);
+        REQUIRE_FALSE(table.TryFind(0x10041, 0x10041));
+    }
+    SECTION("Grows while keeping all pairs")
+    {
+        // NOTE: The pairs collide in the low bits of the code points, so the
+        // probe sequences cross each other while the table grows.
+        std::int16_t amount = 1;
+        for (char32_t first = 0x20; first < 0x20 + 64 * 32; first += 32) {
+            for (char32_t second = 0x20; second < 0x20 + 16; ++second) {
+                table.Insert(first, second, amount);
+                ++amount;
+            }
+        }
+        REQUIRE(table.GetCount() == 64 * 16);
+
+        amount = 1;
+        for (char32_t first = 0x20; first < 0x20 + 64 * 32; first += 32) {
+            for (char32_t second = 0x20; second < 0x20 + 16; ++second) {
+                REQUIRE(table.Find(first, second) == amount);
+                ++amount;
+            }
+            REQUIRE_FALSE(table.TryFind(first, 0x20 + 16));
+        }
+    }
+}
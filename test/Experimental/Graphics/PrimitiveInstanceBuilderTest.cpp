@@ -0,0 +1,192 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/Graphics/PrimitiveInstanceBuilder.hpp"
+#include "Pomdog/Math/Color.hpp"
+#include "Pomdog/Math/MathHelper.hpp"
+#include "Pomdog/Math/Matrix3x2.hpp"
+#include "Pomdog/Math/Radian.hpp"
+#include "Pomdog/Math/Rectangle.hpp"
+#include "Pomdog/Math/Vector2.hpp"
+#include "catch.hpp"
+
+using Pomdog::Color;
+using Pomdog::Matrix3x2;
+using Pomdog::PrimitiveInstance;
+using Pomdog::PrimitiveInstanceBuilder;
+using Pomdog::PrimitiveInstanceShape;
+using Pomdog::Rectangle;
+using Pomdog::Vector2;
+
+namespace {
+
+// NOTE: Same as the vertex shader of InstancedPrimitiveBatch.
+Vector2 TransformUnitPoint(const PrimitiveInstance& instance, const Vector2& point)
+{
+    const auto& t = instance.Transform;
+    const auto& translation = instance.Translation;
+    return Vector2{
+        point.X * t.X + point.Y * t.Z + translation.X,
+        point.X * t.Y + point.Y * t.W + translation.Y};
+}
+
+} // unnamed namespace
+
+TEST_CASE("PrimitiveInstanceBuilder", "[PrimitiveInstanceBuilder]")
+{
+    SECTION("instance layout")
+    {
+        STATIC_REQUIRE(sizeof(PrimitiveInstance) == sizeof(float) * 12);
+    }
+    SECTION("DrawRectangle")
+    {
+        PrimitiveInstanceBuilder builder;
+        builder.DrawRectangle(Rectangle{10, 20, 30, 40}, Color::Red);
+
+        REQUIRE(builder.GetInstanceCount() == 1);
+        const auto& instance = builder.GetData()[0];
+
+        auto p0 = TransformUnitPoint(instance, Vector2{0.0f, 0.0f});
+        auto p1 = TransformUnitPoint(instance, Vector2{1.0f, 1.0f});
+        REQUIRE(p0.X == Approx(10.0f));
+        REQUIRE(p0.Y == Approx(20.0f));
+        REQUIRE(p1.X == Approx(40.0f));
+        REQUIRE(p1.Y == Approx(60.0f));
+
+        auto color = Color::Red.ToVector4();
+        REQUIRE(instance.Color.X == color.X);
+        REQUIRE(instance.Color.Y == color.Y);
+        REQUIRE(instance.Color.Z == color.Z);
+        REQUIRE(instance.Color.W == color.W);
+        REQUIRE(instance.Translation.Z == 0.0f);
+    }
+    SECTION("DrawRectangle with originPivot")
+    {
+        PrimitiveInstanceBuilder builder;
+        builder.DrawRectangle(Vector2{100.0f, 50.0f}, 20.0f, 10.0f, Vector2{0.5f, 0.5f}, Color::White);
+
+        REQUIRE(builder.GetInstanceCount() == 1);
+        const auto& instance = builder.GetData()[0];
+
+        auto p0 = TransformUnitPoint(instance, Vector2{0.0f, 0.0f});
+        auto p1 = TransformUnitPoint(instance, Vector2{1.0f, 1.0f});
+        REQUIRE(p0.X == Approx(90.0f));
+        REQUIRE(p0.Y == Approx(45.0f));
+        REQUIRE(p1.X == Approx(110.0f));
+        REQUIRE(p1.Y == Approx(55.0f));
+    }
+    SECTION("DrawRectangle with matrix")
+    {
+        const auto matrix = Matrix3x2::CreateRotation(Pomdog::Math::PiOver2<float>)
+            * Matrix3x2::CreateTranslation(Vector2{5.0f, 7.0f});
+
+        PrimitiveInstanceBuilder builder;
+        builder.DrawRectangle(matrix, Vector2{1.0f, 2.0f}, 3.0f, 4.0f, Color::White);
+
+        REQUIRE(builder.GetInstanceCount() == 1);
+        const auto& instance = builder.GetData()[0];
+
+        // NOTE: Must match the vertices that PolygonShapeBuilder would emit.
+        for (const auto& unitPoint : {Vector2{0.0f, 0.0f}, Vector2{1.0f, 0.0f}, Vector2{0.0f, 1.0f}, Vector2{1.0f, 1.0f}}) {
+            const auto local = Vector2{1.0f + 3.0f * unitPoint.X, 2.0f + 4.0f * unitPoint.Y};
+            const auto expected = Vector2::Transform(local, matrix);
+            const auto actual = TransformUnitPoint(instance, unitPoint);
+            REQUIRE(actual.X == Approx(expected.X));
+            REQUIRE(actual.Y == Approx(expected.Y));
+        }
+    }
+    SECTION("DrawTriangle")
+    {
+        const Vector2 a{1.0f, 2.0f};
+        const Vector2 b{5.0f, 3.0f};
+        const Vector2 c{-2.0f, 8.0f};
+
+        PrimitiveInstanceBuilder builder;
+        builder.DrawTriangle(a, b, c, Color::White);
+
+        REQUIRE(builder.GetInstanceCount() == 1);
+        const auto& instance = builder.GetData()[0];
+
+        auto p0 = TransformUnitPoint(instance, Vector2{0.0f, 0.0f});
+        auto p1 = TransformUnitPoint(instance, Vector2{1.0f, 0.0f});
+        auto p2 = TransformUnitPoint(instance, Vector2{0.0f, 1.0f});
+        REQUIRE(p0.X == Approx(a.X));
+        REQUIRE(p0.Y == Approx(a.Y));
+        REQUIRE(p1.X == Approx(b.X));
+        REQUIRE(p1.Y == Approx(b.Y));
+        REQUIRE(p2.X == Approx(c.X));
+        REQUIRE(p2.Y == Approx(c.Y));
+    }
+    SECTION("DrawCircle")
+    {
+        PrimitiveInstanceBuilder builder;
+        builder.DrawCircle(Vector2{3.0f, 4.0f}, 2.0f, Color::White);
+
+        REQUIRE(builder.GetInstanceCount() == 1);
+        const auto& instance = builder.GetData()[0];
+
+        auto center = TransformUnitPoint(instance, Vector2{0.0f, 0.0f});
+        auto top = TransformUnitPoint(instance, Vector2{0.0f, 1.0f});
+        REQUIRE(center.X == Approx(3.0f));
+        REQUIRE(center.Y == Approx(4.0f));
+        REQUIRE(top.X == Approx(3.0f));
+        REQUIRE(top.Y == Approx(6.0f));
+    }
+    SECTION("degenerate shapes are skipped")
+    {
+        PrimitiveInstanceBuilder builder;
+        builder.DrawCircle(Vector2::Zero, 0.0f, Color::White);
+        builder.DrawRectangle(Rectangle{0, 0, 0, 10}, Color::White);
+        builder.DrawRectangle(Vector2::Zero, 10.0f, -1.0f, Vector2::Zero, Color::White);
+        REQUIRE(builder.IsEmpty());
+        REQUIRE(builder.GetRanges().empty());
+    }
+    SECTION("ranges")
+    {
+        PrimitiveInstanceBuilder builder;
+        builder.DrawRectangle(Rectangle{0, 0, 1, 1}, Color::White);
+        builder.DrawRectangle(Rectangle{0, 0, 1, 1}, Color::White);
+        builder.DrawCircle(Vector2::Zero, 1.0f, Color::White);
+        builder.DrawRectangle(Rectangle{0, 0, 1, 1}, Color::White);
+
+        REQUIRE(builder.GetInstanceCount() == 4);
+
+        const auto& ranges = builder.GetRanges();
+        REQUIRE(ranges.size() == 3);
+        REQUIRE(ranges[0].Shape == PrimitiveInstanceShape::Rectangle);
+        REQUIRE(ranges[0].StartInstanceLocation == 0);
+        REQUIRE(ranges[0].InstanceCount == 2);
+        REQUIRE(ranges[1].Shape == PrimitiveInstanceShape::Circle);
+        REQUIRE(ranges[1].StartInstanceLocation == 2);
+        REQUIRE(ranges[1].InstanceCount == 1);
+        REQUIRE(ranges[2].Shape == PrimitiveInstanceShape::Rectangle);
+        REQUIRE(ranges[2].StartInstanceLocation == 3);
+        REQUIRE(ranges[2].InstanceCount == 1);
+
+        builder.Reset();
+        REQUIRE(builder.IsEmpty());
+        REQUIRE(builder.GetRanges().empty());
+    }
+    SECTION("onFlush")
+    {
+        int flushCount = 0;
+        std::size_t flushedInstances = 0;
+        PrimitiveInstanceBuilder* builderPtr = nullptr;
+
+        PrimitiveInstanceBuilder builder(3, [&] {
+            ++flushCount;
+            flushedInstances += builderPtr->GetInstanceCount();
+            builderPtr->Reset();
+        });
+        builderPtr = &builder;
+
+        for (int i = 0; i < 7; ++i) {
+            builder.DrawCircle(Vector2::Zero, 1.0f, Color::White);
+        }
+
+        REQUIRE(flushCount == 2);
+        REQUIRE(flushedInstances == 6);
+        REQUIRE(builder.GetInstanceCount() == 1);
+        REQUIRE(builder.GetRanges().size() == 1);
+        REQUIRE(builder.GetRanges().front().StartInstanceLocation == 0);
+    }
+}
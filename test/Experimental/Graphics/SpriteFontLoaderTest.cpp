@@ -0,0 +1,90 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/Graphics/FontGlyph.hpp"
+#include "Pomdog/Experimental/Graphics/SpriteFontLoader.hpp"
+#include "Pomdog/Utility/PathHelper.hpp"
+#include "catch.hpp"
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using Pomdog::FontKerning;
+using Pomdog::PathHelper;
+using Pomdog::Detail::ParseKerning;
+
+namespace {
+
+FontKerning ParseKerningLine(const std::string& line)
+{
+    std::istringstream stream{line};
+    std::string tag;
+    stream >> tag;
+    REQUIRE(tag == "kerning");
+    return ParseKerning(stream);
+}
+
+} // unnamed namespace
+
+TEST_CASE("ParseKerning", "[SpriteFontLoader]")
+{
+    SECTION("Negative amount")
+    {
+        auto kerning = ParseKerningLine("kerning first=86  second=65  amount=-2");
+        REQUIRE(kerning.First == U'V');
+        REQUIRE(kerning.Second == U'A');
+        REQUIRE(kerning.Amount == -2);
+    }
+    SECTION("Positive amount with attributes in any order")
+    {
+        auto kerning = ParseKerningLine("kerning amount=3 second=1025 first=34");
+        REQUIRE(kerning.First == U'"');
+        REQUIRE(kerning.Second == 1025);
+        REQUIRE(kerning.Amount == 3);
+    }
+    SECTION("Missing attributes are zero")
+    {
+        auto kerning = ParseKerningLine("kerning first=65");
+        REQUIRE(kerning.First == U'A');
+        REQUIRE(kerning.Second == 0);
+        REQUIRE(kerning.Amount == 0);
+    }
+    SECTION("Unknown attributes are ignored")
+    {
+        auto kerning = ParseKerningLine("kerning first=65 second=86 amount=-1 page=0");
+        REQUIRE(kerning.First == U'A');
+        REQUIRE(kerning.Second == U'V');
+        REQUIRE(kerning.Amount == -1);
+    }
+    SECTION("Kernings of a BMFont file")
+    {
+        std::ifstream stream{PathHelper::Join(POMDOG_TEST_CONTENT_DIR, "BitmapFonts/Ubuntu-Regular.fnt")};
+        REQUIRE(stream);
+
+        std::vector<FontKerning> kernings;
+        std::string line;
+        while (std::getline(stream, line)) {
+            std::istringstream ss{line};
+            std::string tag;
+            ss >> tag;
+            if (tag == "kerning") {
+                kernings.push_back(ParseKerning(ss));
+            }
+        }
+
+        // NOTE: The `kernings count` of this file is larger than the number of
+        // `kerning` lines, so the lines are counted instead.
+        REQUIRE(kernings.size() == 496);
+        REQUIRE(kernings.front().First == U'/');
+        REQUIRE(kernings.front().Second == U'A');
+        REQUIRE(kernings.front().Amount == -1);
+        REQUIRE(kernings.back().First == U'-');
+        REQUIRE(kernings.back().Second == U'Y');
+        REQUIRE(kernings.back().Amount == -1);
+        for (const auto& kerning : kernings) {
+            REQUIRE(kerning.First != 0);
+            REQUIRE(kerning.Second != 0);
+            REQUIRE(kerning.Amount != 0);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Experimental/Graphics/FontGlyph.hpp"
+#include "Pomdog/Experimental/Graphics/TrueTypeFont.hpp"
+#include "Pomdog/Utility/PathHelper.hpp"
+#include "catch.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using Pomdog::FontGlyph;
+using Pomdog::PathHelper;
+using Pomdog::TrueTypeFont;
+
+namespace {
+
+constexpr auto Characters = U"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789.,!?-+/():;%&'*#=[]\"";
+
+// NOTE: Returns the number of atlas bytes used by the glyphs of `Characters`,
+// including the 1-pixel gutter that SpriteFont leaves around each glyph.
+template <typename Rasterize>
+std::size_t ComputeAtlasBytes(Rasterize rasterize)
+{
+    std::size_t bytes = 0;
+    std::vector<std::uint8_t> pixels;
+    for (auto c = Characters; *c != 0; ++c) {
+        auto glyph = rasterize(*c, pixels);
+        REQUIRE(glyph);
+        REQUIRE(pixels.size() == static_cast<std::size_t>(glyph->Subrect.Width * glyph->Subrect.Height));
+        bytes += static_cast<std::size_t>((glyph->Subrect.Width + 1) * (glyph->Subrect.Height + 1));
+    }
+    return bytes;
+}
+
+} // unnamed namespace
+
+TEST_CASE("TrueTypeFont", "[TrueTypeFont]")
+{
+    TrueTypeFont font;
+    auto err = font.Load(PathHelper::Join(POMDOG_TEST_CONTENT_DIR, "Fonts/NotoSans/NotoSans-Regular.ttf"));
+    REQUIRE(err == nullptr);
+
+    std::vector<std::uint8_t> pixels;
+
+    SECTION("RasterizeGlyph")
+    {
+        auto glyph = font.RasterizeGlyph(U'A', 32.0f, pixels);
+        REQUIRE(glyph);
+        REQUIRE(glyph->Character == U'A');
+        REQUIRE(glyph->Subrect.X == 0);
+        REQUIRE(glyph->Subrect.Y == 0);
+        REQUIRE(glyph->Subrect.Width > 0);
+        REQUIRE(glyph->Subrect.Height > 0);
+        REQUIRE(pixels.size() == static_cast<std::size_t>(glyph->Subrect.Width * glyph->Subrect.Height));
+    }
+    SECTION("RasterizeGlyph with space")
+    {
+        auto glyph = font.RasterizeGlyph(U' ', 32.0f, pixels);
+        REQUIRE(glyph);
+        REQUIRE(glyph->XAdvance > 0);
+        REQUIRE(pixels.empty());
+    }
+    SECTION("RasterizeGlyphSDF")
+    {
+        constexpr int padding = 4;
+        auto coverage = font.RasterizeGlyph(U'A', 32.0f, pixels);
+        REQUIRE(coverage);
+
+        auto glyph = font.RasterizeGlyphSDF(U'A', 32.0f, padding, pixels);
+        REQUIRE(glyph);
+        REQUIRE(glyph->Subrect.Width >= coverage->Subrect.Width + padding);
+        REQUIRE(glyph->Subrect.Height >= coverage->Subrect.Height + padding);
+        REQUIRE(glyph->XOffset < coverage->XOffset);
+        REQUIRE(glyph->XAdvance == coverage->XAdvance);
+        REQUIRE(pixels.size() == static_cast<std::size_t>(glyph->Subrect.Width * glyph->Subrect.Height));
+
+        // NOTE: The corners are outside the outline and the glyph has an inside.
+        REQUIRE(pixels.front() < 128);
+        REQUIRE(pixels.back() < 128);
+        REQUIRE(*std::max_element(std::begin(pixels), std::end(pixels)) >= 128);
+    }
+    SECTION("RasterizeGlyphSDF with space")
+    {
+        auto glyph = font.RasterizeGlyphSDF(U' ', 32.0f, 4, pixels);
+        REQUIRE(glyph);
+        REQUIRE(glyph->Subrect.Width == 0);
+        REQUIRE(glyph->Subrect.Height == 0);
+        REQUIRE(glyph->XAdvance > 0);
+        REQUIRE(pixels.empty());
+    }
+    SECTION("GetKerning")
+    {
+        // NOTE: Noto Sans has no `kern` table and stores its pair adjustments
+        // in extension lookups of `GPOS`.
+        REQUIRE(font.HasKerning());
+        REQUIRE(font.GetKerning(U'A', U'V', 32.0f) < 0);
+        REQUIRE(font.GetKerning(U'V', U'A', 32.0f) < 0);
+        REQUIRE(font.GetKerning(U'T', U'o', 32.0f) < 0);
+        REQUIRE(font.GetKerning(U'A', U'V', 64.0f) < font.GetKerning(U'A', U'V', 32.0f));
+        REQUIRE(font.GetKerning(U'A', U'\U0010FFFF', 32.0f) == 0);
+    }
+    SECTION("Atlas memory of a distance field atlas and coverage atlases for 8 font sizes")
+    {
+        constexpr std::array<float, 8> fontSizes = {12.0f, 14.0f, 16.0f, 20.0f, 24.0f, 32.0f, 48.0f, 64.0f};
+
+        std::size_t coverageBytes = 0;
+        for (auto fontSize : fontSizes) {
+            coverageBytes += ComputeAtlasBytes([&](char32_t c, std::vector<std::uint8_t>& out) {
+                return font.RasterizeGlyph(c, fontSize, out);
+            });
+        }
+
+        // NOTE: Same as SpriteFontRasterization::DistanceField at 32px.
+        const auto distanceFieldBytes = ComputeAtlasBytes([&](char32_t c, std::vector<std::uint8_t>& out) {
+            return font.RasterizeGlyphSDF(c, 32.0f, 4, out);
+        });
+
+        REQUIRE(distanceFieldBytes > 0);
+        REQUIRE(distanceFieldBytes * 2 < coverageBytes);
+    }
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+#include "Pomdog/Utility/MappedFile.hpp"
+#include "Pomdog/Utility/FileSystem.hpp"
+#include "Pomdog/Utility/PathHelper.hpp"
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using Pomdog::FileSystem;
+using Pomdog::MappedFile;
+using Pomdog::PathHelper;
+
+TEST_CASE("MappedFile", "[MappedFile]")
+{
+    const auto tempDir = FileSystem::GetTempDirectoryPath();
+
+    SECTION("Open")
+    {
+        const auto path = PathHelper::Join(tempDir, "pomdog_MappedFileTest.bin");
+        const std::string contents = "Chirico Cuvie";
+        {
+            std::ofstream stream{path, std::ofstream::binary};
+            stream.write(contents.data(), contents.size());
+        }
+
+        auto [file, err] = MappedFile::Open(path);
+        REQUIRE(err == nullptr);
+        REQUIRE(file.GetData() != nullptr);
+        REQUIRE(file.GetSize() == contents.size());
+        REQUIRE(std::string{reinterpret_cast<const char*>(file.GetData()), file.GetSize()} == contents);
+
+        auto moved = std::move(file);
+        REQUIRE(file.GetData() == nullptr);
+        REQUIRE(file.GetSize() == 0);
+        REQUIRE(moved.GetSize() == contents.size());
+
+        moved.Close();
+        REQUIRE(moved.GetData() == nullptr);
+        REQUIRE(moved.GetSize() == 0);
+
+        std::remove(path.c_str());
+    }
+    SECTION("EmptyFile")
+    {
+        const auto path = PathHelper::Join(tempDir, "pomdog_MappedFileTest_Empty.bin");
+        {
+            std::ofstream stream{path, std::ofstream::binary};
+        }
+
+        auto [file, err] = MappedFile::Open(path);
+        REQUIRE(err == nullptr);
+        REQUIRE(file.GetData() == nullptr);
+        REQUIRE(file.GetSize() == 0);
+
+        std::remove(path.c_str());
+    }
+    SECTION("Slice")
+    {
+        const std::string contents = "Chirico Cuvie";
+        auto source = std::make_shared<const MappedFile>(MappedFile::FromBuffer(
+            std::vector<std::uint8_t>(contents.begin(), contents.end())));
+        REQUIRE(source->GetSize() == contents.size());
+
+        auto slice = MappedFile::Slice(source, 8, 5);
+        REQUIRE(slice.GetSize() == 5);
+        REQUIRE(std::string{reinterpret_cast<const char*>(slice.GetData()), slice.GetSize()} == "Cuvie");
+
+        // NOTE: The slice keeps the source alive.
+        source.reset();
+        REQUIRE(std::string{reinterpret_cast<const char*>(slice.GetData()), slice.GetSize()} == "Cuvie");
+    }
+    SECTION("NotFound")
+    {
+        const auto path = PathHelper::Join(tempDir, "pomdog_MappedFileTest_NotFound.bin");
+        auto [file, err] = MappedFile::Open(path);
+        REQUIRE(err != nullptr);
+        REQUIRE(file.GetData() == nullptr);
+        REQUIRE(file.GetSize() == 0);
+    }
+}
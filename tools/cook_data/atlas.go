@@ -0,0 +1,163 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+package main
+
+import (
+	"fmt"
+	"strconv"
+	"strings"
+)
+
+// NOTE: The layout must be kept in sync with `src/Experimental/TexturePacker/TextureAtlasLoader.cpp`.
+const textureAtlasVersion = 1
+
+const (
+	textureAtlasStrings = iota
+	textureAtlasPages
+	textureAtlasRegions
+	textureAtlasSectionCount
+)
+
+type textureAtlasPage struct {
+	Name cookedString
+}
+
+type textureAtlasRegion struct {
+	Name           cookedString
+	X              int32
+	Y              int32
+	Width          int32
+	Height         int32
+	XOffset        int16
+	YOffset        int16
+	OriginalWidth  int16
+	OriginalHeight int16
+	TexturePage    int16
+	Rotate         uint16
+}
+
+// cookTextureAtlas converts a texture atlas in the libgdx format. The text is
+// parsed in the same way as `TextureAtlasLoader`.
+func cookTextureAtlas(text string) ([]byte, error) {
+	const (
+		statePageName = iota
+		statePageProperties
+		stateRegionProperties
+	)
+
+	w := newCookedWriter("ATLS", textureAtlasVersion, textureAtlasSectionCount)
+
+	var regions []textureAtlasRegion
+	pageIndex := int16(-1)
+	state := statePageName
+
+	newRegion := func(name string) {
+		regions = append(regions, textureAtlasRegion{
+			Name:           w.addString(name),
+			Width:          1,
+			Height:         1,
+			OriginalWidth:  1,
+			OriginalHeight: 1,
+			TexturePage:    pageIndex,
+		})
+	}
+
+	lines := strings.Split(strings.TrimSuffix(text, "\n"), "\n")
+	for lineNumber, line := range lines {
+		invalid := func() error {
+			return fmt.Errorf("line %d: cannot parse %q", lineNumber+1, line)
+		}
+
+		switch state {
+		case statePageName:
+			if line == "" {
+				continue
+			}
+			pageIndex++
+			w.add(textureAtlasPages, textureAtlasPage{Name: w.addString(line)})
+			state = statePageProperties
+
+		case statePageProperties:
+			if line == "" {
+				continue
+			}
+			fields := strings.Fields(line)
+			switch len(fields) {
+			case 0:
+				return nil, invalid()
+			case 1:
+				newRegion(line)
+				state = stateRegionProperties
+			}
+
+		case stateRegionProperties:
+			if line == "" {
+				state = statePageName
+				continue
+			}
+			if line[0] != ' ' {
+				newRegion(line)
+				continue
+			}
+
+			fields := strings.Fields(strings.NewReplacer(":", " ", ",", " ").Replace(line))
+			if len(fields) == 0 {
+				return nil, invalid()
+			}
+
+			region := &regions[len(regions)-1]
+			readInts := func(outputs ...interface{}) error {
+				if len(fields) < 1+len(outputs) {
+					return invalid()
+				}
+				for i, output := range outputs {
+					switch p := output.(type) {
+					case *int32:
+						v, err := strconv.ParseInt(fields[1+i], 10, 32)
+						if err != nil {
+							return invalid()
+						}
+						*p = int32(v)
+					case *int16:
+						v, err := strconv.ParseInt(fields[1+i], 10, 16)
+						if err != nil {
+							return invalid()
+						}
+						*p = int16(v)
+					}
+				}
+				return nil
+			}
+
+			var err error
+			switch fields[0] {
+			case "rotate":
+				if len(fields) < 2 {
+					return nil, invalid()
+				}
+				switch fields[1][0] {
+				case 't':
+					region.Rotate = 1
+				case 'f':
+					region.Rotate = 0
+				}
+			case "xy":
+				err = readInts(&region.X, &region.Y)
+			case "size":
+				err = readInts(&region.Width, &region.Height)
+			case "orig":
+				err = readInts(&region.OriginalWidth, &region.OriginalHeight)
+			case "offset":
+				err = readInts(&region.XOffset, &region.YOffset)
+			}
+			if err != nil {
+				return nil, err
+			}
+		}
+	}
+
+	for _, region := range regions {
+		w.add(textureAtlasRegions, region)
+	}
+	return w.bytes()
+}
@@ -0,0 +1,178 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+package main
+
+import (
+	"fmt"
+	"regexp"
+	"strconv"
+	"strings"
+)
+
+// NOTE: The layout must be kept in sync with `src/Experimental/Graphics/SpriteFontLoader.cpp`.
+const spriteFontVersion = 1
+
+const (
+	spriteFontStrings = iota
+	spriteFontFonts
+	spriteFontPages
+	spriteFontGlyphs
+	spriteFontKernings
+	spriteFontSectionCount
+)
+
+type spriteFont struct {
+	LineHeight   int16
+	Base         int16
+	PaddingLeft  int16
+	PaddingRight int16
+}
+
+type spriteFontPage struct {
+	Path cookedString
+	ID   uint32
+}
+
+type spriteFontGlyph struct {
+	X           int32
+	Y           int32
+	Width       int32
+	Height      int32
+	Character   uint32
+	XOffset     int16
+	YOffset     int16
+	XAdvance    int16
+	TexturePage int16
+}
+
+type spriteFontKerning struct {
+	First    uint32
+	Second   uint32
+	Amount   int16
+	Reserved uint16
+}
+
+var (
+	bitmapFontString  = regexp.MustCompile(`^"([a-zA-Z0-9_\-/.]*)"$`)
+	bitmapFontPadding = regexp.MustCompile(`^(-?[0-9]*),(-?[0-9]*),(-?[0-9]*),(-?[0-9]*)$`)
+	bitmapFontInteger = regexp.MustCompile(`^[-+]?[0-9]+`)
+)
+
+// parseInt parses the leading integer like `std::stoi()`.
+func parseInt(s string) (int64, error) {
+	v, err := strconv.ParseInt(bitmapFontInteger.FindString(s), 10, 64)
+	if err != nil {
+		return 0, fmt.Errorf("invalid integer %q", s)
+	}
+	return v, nil
+}
+
+// cookSpriteFont converts a bitmap font in the BMFont text format. The text is
+// parsed in the same way as `AssetLoader<SpriteFont>`.
+func cookSpriteFont(text string) ([]byte, error) {
+	w := newCookedWriter("FONT", spriteFontVersion, spriteFontSectionCount)
+
+	var font spriteFont
+	for _, line := range strings.Split(text, "\n") {
+		if line == "" {
+			continue
+		}
+		fields := strings.Fields(line)
+		if len(fields) == 0 {
+			break
+		}
+
+		// NOTE: The attributes are written as "name=value".
+		attributes := map[string]string{}
+		for _, field := range fields[1:] {
+			if i := strings.IndexByte(field, '='); i > 0 {
+				attributes[field[:i]] = field[i+1:]
+			}
+		}
+		integer := func(name string, output interface{}) error {
+			value, ok := attributes[name]
+			if !ok {
+				return nil
+			}
+			v, err := parseInt(value)
+			if err != nil {
+				return fmt.Errorf("%s: %w", name, err)
+			}
+			switch p := output.(type) {
+			case *int16:
+				*p = int16(v)
+			case *int32:
+				*p = int32(v)
+			case *uint32:
+				*p = uint32(v)
+			}
+			return nil
+		}
+		integers := func(outputs map[string]interface{}) error {
+			for name, output := range outputs {
+				if err := integer(name, output); err != nil {
+					return err
+				}
+			}
+			return nil
+		}
+
+		var err error
+		switch fields[0] {
+		case "info":
+			if m := bitmapFontPadding.FindStringSubmatch(attributes["padding"]); m != nil {
+				var v int64
+				if v, err = parseInt(m[2]); err == nil {
+					font.PaddingRight = int16(v)
+				}
+				if v, err = parseInt(m[4]); err == nil {
+					font.PaddingLeft = int16(v)
+				}
+			}
+		case "common":
+			err = integers(map[string]interface{}{
+				"lineHeight": &font.LineHeight,
+				"base":       &font.Base,
+			})
+		case "page":
+			var page spriteFontPage
+			var path string
+			if m := bitmapFontString.FindStringSubmatch(attributes["file"]); m != nil {
+				path = m[1]
+			}
+			page.Path = w.addString(path)
+			if err = integer("id", &page.ID); err == nil {
+				page.ID &= 0xffff
+				w.add(spriteFontPages, page)
+			}
+		case "char":
+			glyph := spriteFontGlyph{Width: 1, Height: 1}
+			err = integers(map[string]interface{}{
+				"id":       &glyph.Character,
+				"page":     &glyph.TexturePage,
+				"x":        &glyph.X,
+				"y":        &glyph.Y,
+				"width":    &glyph.Width,
+				"height":   &glyph.Height,
+				"xoffset":  &glyph.XOffset,
+				"yoffset":  &glyph.YOffset,
+				"xadvance": &glyph.XAdvance,
+			})
+			w.add(spriteFontGlyphs, glyph)
+		case "kerning":
+			var kerning spriteFontKerning
+			err = integers(map[string]interface{}{
+				"first":  &kerning.First,
+				"second": &kerning.Second,
+				"amount": &kerning.Amount,
+			})
+			w.add(spriteFontKernings, kerning)
+		}
+		if err != nil {
+			return nil, fmt.Errorf("%s: %w", fields[0], err)
+		}
+	}
+
+	w.add(spriteFontFonts, font)
+	return w.bytes()
+}
@@ -0,0 +1,134 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+package main
+
+import (
+	"bytes"
+	"encoding/json"
+	"strconv"
+)
+
+// NOTE: The loaders read the members of a JSON object in the order in which
+// they are written, so objects are decoded into a list instead of a map.
+type jsonMember struct {
+	Name  string
+	Value json.RawMessage
+}
+
+type jsonObject []jsonMember
+
+func decodeObject(data json.RawMessage) (jsonObject, bool) {
+	decoder := json.NewDecoder(bytes.NewReader(data))
+	if token, err := decoder.Token(); err != nil || token != json.Delim('{') {
+		return nil, false
+	}
+
+	var object jsonObject
+	for decoder.More() {
+		token, err := decoder.Token()
+		if err != nil {
+			return nil, false
+		}
+		name, ok := token.(string)
+		if !ok {
+			return nil, false
+		}
+		var value json.RawMessage
+		if err := decoder.Decode(&value); err != nil {
+			return nil, false
+		}
+		object = append(object, jsonMember{Name: name, Value: value})
+	}
+	return object, true
+}
+
+func decodeArray(data json.RawMessage) ([]json.RawMessage, bool) {
+	var array []json.RawMessage
+	if err := json.Unmarshal(data, &array); err != nil || array == nil {
+		return nil, false
+	}
+	return array, true
+}
+
+func (object jsonObject) member(name string) (json.RawMessage, bool) {
+	for _, m := range object {
+		if m.Name == name {
+			return m.Value, true
+		}
+	}
+	return nil, false
+}
+
+func (object jsonObject) object(name string) (jsonObject, bool) {
+	value, ok := object.member(name)
+	if !ok {
+		return nil, false
+	}
+	return decodeObject(value)
+}
+
+func (object jsonObject) array(name string) ([]json.RawMessage, bool) {
+	value, ok := object.member(name)
+	if !ok {
+		return nil, false
+	}
+	return decodeArray(value)
+}
+
+func (object jsonObject) string(name string) (string, bool) {
+	value, ok := object.member(name)
+	if !ok {
+		return "", false
+	}
+	var s string
+	if err := json.Unmarshal(value, &s); err != nil {
+		return "", false
+	}
+	return s, true
+}
+
+func (object jsonObject) number(name string) (float64, bool) {
+	value, ok := object.member(name)
+	if !ok {
+		return 0, false
+	}
+	return decodeNumber(value)
+}
+
+func (object jsonObject) uint(name string) (uint64, bool) {
+	value, ok := object.member(name)
+	if !ok {
+		return 0, false
+	}
+	return decodeUint(value)
+}
+
+// readNumber sets the number to `output` if the member exists, like `ReadJsonMember()`.
+func (object jsonObject) readNumber(name string, output *float32) {
+	if v, ok := object.number(name); ok {
+		*output = float32(v)
+	}
+}
+
+func decodeNumber(data json.RawMessage) (float64, bool) {
+	var n json.Number
+	if err := json.Unmarshal(data, &n); err != nil || bytes.HasPrefix(bytes.TrimSpace(data), []byte(`"`)) {
+		return 0, false
+	}
+	v, err := n.Float64()
+	return v, err == nil
+}
+
+// decodeUint succeeds only for non-negative integers, such as `IsUint()`.
+func decodeUint(data json.RawMessage) (uint64, bool) {
+	v, err := strconv.ParseUint(string(bytes.TrimSpace(data)), 10, 32)
+	return v, err == nil
+}
+
+func decodeString(data json.RawMessage) (string, bool) {
+	var s string
+	if err := json.Unmarshal(data, &s); err != nil {
+		return "", false
+	}
+	return s, true
+}
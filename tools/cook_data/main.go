@@ -0,0 +1,128 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+package main
+
+import (
+	"flag"
+	"fmt"
+	"io/ioutil"
+	"log"
+	"os"
+	"path/filepath"
+	"strings"
+)
+
+var options struct {
+	input   string
+	output  string
+	verbose bool
+}
+
+func main() {
+	flag.StringVar(&options.input, "i", "", "input data file or directory")
+	flag.StringVar(&options.output, "o", "", "output file or directory")
+	flag.BoolVar(&options.verbose, "v", false, "print the cooked files")
+	flag.Parse()
+
+	if options.input == "" || options.output == "" {
+		flag.Usage()
+		os.Exit(1)
+	}
+
+	if err := run(options.input, options.output); err != nil {
+		log.Fatalln(err)
+	}
+}
+
+func run(input, output string) error {
+	info, err := os.Stat(input)
+	if err != nil {
+		return err
+	}
+	if !info.IsDir() {
+		return cook(input, output)
+	}
+
+	return filepath.Walk(input, func(path string, info os.FileInfo, err error) error {
+		if err != nil {
+			return err
+		}
+		if info.IsDir() || !isDataFile(path) {
+			return nil
+		}
+
+		rel, err := filepath.Rel(input, path)
+		if err != nil {
+			return err
+		}
+
+		// NOTE: The loaders detect cooked files by the signature, so the
+		// cooked files keep the names of the source files.
+		dest := filepath.Join(output, rel)
+		if err := os.MkdirAll(filepath.Dir(dest), os.ModePerm); err != nil {
+			return err
+		}
+		return cook(path, dest)
+	})
+}
+
+func isDataFile(path string) bool {
+	switch strings.ToLower(filepath.Ext(path)) {
+	case ".json", ".atlas", ".fnt":
+		return true
+	}
+	return false
+}
+
+func cook(input, output string) error {
+	src, err := ioutil.ReadFile(input)
+	if err != nil {
+		return err
+	}
+
+	kind, cooked, err := cookData(input, src)
+	if err != nil {
+		return fmt.Errorf("%s: %v", input, err)
+	}
+	if cooked == nil {
+		if options.verbose {
+			fmt.Printf("%s: skipped\n", input)
+		}
+		return nil
+	}
+
+	if err := ioutil.WriteFile(output, cooked, 0644); err != nil {
+		return err
+	}
+
+	if options.verbose {
+		fmt.Printf("%s -> %s (%s, %d -> %d bytes)\n", input, output, kind, len(src), len(cooked))
+	}
+	return nil
+}
+
+// cookData returns nil if the file is not a supported data asset.
+func cookData(path string, src []byte) (string, []byte, error) {
+	switch strings.ToLower(filepath.Ext(path)) {
+	case ".atlas":
+		cooked, err := cookTextureAtlas(string(src))
+		return "texture atlas", cooked, err
+	case ".fnt":
+		cooked, err := cookSpriteFont(string(src))
+		return "sprite font", cooked, err
+	}
+
+	document, ok := decodeObject(src)
+	if !ok {
+		return "", nil, fmt.Errorf("invalid JSON")
+	}
+	switch {
+	case isSkeleton(document):
+		cooked, err := cookSkeleton(document)
+		return "skeleton", cooked, err
+	case isParticleClip(document):
+		cooked, err := cookParticleClip(document)
+		return "particle clip", cooked, err
+	}
+	return "", nil, nil
+}
@@ -0,0 +1,292 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+package main
+
+import (
+	"encoding/json"
+	"fmt"
+	"strconv"
+	"strings"
+)
+
+// NOTE: The layout must be kept in sync with `src/Experimental/Particles/ParticleClipLoader.cpp`.
+const particleClipVersion = 1
+
+const (
+	particleClipStrings = iota
+	particleClipClips
+	particleClipFloatKeys
+	particleClipColorKeys
+	particleClipSectionCount
+)
+
+var emitterShapes = map[string]uint32{
+	"box":        0,
+	"cone":       1,
+	"hemisphere": 2,
+	"sector":     3,
+	"sphere":     4,
+}
+
+const (
+	parameterConstant = iota
+	parameterRandom
+	parameterCurve
+)
+
+var parameterTypes = map[string]uint32{
+	"constant": parameterConstant,
+	"random":   parameterRandom,
+	"curve":    parameterCurve,
+}
+
+type floatParameter struct {
+	Type uint32
+	Min  float32
+	Max  float32
+	Keys cookedSpan
+}
+
+type colorParameter struct {
+	Type uint32
+	Min  [4]uint8
+	Max  [4]uint8
+	Keys cookedSpan
+}
+
+type floatKey struct {
+	Time  float32
+	Value float32
+}
+
+type colorKey struct {
+	Time  float32
+	Value [4]uint8
+}
+
+type particleClip struct {
+	Duration             float64
+	EmissionRate         int32
+	EmissionRateOverTime int32
+	MaxParticles         int32
+	StartLifetime        float32
+	StartDelay           float32
+	GravityModifier      float32
+	Looping              uint32
+	ShapeType            uint32
+	Shape                [3]float32
+	StartSpeed           floatParameter
+	StartRotation        floatParameter
+	RotationOverLifetime floatParameter
+	StartSize            floatParameter
+	SizeOverLifetime     floatParameter
+	StartColor           colorParameter
+	ColorOverLifetime    colorParameter
+}
+
+// cookParticleClip converts a particle clip in JSON.
+func cookParticleClip(document jsonObject) ([]byte, error) {
+	w := newCookedWriter("PCLP", particleClipVersion, particleClipSectionCount)
+
+	var clip particleClip
+	var err error
+	requireNumber := func(name string) float64 {
+		v, ok := document.number(name)
+		if !ok && err == nil {
+			err = fmt.Errorf("should have a number '%s' member", name)
+		}
+		return v
+	}
+	requireInt := func(name string) int32 {
+		data, _ := document.member(name)
+		v, parseErr := strconv.ParseInt(strings.TrimSpace(string(data)), 10, 32)
+		if parseErr != nil && err == nil {
+			err = fmt.Errorf("should have an integer '%s' member", name)
+		}
+		return int32(v)
+	}
+
+	clip.Duration = requireNumber("duration")
+	clip.EmissionRate = requireInt("emission_rate")
+	clip.EmissionRateOverTime = requireInt("emission_rate_over_time")
+	clip.StartLifetime = float32(requireNumber("start_lifetime"))
+	clip.StartDelay = float32(requireNumber("start_delay"))
+	clip.GravityModifier = float32(requireNumber("gravity_modifier"))
+	clip.MaxParticles = requireInt("max_particles")
+	if err != nil {
+		return nil, err
+	}
+
+	var looping bool
+	if data, ok := document.member("looping"); !ok || json.Unmarshal(data, &looping) != nil {
+		return nil, fmt.Errorf("should have a bool 'looping' member")
+	}
+	if looping {
+		clip.Looping = 1
+	}
+
+	shape, ok := document.object("shape")
+	if !ok {
+		return nil, fmt.Errorf("should have a 'shape' member")
+	}
+	shapeType, _ := shape.string("type")
+	if clip.ShapeType, ok = emitterShapes[shapeType]; !ok {
+		return nil, fmt.Errorf("unknown shape %q", shapeType)
+	}
+	switch shapeType {
+	case "box":
+		shape.readNumber("width", &clip.Shape[0])
+		shape.readNumber("height", &clip.Shape[1])
+		shape.readNumber("depth", &clip.Shape[2])
+	case "cone":
+		shape.readNumber("radius", &clip.Shape[0])
+		shape.readNumber("height", &clip.Shape[1])
+	case "sector":
+		shape.readNumber("angle", &clip.Shape[0])
+	default:
+		shape.readNumber("radius", &clip.Shape[0])
+	}
+
+	floatParameters := []struct {
+		name   string
+		output *floatParameter
+	}{
+		{"start_speed", &clip.StartSpeed},
+		{"start_rotation", &clip.StartRotation},
+		{"rotation_over_lifetime", &clip.RotationOverLifetime},
+		{"start_size", &clip.StartSize},
+		{"size_over_lifetime", &clip.SizeOverLifetime},
+	}
+	for _, p := range floatParameters {
+		if err := cookFloatParameter(w, document, p.name, p.output); err != nil {
+			return nil, err
+		}
+	}
+
+	colorParameters := []struct {
+		name   string
+		output *colorParameter
+	}{
+		{"start_color", &clip.StartColor},
+		{"color_over_lifetime", &clip.ColorOverLifetime},
+	}
+	for _, p := range colorParameters {
+		if err := cookColorParameter(w, document, p.name, p.output); err != nil {
+			return nil, err
+		}
+	}
+
+	w.add(particleClipClips, clip)
+	return w.bytes()
+}
+
+func parameterType(document jsonObject, name string) (jsonObject, uint32, error) {
+	parameter, ok := document.object(name)
+	if !ok {
+		return nil, 0, fmt.Errorf("should have a '%s' member", name)
+	}
+	typeName, _ := parameter.string("type")
+	t, ok := parameterTypes[typeName]
+	if !ok {
+		return nil, 0, fmt.Errorf("unknown type %q of '%s'", typeName, name)
+	}
+	return parameter, t, nil
+}
+
+func cookFloatParameter(w *cookedWriter, document jsonObject, name string, output *floatParameter) error {
+	parameter, t, err := parameterType(document, name)
+	if err != nil {
+		return err
+	}
+	output.Type = t
+
+	switch t {
+	case parameterConstant:
+		parameter.readNumber("value", &output.Min)
+	case parameterRandom:
+		parameter.readNumber("min", &output.Min)
+		parameter.readNumber("max", &output.Max)
+	case parameterCurve:
+		points, _ := parameter.array("points")
+		output.Keys.First = w.count(particleClipFloatKeys)
+		for _, data := range points {
+			point, ok := decodeObject(data)
+			if !ok {
+				return fmt.Errorf("invalid point of '%s'", name)
+			}
+			var key floatKey
+			point.readNumber("t", &key.Time)
+			point.readNumber("v", &key.Value)
+			w.add(particleClipFloatKeys, key)
+		}
+		output.Keys.Count = w.count(particleClipFloatKeys) - output.Keys.First
+	}
+	return nil
+}
+
+func decodeColor(data json.RawMessage) ([4]uint8, bool) {
+	var color [4]uint8
+	array, ok := decodeArray(data)
+	if !ok || len(array) != 4 {
+		return color, false
+	}
+	for i := range color {
+		v, ok := decodeUint(array[i])
+		if !ok {
+			return color, false
+		}
+		color[i] = uint8(v)
+	}
+	return color, true
+}
+
+func cookColorParameter(w *cookedWriter, document jsonObject, name string, output *colorParameter) error {
+	parameter, t, err := parameterType(document, name)
+	if err != nil {
+		return err
+	}
+	output.Type = t
+
+	readColor := func(object jsonObject, member string, color *[4]uint8) error {
+		data, _ := object.member(member)
+		v, ok := decodeColor(data)
+		if !ok {
+			return fmt.Errorf("value of '%s' in '%s' should be Color", member, name)
+		}
+		*color = v
+		return nil
+	}
+
+	switch t {
+	case parameterConstant:
+		return readColor(parameter, "value", &output.Min)
+	case parameterRandom:
+		if err := readColor(parameter, "min", &output.Min); err != nil {
+			return err
+		}
+		return readColor(parameter, "max", &output.Max)
+	case parameterCurve:
+		points, _ := parameter.array("points")
+		output.Keys.First = w.count(particleClipColorKeys)
+		for _, data := range points {
+			point, ok := decodeObject(data)
+			if !ok {
+				return fmt.Errorf("invalid point of '%s'", name)
+			}
+			var key colorKey
+			point.readNumber("t", &key.Time)
+			if err := readColor(point, "v", &key.Value); err != nil {
+				return err
+			}
+			w.add(particleClipColorKeys, key)
+		}
+		output.Keys.Count = w.count(particleClipColorKeys) - output.Keys.First
+	}
+	return nil
+}
+
+// isParticleClip returns true if the JSON looks like a particle clip.
+func isParticleClip(document jsonObject) bool {
+	_, ok := document.member("emission_rate")
+	return ok
+}
@@ -0,0 +1,514 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+package main
+
+import (
+	"fmt"
+	"strconv"
+)
+
+// NOTE: The layout must be kept in sync with `src/Experimental/Spine/SkeletonDescLoader.cpp`.
+// The values are stored as they are written in the JSON, and the defaults of
+// missing members are the same as the ones of the loader.
+const skeletonVersion = 1
+
+const (
+	skeletonStrings = iota
+	skeletonBones
+	skeletonSlots
+	skeletonSkins
+	skeletonSkinSlots
+	skeletonAttachments
+	skeletonSkinnedMeshes
+	skeletonSkinnedMeshVertices
+	skeletonSkinnedMeshInfluences
+	skeletonSkinnedMeshIndices
+	skeletonAnimationClips
+	skeletonBoneTracks
+	skeletonTranslateSamples
+	skeletonRotateSamples
+	skeletonScaleSamples
+	skeletonSlotTracks
+	skeletonAttachmentSamples
+	skeletonSectionCount
+)
+
+const (
+	curveLinear  = 0
+	curveStepped = 1
+	curveBezier  = 2
+)
+
+type skeletonBone struct {
+	Name     cookedString
+	Parent   cookedString
+	X        float32
+	Y        float32
+	Scale    float32
+	Rotation float32
+}
+
+type skeletonSlot struct {
+	Name       cookedString
+	Attachment cookedString
+	Color      uint32
+	Joint      uint32
+}
+
+type skeletonSkin struct {
+	Name  cookedString
+	Slots cookedSpan
+}
+
+type skeletonSkinSlot struct {
+	SlotName      cookedString
+	Attachments   cookedSpan
+	SkinnedMeshes cookedSpan
+}
+
+type skeletonAttachment struct {
+	Name     cookedString
+	X        float32
+	Y        float32
+	ScaleX   float32
+	ScaleY   float32
+	Rotation float32
+	Width    uint16
+	Height   uint16
+}
+
+type skeletonSkinnedMesh struct {
+	Name     cookedString
+	Vertices cookedSpan
+	Indices  cookedSpan
+}
+
+type skeletonSkinnedMeshVertex struct {
+	U          float32
+	V          float32
+	Influences cookedSpan
+}
+
+type skeletonSkinnedMeshInfluence struct {
+	Joint  uint32
+	X      float32
+	Y      float32
+	Weight float32
+}
+
+type skeletonAnimationClip struct {
+	Name       cookedString
+	BoneTracks cookedSpan
+	SlotTracks cookedSpan
+}
+
+type skeletonBoneTrack struct {
+	BoneName         cookedString
+	TranslateSamples cookedSpan
+	RotateSamples    cookedSpan
+	ScaleSamples     cookedSpan
+}
+
+type skeletonTranslateSample struct {
+	Time  float32
+	X     float32
+	Y     float32
+	Curve uint32
+}
+
+type skeletonRotateSample struct {
+	Time  float32
+	Angle float32
+	Curve uint32
+}
+
+type skeletonScaleSample struct {
+	Time  float32
+	Scale float32
+	Curve uint32
+}
+
+type skeletonSlotTrack struct {
+	SlotName          cookedString
+	AttachmentSamples cookedSpan
+}
+
+type skeletonAttachmentSample struct {
+	Name cookedString
+	Time float32
+}
+
+// cookSkeleton converts a Spine skeleton in JSON.
+func cookSkeleton(document jsonObject) ([]byte, error) {
+	w := newCookedWriter("SKEL", skeletonVersion, skeletonSectionCount)
+
+	boneIndices := map[string]uint32{}
+	if bones, ok := document.array("bones"); ok {
+		for _, data := range bones {
+			bone, ok := decodeObject(data)
+			if !ok {
+				continue
+			}
+			name, ok := bone.string("name")
+			if !ok {
+				continue
+			}
+			parent, _ := bone.string("parent")
+
+			record := skeletonBone{
+				Name:   w.addString(name),
+				Parent: w.addString(parent),
+				Scale:  1,
+			}
+			bone.readNumber("x", &record.X)
+			bone.readNumber("y", &record.Y)
+			bone.readNumber("scaleY", &record.Scale)
+			bone.readNumber("scaleX", &record.Scale)
+			bone.readNumber("rotation", &record.Rotation)
+
+			if _, ok := boneIndices[name]; !ok {
+				boneIndices[name] = w.count(skeletonBones)
+			}
+			w.add(skeletonBones, record)
+		}
+	}
+
+	if slots, ok := document.array("slots"); ok {
+		for _, data := range slots {
+			slot, ok := decodeObject(data)
+			if !ok {
+				continue
+			}
+			name, ok1 := slot.string("name")
+			boneName, ok2 := slot.string("bone")
+			attachment, ok3 := slot.string("attachment")
+			if !ok1 || !ok2 || !ok3 {
+				continue
+			}
+			joint, ok := boneIndices[boneName]
+			if !ok {
+				return nil, fmt.Errorf("cannot find the bone %q of the slot %q", boneName, name)
+			}
+
+			record := skeletonSlot{
+				Name:       w.addString(name),
+				Attachment: w.addString(attachment),
+				Color:      0xffffffff,
+				Joint:      joint,
+			}
+			if color, ok := slot.string("color"); ok {
+				packed, err := strconv.ParseUint(color, 16, 64)
+				if err != nil {
+					return nil, fmt.Errorf("invalid color %q of the slot %q", color, name)
+				}
+				record.Color = uint32(packed)
+			}
+			w.add(skeletonSlots, record)
+		}
+	}
+
+	if skins, ok := document.object("skins"); ok {
+		for _, skin := range skins {
+			slots, ok := decodeObject(skin.Value)
+			if !ok {
+				continue
+			}
+			first := w.count(skeletonSkinSlots)
+			for _, slot := range slots {
+				if err := cookSkinSlot(w, slot); err != nil {
+					return nil, err
+				}
+			}
+			w.add(skeletonSkins, skeletonSkin{
+				Name:  w.addString(skin.Name),
+				Slots: cookedSpan{First: first, Count: w.count(skeletonSkinSlots) - first},
+			})
+		}
+	}
+
+	if animations, ok := document.object("animations"); ok {
+		for _, animation := range animations {
+			clip, ok := decodeObject(animation.Value)
+			if !ok {
+				continue
+			}
+			record := skeletonAnimationClip{Name: w.addString(animation.Name)}
+
+			record.BoneTracks.First = w.count(skeletonBoneTracks)
+			if bones, ok := clip.object("bones"); ok {
+				for _, bone := range bones {
+					if track, ok := decodeObject(bone.Value); ok {
+						cookBoneTrack(w, bone.Name, track)
+					}
+				}
+			}
+			record.BoneTracks.Count = w.count(skeletonBoneTracks) - record.BoneTracks.First
+
+			record.SlotTracks.First = w.count(skeletonSlotTracks)
+			if slots, ok := clip.object("slots"); ok {
+				for _, slot := range slots {
+					if track, ok := decodeObject(slot.Value); ok {
+						cookSlotTrack(w, slot.Name, track)
+					}
+				}
+			}
+			record.SlotTracks.Count = w.count(skeletonSlotTracks) - record.SlotTracks.First
+
+			w.add(skeletonAnimationClips, record)
+		}
+	}
+
+	return w.bytes()
+}
+
+func cookSkinSlot(w *cookedWriter, slot jsonMember) error {
+	attachments, ok := decodeObject(slot.Value)
+	if !ok {
+		return nil
+	}
+
+	var meshes []jsonMember
+	record := skeletonSkinSlot{SlotName: w.addString(slot.Name)}
+
+	// NOTE: The loader keeps the skinned meshes apart from the other
+	// attachments, so they are written after the attachments.
+	record.Attachments.First = w.count(skeletonAttachments)
+	for _, member := range attachments {
+		attachment, ok := decodeObject(member.Value)
+		if !ok {
+			continue
+		}
+		if attachmentType, _ := attachment.string("type"); attachmentType == "skinnedmesh" {
+			meshes = append(meshes, member)
+			continue
+		}
+
+		a := skeletonAttachment{
+			Name:   w.addString(member.Name),
+			X:      1,
+			Y:      1,
+			ScaleX: 1,
+			ScaleY: 1,
+			Width:  1,
+			Height: 1,
+		}
+		attachment.readNumber("x", &a.X)
+		attachment.readNumber("y", &a.Y)
+		attachment.readNumber("scaleX", &a.ScaleX)
+		attachment.readNumber("scaleY", &a.ScaleY)
+		attachment.readNumber("rotation", &a.Rotation)
+		if v, ok := attachment.uint("width"); ok {
+			a.Width = uint16(v)
+		}
+		if v, ok := attachment.uint("height"); ok {
+			a.Height = uint16(v)
+		}
+		w.add(skeletonAttachments, a)
+	}
+	record.Attachments.Count = w.count(skeletonAttachments) - record.Attachments.First
+
+	record.SkinnedMeshes.First = w.count(skeletonSkinnedMeshes)
+	for _, member := range meshes {
+		mesh, _ := decodeObject(member.Value)
+		if err := cookSkinnedMesh(w, member.Name, mesh); err != nil {
+			return fmt.Errorf("skinned mesh %q: %w", member.Name, err)
+		}
+	}
+	record.SkinnedMeshes.Count = w.count(skeletonSkinnedMeshes) - record.SkinnedMeshes.First
+
+	w.add(skeletonSkinSlots, record)
+	return nil
+}
+
+func cookSkinnedMesh(w *cookedWriter, name string, mesh jsonObject) error {
+	triangles, ok1 := mesh.array("triangles")
+	vertices, ok2 := mesh.array("vertices")
+	uvs, ok3 := mesh.array("uvs")
+	if !ok1 || !ok2 || !ok3 {
+		// NOTE: The loader skips invalid skinned meshes as well.
+		return nil
+	}
+	if len(uvs)%2 != 0 {
+		return fmt.Errorf("the number of uvs is odd")
+	}
+
+	record := skeletonSkinnedMesh{Name: w.addString(name)}
+
+	// NOTE: Each vertex is written as its bone count followed by
+	// (bone index, x, y, weight) for each bone.
+	record.Vertices.First = w.count(skeletonSkinnedMeshVertices)
+	next := 0
+	readUint := func() (uint64, error) {
+		if next >= len(vertices) {
+			return 0, fmt.Errorf("the vertices are too short")
+		}
+		v, ok := decodeUint(vertices[next])
+		if !ok {
+			return 0, fmt.Errorf("invalid vertices")
+		}
+		next++
+		return v, nil
+	}
+	readFloat := func() (float32, error) {
+		if next >= len(vertices) {
+			return 0, fmt.Errorf("the vertices are too short")
+		}
+		v, ok := decodeNumber(vertices[next])
+		if !ok {
+			return 0, fmt.Errorf("invalid vertices")
+		}
+		next++
+		return float32(v), nil
+	}
+
+	for i := 0; i < len(uvs); i += 2 {
+		boneCount, err := readUint()
+		if err != nil {
+			return err
+		}
+		if boneCount == 0 || boneCount > 255 {
+			return fmt.Errorf("invalid bone count %d", boneCount)
+		}
+
+		vertex := skeletonSkinnedMeshVertex{
+			Influences: cookedSpan{First: w.count(skeletonSkinnedMeshInfluences), Count: uint32(boneCount)},
+		}
+		for k := uint64(0); k < boneCount; k++ {
+			var influence skeletonSkinnedMeshInfluence
+			joint, err := readUint()
+			if err != nil {
+				return err
+			}
+			influence.Joint = uint32(joint)
+			if influence.X, err = readFloat(); err != nil {
+				return err
+			}
+			if influence.Y, err = readFloat(); err != nil {
+				return err
+			}
+			if influence.Weight, err = readFloat(); err != nil {
+				return err
+			}
+			w.add(skeletonSkinnedMeshInfluences, influence)
+		}
+
+		u, ok1 := decodeNumber(uvs[i])
+		v, ok2 := decodeNumber(uvs[i+1])
+		if !ok1 || !ok2 {
+			return fmt.Errorf("invalid uvs")
+		}
+		vertex.U = float32(u)
+		vertex.V = float32(v)
+		w.add(skeletonSkinnedMeshVertices, vertex)
+	}
+	record.Vertices.Count = w.count(skeletonSkinnedMeshVertices) - record.Vertices.First
+
+	record.Indices.First = w.count(skeletonSkinnedMeshIndices)
+	for _, data := range triangles {
+		index, ok := decodeUint(data)
+		if !ok || index > 0xffff {
+			return fmt.Errorf("invalid triangles")
+		}
+		w.add(skeletonSkinnedMeshIndices, uint16(index))
+	}
+	record.Indices.Count = w.count(skeletonSkinnedMeshIndices) - record.Indices.First
+
+	w.add(skeletonSkinnedMeshes, record)
+	return nil
+}
+
+func readCurve(sample jsonObject) uint32 {
+	data, ok := sample.member("curve")
+	if !ok {
+		return curveLinear
+	}
+	if s, ok := decodeString(data); ok {
+		if s != "linear" {
+			return curveStepped
+		}
+		return curveLinear
+	}
+	if _, ok := decodeArray(data); ok {
+		return curveBezier
+	}
+	return curveLinear
+}
+
+// samples returns the samples that have the time.
+func samples(track jsonObject, name string) []jsonObject {
+	array, ok := track.array(name)
+	if !ok {
+		return nil
+	}
+	var result []jsonObject
+	for _, data := range array {
+		sample, ok := decodeObject(data)
+		if !ok {
+			continue
+		}
+		if _, ok := sample.member("time"); !ok {
+			continue
+		}
+		result = append(result, sample)
+	}
+	return result
+}
+
+func cookBoneTrack(w *cookedWriter, boneName string, track jsonObject) {
+	record := skeletonBoneTrack{BoneName: w.addString(boneName)}
+
+	record.TranslateSamples.First = w.count(skeletonTranslateSamples)
+	for _, sample := range samples(track, "translate") {
+		s := skeletonTranslateSample{Curve: readCurve(sample)}
+		sample.readNumber("time", &s.Time)
+		sample.readNumber("x", &s.X)
+		sample.readNumber("y", &s.Y)
+		w.add(skeletonTranslateSamples, s)
+	}
+	record.TranslateSamples.Count = w.count(skeletonTranslateSamples) - record.TranslateSamples.First
+
+	record.RotateSamples.First = w.count(skeletonRotateSamples)
+	for _, sample := range samples(track, "rotate") {
+		s := skeletonRotateSample{Curve: readCurve(sample)}
+		sample.readNumber("time", &s.Time)
+		sample.readNumber("angle", &s.Angle)
+		w.add(skeletonRotateSamples, s)
+	}
+	record.RotateSamples.Count = w.count(skeletonRotateSamples) - record.RotateSamples.First
+
+	record.ScaleSamples.First = w.count(skeletonScaleSamples)
+	for _, sample := range samples(track, "scale") {
+		s := skeletonScaleSample{Scale: 1, Curve: readCurve(sample)}
+		sample.readNumber("time", &s.Time)
+		sample.readNumber("x", &s.Scale)
+		sample.readNumber("y", &s.Scale)
+		w.add(skeletonScaleSamples, s)
+	}
+	record.ScaleSamples.Count = w.count(skeletonScaleSamples) - record.ScaleSamples.First
+
+	w.add(skeletonBoneTracks, record)
+}
+
+func cookSlotTrack(w *cookedWriter, slotName string, track jsonObject) {
+	record := skeletonSlotTrack{SlotName: w.addString(slotName)}
+
+	record.AttachmentSamples.First = w.count(skeletonAttachmentSamples)
+	for _, sample := range samples(track, "attachment") {
+		if _, ok := sample.member("name"); !ok {
+			continue
+		}
+		name, _ := sample.string("name")
+		s := skeletonAttachmentSample{Name: w.addString(name)}
+		sample.readNumber("time", &s.Time)
+		w.add(skeletonAttachmentSamples, s)
+	}
+	record.AttachmentSamples.Count = w.count(skeletonAttachmentSamples) - record.AttachmentSamples.First
+
+	w.add(skeletonSlotTracks, record)
+}
+
+// isSkeleton returns true if the JSON looks like a Spine skeleton.
+func isSkeleton(document jsonObject) bool {
+	_, ok := document.member("bones")
+	return ok
+}
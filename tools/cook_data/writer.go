@@ -0,0 +1,116 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+package main
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"math"
+)
+
+// NOTE: The container format must be kept in sync with `include/Pomdog/Content/Utility/CookedData.hpp`.
+const (
+	headerSize       = 16
+	sectionEntrySize = 8
+	sectionAlignment = 8
+)
+
+func makeFourCC(s string) uint32 {
+	return uint32(s[0]) | uint32(s[1])<<8 | uint32(s[2])<<16 | uint32(s[3])<<24
+}
+
+type cookedString struct {
+	Offset uint32
+	Length uint32
+}
+
+type cookedSpan struct {
+	First uint32
+	Count uint32
+}
+
+// cookedWriter builds a cooked data file. Section 0 always holds the strings.
+type cookedWriter struct {
+	signature uint32
+	version   uint32
+	offsets   map[string]cookedString
+	sections  []bytes.Buffer
+	counts    []uint32
+}
+
+func newCookedWriter(signature string, version uint32, sectionCount int) *cookedWriter {
+	return &cookedWriter{
+		signature: makeFourCC(signature),
+		version:   version,
+		offsets:   map[string]cookedString{},
+		sections:  make([]bytes.Buffer, sectionCount),
+		counts:    make([]uint32, sectionCount),
+	}
+}
+
+// addString returns the reference to the string. Equal strings share their characters.
+func (w *cookedWriter) addString(s string) cookedString {
+	if ref, ok := w.offsets[s]; ok {
+		return ref
+	}
+	strings := &w.sections[0]
+	ref := cookedString{Offset: uint32(strings.Len()), Length: uint32(len(s))}
+	strings.WriteString(s)
+	w.offsets[s] = ref
+	return ref
+}
+
+// add appends the record, which must be a fixed-size value, to the section
+// and returns its index.
+func (w *cookedWriter) add(section int, record interface{}) uint32 {
+	if err := binary.Write(&w.sections[section], binary.LittleEndian, record); err != nil {
+		panic(err)
+	}
+	index := w.counts[section]
+	w.counts[section]++
+	return index
+}
+
+// count returns the number of records in the section.
+func (w *cookedWriter) count(section int) uint32 {
+	return w.counts[section]
+}
+
+func alignUp(offset, alignment int) int {
+	return (offset + alignment - 1) / alignment * alignment
+}
+
+func (w *cookedWriter) bytes() ([]byte, error) {
+	var out bytes.Buffer
+	write := func(v interface{}) {
+		if err := binary.Write(&out, binary.LittleEndian, v); err != nil {
+			panic(err)
+		}
+	}
+
+	write(w.signature)
+	write(w.version)
+	write(uint32(len(w.sections)))
+	write(uint32(0))
+
+	offset := headerSize + sectionEntrySize*len(w.sections)
+	for i := range w.sections {
+		offset = alignUp(offset, sectionAlignment)
+		size := w.sections[i].Len()
+		if offset+size > math.MaxUint32 {
+			return nil, fmt.Errorf("the cooked data is too large")
+		}
+		write(uint32(offset))
+		write(uint32(size))
+		offset += size
+	}
+
+	for i := range w.sections {
+		for out.Len()%sectionAlignment != 0 {
+			out.WriteByte(0)
+		}
+		out.Write(w.sections[i].Bytes())
+	}
+	return out.Bytes(), nil
+}
@@ -0,0 +1,500 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+package main
+
+import (
+	"bufio"
+	"encoding/binary"
+	"flag"
+	"fmt"
+	"image"
+	"image/draw"
+	_ "image/gif"
+	_ "image/jpeg"
+	_ "image/png"
+	"log"
+	"math"
+	"os"
+	"path/filepath"
+	"strings"
+)
+
+// NOTE: The output must be readable by `src/Content/Image/DDS.cpp`.
+const (
+	ddsFlagCaps        = 0x00000001
+	ddsFlagHeight      = 0x00000002
+	ddsFlagWidth       = 0x00000004
+	ddsFlagPitch       = 0x00000008
+	ddsFlagPixelFormat = 0x00001000
+	ddsFlagMipMapCount = 0x00020000
+	ddsFlagLinearSize  = 0x00080000
+
+	ddsPixelFormatAlphaPixels = 0x00000001
+	ddsPixelFormatFourCC      = 0x00000004
+	ddsPixelFormatRGB         = 0x00000040
+
+	ddsCapsComplex = 0x00000008
+	ddsCapsTexture = 0x00001000
+	ddsCapsMipMap  = 0x00400000
+)
+
+const (
+	formatAuto  = "auto"
+	formatBC1   = "bc1"
+	formatBC3   = "bc3"
+	formatRGBA8 = "rgba8"
+)
+
+var options struct {
+	input   string
+	output  string
+	format  string
+	mipmaps bool
+	verbose bool
+}
+
+var imageExtensions = []string{".png", ".jpg", ".jpeg", ".gif"}
+
+func main() {
+	flag.StringVar(&options.input, "i", "", "input image file or directory")
+	flag.StringVar(&options.output, "o", "", "output DDS file or directory")
+	flag.StringVar(&options.format, "format", formatAuto, "output format (auto, bc1, bc3 or rgba8)")
+	flag.BoolVar(&options.mipmaps, "mipmaps", true, "generate the full mipmap chain")
+	flag.BoolVar(&options.verbose, "v", false, "print the cooked files")
+	flag.Parse()
+
+	if options.input == "" || options.output == "" {
+		flag.Usage()
+		os.Exit(1)
+	}
+
+	switch options.format {
+	case formatAuto, formatBC1, formatBC3, formatRGBA8:
+	default:
+		log.Fatalf("unsupported format %q", options.format)
+	}
+
+	if err := run(options.input, options.output); err != nil {
+		log.Fatalln(err)
+	}
+}
+
+func run(input, output string) error {
+	info, err := os.Stat(input)
+	if err != nil {
+		return err
+	}
+	if !info.IsDir() {
+		return cook(input, output)
+	}
+
+	return filepath.Walk(input, func(path string, info os.FileInfo, err error) error {
+		if err != nil {
+			return err
+		}
+		if info.IsDir() || !isImageFile(path) {
+			return nil
+		}
+
+		rel, err := filepath.Rel(input, path)
+		if err != nil {
+			return err
+		}
+		dest := filepath.Join(output, strings.TrimSuffix(rel, filepath.Ext(rel))+".dds")
+		if err := os.MkdirAll(filepath.Dir(dest), os.ModePerm); err != nil {
+			return err
+		}
+		return cook(path, dest)
+	})
+}
+
+func isImageFile(path string) bool {
+	ext := strings.ToLower(filepath.Ext(path))
+	for _, e := range imageExtensions {
+		if ext == e {
+			return true
+		}
+	}
+	return false
+}
+
+func cook(input, output string) error {
+	src, err := loadImage(input)
+	if err != nil {
+		return fmt.Errorf("%s: %v", input, err)
+	}
+
+	format := options.format
+	if format == formatAuto {
+		format = formatBC1
+		if hasAlpha(src) {
+			format = formatBC3
+		}
+	}
+
+	levels := []*image.NRGBA{src}
+	if options.mipmaps {
+		for level := src; level.Rect.Dx() > 1 || level.Rect.Dy() > 1; {
+			level = downsample(level)
+			levels = append(levels, level)
+		}
+	}
+
+	f, err := os.Create(output)
+	if err != nil {
+		return err
+	}
+	defer f.Close()
+
+	w := bufio.NewWriter(f)
+	if err := writeDDS(w, levels, format); err != nil {
+		return err
+	}
+	if err := w.Flush(); err != nil {
+		return err
+	}
+
+	if options.verbose {
+		fmt.Printf("%s -> %s (%s, %dx%d, %d levels)\n",
+			input, output, format, src.Rect.Dx(), src.Rect.Dy(), len(levels))
+	}
+	return nil
+}
+
+func loadImage(path string) (*image.NRGBA, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, err
+	}
+	defer f.Close()
+
+	img, _, err := image.Decode(f)
+	if err != nil {
+		return nil, err
+	}
+
+	// NOTE: The engine blends with non-premultiplied alpha, so the pixels are
+	// kept non-premultiplied.
+	bounds := img.Bounds()
+	dst := image.NewNRGBA(image.Rect(0, 0, bounds.Dx(), bounds.Dy()))
+	draw.Draw(dst, dst.Rect, img, bounds.Min, draw.Src)
+	return dst, nil
+}
+
+func hasAlpha(img *image.NRGBA) bool {
+	for i := 3; i < len(img.Pix); i += 4 {
+		if img.Pix[i] != 0xff {
+			return true
+		}
+	}
+	return false
+}
+
+// downsample halves the image with a box filter. The colors are weighted by
+// alpha, so that transparent pixels do not bleed into the opaque ones.
+func downsample(src *image.NRGBA) *image.NRGBA {
+	sw, sh := src.Rect.Dx(), src.Rect.Dy()
+	dw, dh := maxInt(sw/2, 1), maxInt(sh/2, 1)
+	dst := image.NewNRGBA(image.Rect(0, 0, dw, dh))
+
+	for y := 0; y < dh; y++ {
+		for x := 0; x < dw; x++ {
+			var r, g, b, a uint32
+			for _, p := range [4][2]int{{0, 0}, {1, 0}, {0, 1}, {1, 1}} {
+				sx := minInt(x*2+p[0], sw-1)
+				sy := minInt(y*2+p[1], sh-1)
+				i := src.PixOffset(sx, sy)
+				pa := uint32(src.Pix[i+3])
+				r += uint32(src.Pix[i+0]) * pa
+				g += uint32(src.Pix[i+1]) * pa
+				b += uint32(src.Pix[i+2]) * pa
+				a += pa
+			}
+
+			i := dst.PixOffset(x, y)
+			if a > 0 {
+				dst.Pix[i+0] = uint8((r + a/2) / a)
+				dst.Pix[i+1] = uint8((g + a/2) / a)
+				dst.Pix[i+2] = uint8((b + a/2) / a)
+			}
+			dst.Pix[i+3] = uint8((a + 2) / 4)
+		}
+	}
+	return dst
+}
+
+func writeDDS(w *bufio.Writer, levels []*image.NRGBA, format string) error {
+	width, height := levels[0].Rect.Dx(), levels[0].Rect.Dy()
+
+	var data []byte
+	for _, level := range levels {
+		switch format {
+		case formatBC1:
+			data = append(data, compressBlocks(level, 8, encodeBC1Block)...)
+		case formatBC3:
+			data = append(data, compressBlocks(level, 16, encodeBC3Block)...)
+		default:
+			data = append(data, level.Pix...)
+		}
+	}
+
+	header := struct {
+		Magic       [4]byte
+		Size        uint32
+		Flags       uint32
+		Height      uint32
+		Width       uint32
+		LinearSize  uint32
+		Depth       uint32
+		MipMapCount uint32
+		Reserved1   [11]uint32
+		PFSize      uint32
+		PFFlags     uint32
+		FourCC      [4]byte
+		RGBBitCount uint32
+		RBitMask    uint32
+		GBitMask    uint32
+		BBitMask    uint32
+		ABitMask    uint32
+		Caps        uint32
+		Caps2       uint32
+		Caps3       uint32
+		Caps4       uint32
+		Reserved2   uint32
+	}{
+		Magic:       [4]byte{'D', 'D', 'S', ' '},
+		Size:        124,
+		Flags:       ddsFlagCaps | ddsFlagHeight | ddsFlagWidth | ddsFlagPixelFormat | ddsFlagMipMapCount,
+		Height:      uint32(height),
+		Width:       uint32(width),
+		MipMapCount: uint32(len(levels)),
+		PFSize:      32,
+		Caps:        ddsCapsTexture,
+	}
+
+	if len(levels) > 1 {
+		header.Caps |= ddsCapsComplex | ddsCapsMipMap
+	}
+
+	switch format {
+	case formatBC1, formatBC3:
+		header.Flags |= ddsFlagLinearSize
+		header.PFFlags = ddsPixelFormatFourCC
+		if format == formatBC1 {
+			header.FourCC = [4]byte{'D', 'X', 'T', '1'}
+			header.LinearSize = uint32(blockCount(width) * blockCount(height) * 8)
+		} else {
+			header.FourCC = [4]byte{'D', 'X', 'T', '5'}
+			header.LinearSize = uint32(blockCount(width) * blockCount(height) * 16)
+		}
+	default:
+		header.Flags |= ddsFlagPitch
+		header.LinearSize = uint32(width * 4)
+		header.PFFlags = ddsPixelFormatRGB | ddsPixelFormatAlphaPixels
+		header.RGBBitCount = 32
+		header.RBitMask = 0x000000ff
+		header.GBitMask = 0x0000ff00
+		header.BBitMask = 0x00ff0000
+		header.ABitMask = 0xff000000
+	}
+
+	if err := binary.Write(w, binary.LittleEndian, &header); err != nil {
+		return err
+	}
+	_, err := w.Write(data)
+	return err
+}
+
+func blockCount(pixels int) int {
+	return (pixels + 3) / 4
+}
+
+type blockEncoder func(block *[16][4]uint8, dst []byte)
+
+func compressBlocks(img *image.NRGBA, bytesPerBlock int, encode blockEncoder) []byte {
+	width, height := img.Rect.Dx(), img.Rect.Dy()
+	bw, bh := blockCount(width), blockCount(height)
+	data := make([]byte, bw*bh*bytesPerBlock)
+
+	var block [16][4]uint8
+	for by := 0; by < bh; by++ {
+		for bx := 0; bx < bw; bx++ {
+			// NOTE: The edge pixels are repeated to fill partial blocks.
+			for i := 0; i < 16; i++ {
+				x := minInt(bx*4+i%4, width-1)
+				y := minInt(by*4+i/4, height-1)
+				o := img.PixOffset(x, y)
+				copy(block[i][:], img.Pix[o:o+4])
+			}
+			offset := (by*bw + bx) * bytesPerBlock
+			encode(&block, data[offset:offset+bytesPerBlock])
+		}
+	}
+	return data
+}
+
+func encodeBC1Block(block *[16][4]uint8, dst []byte) {
+	encodeColorBlock(block, dst)
+}
+
+func encodeBC3Block(block *[16][4]uint8, dst []byte) {
+	encodeAlphaBlock(block, dst[0:8])
+	encodeColorBlock(block, dst[8:16])
+}
+
+// encodeColorBlock encodes the colors of a block along their principal axis
+// in the four-color mode of BC1.
+func encodeColorBlock(block *[16][4]uint8, dst []byte) {
+	var mean [3]float64
+	for _, p := range block {
+		for c := 0; c < 3; c++ {
+			mean[c] += float64(p[c])
+		}
+	}
+	for c := 0; c < 3; c++ {
+		mean[c] /= 16
+	}
+
+	var cov [3][3]float64
+	for _, p := range block {
+		d := [3]float64{float64(p[0]) - mean[0], float64(p[1]) - mean[1], float64(p[2]) - mean[2]}
+		for i := 0; i < 3; i++ {
+			for j := 0; j < 3; j++ {
+				cov[i][j] += d[i] * d[j]
+			}
+		}
+	}
+
+	// NOTE: The principal axis is found by power iteration.
+	axis := [3]float64{1, 1, 1}
+	for iter := 0; iter < 8; iter++ {
+		var next [3]float64
+		for i := 0; i < 3; i++ {
+			next[i] = cov[i][0]*axis[0] + cov[i][1]*axis[1] + cov[i][2]*axis[2]
+		}
+		length := math.Sqrt(next[0]*next[0] + next[1]*next[1] + next[2]*next[2])
+		if length < 1e-9 {
+			break
+		}
+		for i := 0; i < 3; i++ {
+			axis[i] = next[i] / length
+		}
+	}
+
+	minT, maxT := math.Inf(1), math.Inf(-1)
+	for _, p := range block {
+		t := (float64(p[0])-mean[0])*axis[0] + (float64(p[1])-mean[1])*axis[1] + (float64(p[2])-mean[2])*axis[2]
+		minT = math.Min(minT, t)
+		maxT = math.Max(maxT, t)
+	}
+
+	endpoint := func(t float64) uint16 {
+		var rgb [3]uint8
+		for c := 0; c < 3; c++ {
+			rgb[c] = uint8(math.Max(0, math.Min(255, math.Round(mean[c]+axis[c]*t))))
+		}
+		return toRGB565(rgb)
+	}
+
+	c0, c1 := endpoint(maxT), endpoint(minT)
+	if c0 < c1 {
+		c0, c1 = c1, c0
+	}
+
+	binary.LittleEndian.PutUint16(dst[0:2], c0)
+	binary.LittleEndian.PutUint16(dst[2:4], c1)
+
+	var indices uint32
+	if c0 != c1 {
+		p0, p1 := fromRGB565(c0), fromRGB565(c1)
+		var palette [4][3]int
+		for c := 0; c < 3; c++ {
+			palette[0][c] = p0[c]
+			palette[1][c] = p1[c]
+			palette[2][c] = (2*p0[c] + p1[c]) / 3
+			palette[3][c] = (p0[c] + 2*p1[c]) / 3
+		}
+
+		for i, p := range block {
+			best, bestDist := 0, math.MaxInt32
+			for k, q := range palette {
+				dr, dg, db := int(p[0])-q[0], int(p[1])-q[1], int(p[2])-q[2]
+				if dist := dr*dr + dg*dg + db*db; dist < bestDist {
+					best, bestDist = k, dist
+				}
+			}
+			indices |= uint32(best) << (2 * uint(i))
+		}
+	}
+	binary.LittleEndian.PutUint32(dst[4:8], indices)
+}
+
+// encodeAlphaBlock encodes the alpha of a block in the eight-alpha mode of BC3.
+func encodeAlphaBlock(block *[16][4]uint8, dst []byte) {
+	a0, a1 := uint8(0), uint8(255)
+	for _, p := range block {
+		if p[3] > a0 {
+			a0 = p[3]
+		}
+		if p[3] < a1 {
+			a1 = p[3]
+		}
+	}
+
+	dst[0], dst[1] = a0, a1
+
+	var indices uint64
+	if a0 != a1 {
+		var palette [8]int
+		palette[0], palette[1] = int(a0), int(a1)
+		for k := 1; k < 7; k++ {
+			palette[k+1] = ((7-k)*int(a0) + k*int(a1)) / 7
+		}
+
+		for i, p := range block {
+			best, bestDist := 0, math.MaxInt32
+			for k, q := range palette {
+				d := int(p[3]) - q
+				if d < 0 {
+					d = -d
+				}
+				if d < bestDist {
+					best, bestDist = k, d
+				}
+			}
+			indices |= uint64(best) << (3 * uint(i))
+		}
+	}
+
+	for i := 0; i < 6; i++ {
+		dst[2+i] = uint8(indices >> (8 * uint(i)))
+	}
+}
+
+func toRGB565(rgb [3]uint8) uint16 {
+	r := (uint16(rgb[0])*31 + 127) / 255
+	g := (uint16(rgb[1])*63 + 127) / 255
+	b := (uint16(rgb[2])*31 + 127) / 255
+	return (r << 11) | (g << 5) | b
+}
+
+func fromRGB565(c uint16) [3]int {
+	r := int(c>>11) & 0x1f
+	g := int(c>>5) & 0x3f
+	b := int(c) & 0x1f
+	return [3]int{(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)}
+}
+
+func minInt(a, b int) int {
+	if a < b {
+		return a
+	}
+	return b
+}
+
+func maxInt(a, b int) int {
+	if a > b {
+		return a
+	}
+	return b
+}
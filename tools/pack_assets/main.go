@@ -0,0 +1,276 @@
+// Copyright (c) 2013-2020 mogemimi. Distributed under the MIT license.
+
+package main
+
+import (
+	"bufio"
+	"bytes"
+	"compress/zlib"
+	"encoding/binary"
+	"flag"
+	"fmt"
+	"hash/crc32"
+	"io/ioutil"
+	"log"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+)
+
+// NOTE: The archive format must be kept in sync with `src/Content/AssetArchive.hpp`.
+const (
+	archiveVersion = 1
+	headerSize     = 40
+	entrySize      = 40
+)
+
+const (
+	compressionNone    = 0
+	compressionDeflate = 1
+)
+
+var archiveSignature = [4]byte{'P', 'A', 'K', ' '}
+
+var options struct {
+	contentDir string
+	outputFile string
+	alignment  uint
+	deflate    string
+	verbose    bool
+}
+
+func main() {
+	flag.StringVar(&options.contentDir, "i", "", "content directory")
+	flag.StringVar(&options.outputFile, "o", "", "output archive file")
+	flag.UintVar(&options.alignment, "align", 16, "alignment of the asset contents in bytes")
+	flag.StringVar(&options.deflate, "deflate", ".json,.txt,.fnt,.atlas,.glsl,.hlsl,.metal", "comma-separated extensions of the files to compress")
+	flag.BoolVar(&options.verbose, "v", false, "print the packed files")
+	flag.Parse()
+
+	if options.contentDir == "" || options.outputFile == "" {
+		flag.Usage()
+		os.Exit(1)
+	}
+
+	if err := pack(options.contentDir, options.outputFile); err != nil {
+		log.Fatalln(err)
+	}
+}
+
+type entry struct {
+	Name        string
+	NameHash    uint32
+	NameOffset  uint32
+	Compression uint32
+	DataOffset  uint64
+	Size        uint64
+	Data        []byte
+}
+
+func isPowerOfTwo(n uint) bool {
+	return n > 0 && (n&(n-1)) == 0
+}
+
+func alignUp(offset, alignment uint64) uint64 {
+	return (offset + alignment - 1) / alignment * alignment
+}
+
+func shouldDeflate(name string, extensions []string) bool {
+	ext := strings.ToLower(filepath.Ext(name))
+	for _, e := range extensions {
+		if ext == e {
+			return true
+		}
+	}
+	return false
+}
+
+func deflate(data []byte) ([]byte, error) {
+	var buf bytes.Buffer
+	w, err := zlib.NewWriterLevel(&buf, zlib.BestCompression)
+	if err != nil {
+		return nil, err
+	}
+	if _, err := w.Write(data); err != nil {
+		return nil, err
+	}
+	if err := w.Close(); err != nil {
+		return nil, err
+	}
+	return buf.Bytes(), nil
+}
+
+func collectEntries(contentDir string, extensions []string) ([]entry, error) {
+	entries := []entry{}
+
+	err := filepath.Walk(contentDir, func(path string, info os.FileInfo, err error) error {
+		if err != nil {
+			return err
+		}
+		if info.IsDir() {
+			return nil
+		}
+
+		rel, err := filepath.Rel(contentDir, path)
+		if err != nil {
+			return err
+		}
+		name := filepath.ToSlash(rel)
+
+		data, err := ioutil.ReadFile(path)
+		if err != nil {
+			return fmt.Errorf("failed to read %s: %w", path, err)
+		}
+
+		e := entry{
+			Name:        name,
+			NameHash:    crc32.ChecksumIEEE([]byte(name)),
+			Compression: compressionNone,
+			Size:        uint64(len(data)),
+			Data:        data,
+		}
+
+		if shouldDeflate(name, extensions) {
+			compressed, err := deflate(data)
+			if err != nil {
+				return fmt.Errorf("failed to compress %s: %w", path, err)
+			}
+			// NOTE: Files that do not get smaller are stored as is, so that
+			// they can be read without a copy.
+			if len(compressed) < len(data) {
+				e.Compression = compressionDeflate
+				e.Data = compressed
+			}
+		}
+
+		entries = append(entries, e)
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+
+	// NOTE: The runtime binary-searches the index by hash.
+	sort.Slice(entries, func(i, j int) bool {
+		if entries[i].NameHash != entries[j].NameHash {
+			return entries[i].NameHash < entries[j].NameHash
+		}
+		return entries[i].Name < entries[j].Name
+	})
+	return entries, nil
+}
+
+func pack(contentDir, outputFile string) error {
+	if !isPowerOfTwo(options.alignment) {
+		return fmt.Errorf("alignment must be a power of two: %d", options.alignment)
+	}
+	alignment := uint64(options.alignment)
+
+	extensions := []string{}
+	for _, e := range strings.Split(options.deflate, ",") {
+		if e = strings.TrimSpace(e); e != "" {
+			extensions = append(extensions, strings.ToLower(e))
+		}
+	}
+
+	entries, err := collectEntries(contentDir, extensions)
+	if err != nil {
+		return err
+	}
+
+	indexOffset := uint64(headerSize)
+	namesOffset := indexOffset + uint64(len(entries))*entrySize
+
+	var names bytes.Buffer
+	for i := range entries {
+		entries[i].NameOffset = uint32(names.Len())
+		names.WriteString(entries[i].Name)
+	}
+
+	offset := alignUp(namesOffset+uint64(names.Len()), alignment)
+	for i := range entries {
+		entries[i].DataOffset = offset
+		offset = alignUp(offset+uint64(len(entries[i].Data)), alignment)
+	}
+
+	file, err := os.Create(outputFile)
+	if err != nil {
+		return err
+	}
+	defer file.Close()
+
+	w := bufio.NewWriter(file)
+	le := binary.LittleEndian
+
+	header := struct {
+		Signature   [4]byte
+		Version     uint32
+		EntryCount  uint32
+		Alignment   uint32
+		IndexOffset uint64
+		NamesOffset uint64
+		NamesSize   uint64
+	}{
+		Signature:   archiveSignature,
+		Version:     archiveVersion,
+		EntryCount:  uint32(len(entries)),
+		Alignment:   uint32(alignment),
+		IndexOffset: indexOffset,
+		NamesOffset: namesOffset,
+		NamesSize:   uint64(names.Len()),
+	}
+	if err := binary.Write(w, le, &header); err != nil {
+		return err
+	}
+
+	for _, e := range entries {
+		record := struct {
+			NameHash    uint32
+			NameOffset  uint32
+			NameLength  uint32
+			Compression uint32
+			DataOffset  uint64
+			StoredSize  uint64
+			Size        uint64
+		}{
+			NameHash:    e.NameHash,
+			NameOffset:  e.NameOffset,
+			NameLength:  uint32(len(e.Name)),
+			Compression: e.Compression,
+			DataOffset:  e.DataOffset,
+			StoredSize:  uint64(len(e.Data)),
+			Size:        e.Size,
+		}
+		if err := binary.Write(w, le, &record); err != nil {
+			return err
+		}
+	}
+
+	if _, err := w.Write(names.Bytes()); err != nil {
+		return err
+	}
+
+	written := namesOffset + uint64(names.Len())
+	for _, e := range entries {
+		padding := make([]byte, e.DataOffset-written)
+		if _, err := w.Write(padding); err != nil {
+			return err
+		}
+		if _, err := w.Write(e.Data); err != nil {
+			return err
+		}
+		written = e.DataOffset + uint64(len(e.Data))
+
+		if options.verbose {
+			fmt.Printf("%s (%d -> %d bytes)\n", e.Name, e.Size, len(e.Data))
+		}
+	}
+
+	if err := w.Flush(); err != nil {
+		return err
+	}
+
+	fmt.Printf("packed %d files into %s (%d bytes)\n", len(entries), outputFile, written)
+	return nil
+}